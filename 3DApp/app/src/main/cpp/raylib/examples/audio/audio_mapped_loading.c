@@ -0,0 +1,238 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - mapped loading (load time and peak memory)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: WAV and QOA files are mapped into memory on loading [LoadSound(), LoadMusicStream()]
+*         if supported by platform (desktop POSIX and Android assets), no file data is copied
+*         into heap memory. Big WAV sounds reference mapped PCM data, music is decoded from
+*         mapped data. Loading from file data [LoadFileData()] is measured for comparison
+*
+*   NOTE: Peak memory is process peak resident set size, only available on Linux and Android,
+*         it is reset before every load
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: FILE, fopen(), fgets(), fputs(), fclose()
+#include <stdlib.h>             // Required for: atoi()
+#include <string.h>             // Required for: strncmp()
+
+#define MAX_LOAD_MODES      6
+
+// Load modes: sound/music from generated WAV and QOA files, mapped or from file data
+typedef enum {
+    LOAD_SOUND_WAV_MAPPED = 0,
+    LOAD_SOUND_WAV_DATA,
+    LOAD_MUSIC_WAV_MAPPED,
+    LOAD_MUSIC_WAV_DATA,
+    LOAD_MUSIC_QOA_MAPPED,
+    LOAD_MUSIC_QOA_DATA
+} LoadMode;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static int ResetPeakMemory(void);                   // Reset process peak memory, returns current memory (KB)
+static int GetPeakMemory(void);                     // Get process peak memory since reset (KB)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - mapped loading");
+
+    InitAudioDevice();      // Initialize audio device
+
+    // Generate uncompressed WAV and QOA files to be loaded
+    Wave wave = LoadWave("resources/country.mp3");
+    ExportWave(wave, "country_mapped.wav");
+    ExportWave(wave, "country_mapped.qoa");
+    UnloadWave(wave);
+
+    const char *modeNames[MAX_LOAD_MODES] = {
+        "LoadSound(wav)", "LoadSoundFromWave(data)",
+        "LoadMusicStream(wav)", "LoadMusicStreamFromMemory(wav)",
+        "LoadMusicStream(qoa)", "LoadMusicStreamFromMemory(qoa)"
+    };
+
+    float loadTime[MAX_LOAD_MODES] = { 0 };         // Load time (ms)
+    int peakMemory[MAX_LOAD_MODES] = { 0 };         // Peak memory increase on loading (KB)
+    bool measured[MAX_LOAD_MODES] = { 0 };
+
+    Sound sound = { 0 };
+    Music music = { 0 };
+    unsigned char *musicData = NULL;                // Music file data, kept loaded while music is streamed
+    int currentMode = -1;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        int mode = GetKeyPressed() - KEY_ONE;
+
+        if ((mode >= 0) && (mode < MAX_LOAD_MODES))
+        {
+            // Unload previous sound or music, before measuring
+            if (IsSoundValid(sound)) UnloadSound(sound);
+            if (IsMusicValid(music)) UnloadMusicStream(music);
+            UnloadFileData(musicData);
+            sound = (Sound){ 0 };
+            music = (Music){ 0 };
+            musicData = NULL;
+
+            int baseMemory = ResetPeakMemory();
+            double startTime = GetTime();
+
+            switch (mode)
+            {
+                case LOAD_SOUND_WAV_MAPPED: sound = LoadSound("country_mapped.wav"); break;
+                case LOAD_SOUND_WAV_DATA:
+                {
+                    int dataSize = 0;
+                    unsigned char *data = LoadFileData("country_mapped.wav", &dataSize);
+                    Wave dataWave = LoadWaveFromMemory(".wav", data, dataSize);
+                    sound = LoadSoundFromWave(dataWave);
+                    UnloadWave(dataWave);
+                    UnloadFileData(data);
+                } break;
+                case LOAD_MUSIC_WAV_MAPPED: music = LoadMusicStream("country_mapped.wav"); break;
+                case LOAD_MUSIC_QOA_MAPPED: music = LoadMusicStream("country_mapped.qoa"); break;
+                case LOAD_MUSIC_WAV_DATA:
+                case LOAD_MUSIC_QOA_DATA:
+                {
+                    // NOTE: File data must be kept loaded while music is streamed
+                    int dataSize = 0;
+                    const char *fileName = (mode == LOAD_MUSIC_WAV_DATA)? "country_mapped.wav" : "country_mapped.qoa";
+                    musicData = LoadFileData(fileName, &dataSize);
+                    music = LoadMusicStreamFromMemory(GetFileExtension(fileName), musicData, dataSize);
+                } break;
+                default: break;
+            }
+
+            loadTime[mode] = (float)((GetTime() - startTime)*1000.0);
+            peakMemory[mode] = (baseMemory >= 0)? (GetPeakMemory() - baseMemory) : -1;
+            measured[mode] = true;
+            currentMode = mode;
+
+            if (IsSoundValid(sound)) PlaySound(sound);
+            if (IsMusicValid(music)) PlayMusicStream(music);
+        }
+
+        if (IsMusicValid(music)) UpdateMusicStream(music);      // Update music buffer with new stream data
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_LOAD_MODES; i++)
+            {
+                int y = 170 + i*40;
+
+                DrawRectangle(20, y, 760, 32, (i == currentMode)? Fade(MAROON, 0.2f) : Fade(LIGHTGRAY, 0.5f));
+                DrawText(TextFormat("[%i] %s", i + 1, modeNames[i]), 30, y + 10, 10, DARKGRAY);
+
+                if (measured[i])
+                {
+                    DrawText(TextFormat("%.2f ms", loadTime[i]), 380, y + 10, 10, BLACK);
+
+                    if (peakMemory[i] >= 0) DrawText(TextFormat("peak +%.2f MB", peakMemory[i]/1024.0f), 520, y + 10, 10, MAROON);
+                    else DrawText("peak memory not available", 520, y + 10, 10, GRAY);
+                }
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText("Source: resources/country.mp3 exported to WAV and QOA", 20, 20, 10, BLACK);
+            DrawText("Mapped: file mapped into memory, no data copy", 20, 40, 10, BLACK);
+            DrawText("Data: file data loaded into heap memory", 20, 60, 10, BLACK);
+            if (currentMode >= 0) DrawText(TextFormat("%.2f ms | %s", loadTime[currentMode], (peakMemory[currentMode] >= 0)? TextFormat("+%.1f MB", peakMemory[currentMode]/1024.0f) : "n/a"), 20, 80, 20, MAROON);
+            DrawText("1-6: load and play (previous one is unloaded)", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    if (IsSoundValid(sound)) UnloadSound(sound);            // Unload sound data
+    if (IsMusicValid(music)) UnloadMusicStream(music);      // Unload music stream buffers from RAM
+    UnloadFileData(musicData);      // Unload music file data
+
+    CloseAudioDevice();             // Close audio device
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Reset process peak memory, returns current memory (KB)
+// NOTE: Peak resident set size is reset writing "5" to /proc/self/clear_refs (Linux 4.0)
+static int ResetPeakMemory(void)
+{
+#if defined(__linux__)
+    FILE *clearRefs = fopen("/proc/self/clear_refs", "w");
+
+    if (clearRefs != NULL)
+    {
+        fputs("5", clearRefs);
+        fclose(clearRefs);
+    }
+
+    return GetPeakMemory();
+#else
+    return -1;
+#endif
+}
+
+// Get process peak memory since reset (KB)
+static int GetPeakMemory(void)
+{
+    int peak = -1;
+
+#if defined(__linux__)
+    FILE *status = fopen("/proc/self/status", "r");
+
+    if (status != NULL)
+    {
+        char line[256] = { 0 };
+
+        while (fgets(line, 256, status) != NULL)
+        {
+            if (strncmp(line, "VmHWM:", 6) == 0) { peak = atoi(line + 6); break; }
+        }
+
+        fclose(status);
+    }
+#endif
+
+    return peak;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - audio mixer benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Many sound aliases are played at once, every frame all voices are moved around
+*         [SetSoundVolume(), SetSoundPan()] and ended voices are restarted [PlaySound()].
+*         API calls only queue commands to the mixer (audio thread never locks), calls time
+*         is averaged over frames and worst call time is reported
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sinf(), cosf()
+
+#define MAX_VOICES      128     // Maximum sound aliases played at once
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - audio mixer benchmark");
+
+    InitAudioDevice();      // Initialize audio device
+
+    Sound sound = LoadSound("resources/sound.wav");     // Source sound, owns the sample data
+    Sound voices[MAX_VOICES] = { 0 };
+    for (int i = 0; i < MAX_VOICES; i++) voices[i] = LoadSoundAlias(sound);
+
+    const int voiceCounts[4] = { 16, 32, 64, 128 };
+    int countIndex = 0;
+
+    double callsTime = 0.0;             // API calls time accumulated over measured frames
+    double worstTime = 0.0;             // Worst single API call time over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average API calls time (ms)
+    float worstCallTime = 0.0f;         // Worst single API call time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_UP) && (countIndex < 3)) { countIndex++; callsTime = 0.0; worstTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0))
+        {
+            // Stop voices not used anymore
+            for (int i = voiceCounts[countIndex - 1]; i < voiceCounts[countIndex]; i++) StopSound(voices[i]);
+
+            countIndex--;
+            callsTime = 0.0;
+            worstTime = 0.0;
+            measuredFrames = 0;
+        }
+
+        int voiceCount = voiceCounts[countIndex];
+        int playingCount = 0;
+        float time = (float)GetTime();
+
+        double startTime = GetTime();
+
+        for (int i = 0; i < voiceCount; i++)
+        {
+            double callTime = GetTime();
+
+            if (!IsSoundPlaying(voices[i])) PlaySound(voices[i]);
+            else playingCount++;
+
+            SetSoundVolume(voices[i], 0.5f + 0.25f*sinf(time*2.0f + i));
+            SetSoundPan(voices[i], 0.5f + 0.5f*cosf(time + i*0.3f));
+
+            callTime = GetTime() - callTime;
+            if (callTime > worstTime) worstTime = callTime;
+        }
+
+        callsTime += (GetTime() - startTime);
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = (float)(callsTime*1000.0/measuredFrames);
+            worstCallTime = (float)(worstTime*1000.0);
+            callsTime = 0.0;
+            worstTime = 0.0;
+            measuredFrames = 0;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw voices pan (horizontal) and playing state
+            for (int i = 0; i < voiceCount; i++)
+            {
+                Vector2 position = { 20.0f + (0.5f + 0.5f*cosf(time + i*0.3f))*760.0f, 170.0f + (float)(i%64)*4.0f };
+                DrawCircleV(position, 3.0f, IsSoundPlaying(voices[i])? MAROON : LIGHTGRAY);
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Voices: %i (%i playing)", voiceCount, playingCount), 20, 20, 10, BLACK);
+            DrawText("Per voice: IsSoundPlaying(), SetSoundVolume(), SetSoundPan()", 20, 40, 10, BLACK);
+            DrawText(TextFormat("Worst voice update: %.3f ms", worstCallTime), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Voices update: %.3f ms/frame", averageTime), 20, 80, 20, MAROON);
+            DrawText("UP/DOWN: voices", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_VOICES; i++) UnloadSoundAlias(voices[i]);   // Unload sound aliases
+    UnloadSound(sound);             // Unload source sound data
+
+    CloseAudioDevice();             // Close audio device
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
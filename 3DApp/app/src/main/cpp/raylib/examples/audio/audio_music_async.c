@@ -0,0 +1,124 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - music decoded on background thread
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Long frames (like a level loading) are simulated, a 250 ms stall every second.
+*         Music decoded on game loop [UpdateMusicStream()] runs out of data and stutters,
+*         music decoded on a background thread [SetMusicStreamAsync()] keeps two seconds
+*         decoded ahead of playback, no update is required and seeking is asynchronous.
+*         On platforms without threads (web) music keeps decoded by UpdateMusicStream()
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MUSIC_BUFFER_TIME   2.0f    // Music decoded ahead of playback (seconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - music decoded on background thread");
+
+    InitAudioDevice();              // Initialize audio device
+
+    Music music = LoadMusicStream("resources/country.mp3");
+
+    bool async = true;
+    SetMusicStreamAsync(music, MUSIC_BUFFER_TIME);  // Music decoded on background thread
+
+    PlayMusicStream(music);
+
+    bool stalls = true;             // Long frames simulated
+    int framesCounter = 0;
+
+    float timePlayed = 0.0f;        // Time played normalized [0.0f..1.0f]
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateMusicStream(music);   // Update music buffer with new stream data (nothing to do if decoded on background thread)
+
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            async = !async;
+            SetMusicStreamAsync(music, async? MUSIC_BUFFER_TIME : 0.0f);
+        }
+
+        if (IsKeyPressed(KEY_S)) stalls = !stalls;
+
+        // Seek music 10 seconds backward/forward
+        if (IsKeyPressed(KEY_LEFT)) SeekMusicStream(music, (GetMusicTimePlayed(music) > 10.0f)? GetMusicTimePlayed(music) - 10.0f : 0.0f);
+        if (IsKeyPressed(KEY_RIGHT)) SeekMusicStream(music, GetMusicTimePlayed(music) + 10.0f);
+
+        // Simulate a long frame every second
+        framesCounter++;
+        if (stalls && ((framesCounter%60) == 0)) WaitTime(0.25);
+
+        MusicStreamStats stats = GetMusicStreamStats(music);
+
+        // Get normalized time played for current music stream
+        timePlayed = GetMusicTimePlayed(music)/GetMusicTimeLength(music);
+
+        if (timePlayed > 1.0f) timePlayed = 1.0f;   // Make sure time played is no longer than music
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawRectangle(200, 250, 400, 12, LIGHTGRAY);
+            DrawRectangle(200, 250, (int)(timePlayed*400.0f), 12, MAROON);
+            DrawRectangleLines(200, 250, 400, 12, GRAY);
+
+            // Draw music decoded ahead of playback
+            DrawRectangle(200, 280, (int)(stats.bufferFill*400.0f), 6, DARKGREEN);
+            DrawRectangleLines(200, 280, 400, 6, GRAY);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Long frames: %s", stalls? "250 ms every second" : "NONE"), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Decoding: %.2f ms per second of music", stats.decodeTime), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Buffered: %.2f s (%i underruns)", stats.bufferTime, stats.underruns), 20, 60, 10, BLACK);
+            DrawText(async? "BACKGROUND THREAD" : "UpdateMusicStream()", 20, 80, 20, MAROON);
+            DrawText("SPACE: switch decoding | S: long frames | LEFT/RIGHT: seek", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMusicStream(music);       // Unload music stream buffers from RAM (and decoding buffer)
+
+    CloseAudioDevice();             // Close audio device (music streaming is automatically stopped)
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
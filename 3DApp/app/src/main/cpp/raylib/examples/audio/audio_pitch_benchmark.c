@@ -0,0 +1,151 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - pitch benchmark (mixing cost per voice)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Many sound aliases are played at once, not pitched or pitched [SetSoundPitch()].
+*         Sounds are converted to device format and sample rate on loading, not pitched voices
+*         are mixed without any conversion, pitched voices are resampled by mixer with cubic
+*         interpolation. Mixing time per device period [GetAudioVoiceStats()] is averaged
+*         over frames and divided by voices mixed
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_VOICES      32      // Maximum sound aliases played at once (default voice limit)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - pitch benchmark");
+
+    InitAudioDevice();      // Initialize audio device
+
+    Sound sound = LoadSound("resources/sound.wav");     // Source sound, owns the sample data
+    Sound voices[MAX_VOICES] = { 0 };
+    for (int i = 0; i < MAX_VOICES; i++) voices[i] = LoadSoundAlias(sound);
+
+    const int voiceCounts[3] = { 8, 16, 32 };
+    int countIndex = 2;
+
+    bool pitched = false;
+
+    float mixTime = 0.0f;               // Mixing time accumulated over measured frames
+    int mixedVoices = 0;                // Voices mixed accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average mixing time per device period (ms)
+    float voiceTime = 0.0f;             // Average mixing time per voice (us)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            pitched = !pitched;
+
+            // Pitched voices are spread over one octave, every voice resampled at a different rate
+            for (int i = 0; i < MAX_VOICES; i++) SetSoundPitch(voices[i], pitched? (0.75f + (float)i/MAX_VOICES) : 1.0f);
+
+            mixTime = 0.0f;
+            mixedVoices = 0;
+            measuredFrames = 0;
+        }
+
+        if (IsKeyPressed(KEY_UP) && (countIndex < 2)) { countIndex++; mixTime = 0.0f; mixedVoices = 0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0))
+        {
+            // Stop voices not used anymore
+            for (int i = voiceCounts[countIndex - 1]; i < voiceCounts[countIndex]; i++) StopSound(voices[i]);
+
+            countIndex--;
+            mixTime = 0.0f;
+            mixedVoices = 0;
+            measuredFrames = 0;
+        }
+
+        int voiceCount = voiceCounts[countIndex];
+
+        // Restart ended voices
+        for (int i = 0; i < voiceCount; i++)
+        {
+            if (!IsSoundPlaying(voices[i])) PlaySound(voices[i]);
+        }
+
+        AudioVoiceStats stats = GetAudioVoiceStats();
+
+        mixTime += stats.mixTime;
+        mixedVoices += stats.mixed;
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = mixTime/measuredFrames;
+            voiceTime = (mixedVoices > 0)? mixTime*1000.0f/mixedVoices : 0.0f;
+            mixTime = 0.0f;
+            mixedVoices = 0;
+            measuredFrames = 0;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw voices pitch (bar height) and playing state
+            for (int i = 0; i < voiceCount; i++)
+            {
+                float pitch = pitched? (0.75f + (float)i/MAX_VOICES) : 1.0f;
+                int height = (int)(pitch*100.0f);
+
+                DrawRectangle(20 + i*24, 420 - height, 20, height, IsSoundPlaying(voices[i])? MAROON : LIGHTGRAY);
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Voices: %i (%i mixed)", voiceCount, stats.mixed), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Mixing: %.3f ms/period", averageTime), 20, 40, 10, BLACK);
+            DrawText(pitched? "Pitched: resampled on mixing (cubic)" : "Not pitched: no conversion on mixing", 20, 60, 10, BLACK);
+            DrawText(TextFormat("Per voice: %.2f us/period", voiceTime), 20, 80, 20, MAROON);
+            DrawText("SPACE: switch pitched | UP/DOWN: voices", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_VOICES; i++) UnloadSoundAlias(voices[i]);   // Unload sound aliases
+    UnloadSound(sound);             // Unload source sound data
+
+    CloseAudioDevice();             // Close audio device
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
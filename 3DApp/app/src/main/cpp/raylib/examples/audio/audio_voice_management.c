@@ -0,0 +1,126 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - voice management (priority, virtualization and voice limit)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Hundreds of one-shot effects are triggered with random volume, only up to voice limit
+*         are mixed [SetAudioVoiceLimit()], quiet and exceeding voices are virtualized (playback
+*         advances without mixing). A higher priority sound [SetSoundPriority()] is played every
+*         two seconds, it steals the voice of the quietest lowest priority effect
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_EFFECTS         256     // Maximum one-shot effects played at once (sound aliases)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [audio] example - voice management");
+
+    InitAudioDevice();      // Initialize audio device
+
+    Sound coin = LoadSound("resources/coin.wav");       // One-shot effect source sound
+    Sound effects[MAX_EFFECTS] = { 0 };
+    for (int i = 0; i < MAX_EFFECTS; i++) effects[i] = LoadSoundAlias(coin);
+
+    Sound alarm = LoadSound("resources/spring.wav");    // Higher priority sound
+    SetSoundPriority(alarm, 10);
+
+    int voiceLimit = 32;
+    SetAudioVoiceLimit(voiceLimit);
+
+    int effectsPerFrame = 8;            // One-shot effects triggered every frame
+    int nextEffect = 0;
+    float alarmTimer = 0.0f;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_UP) && (voiceLimit < 32)) { voiceLimit *= 2; SetAudioVoiceLimit(voiceLimit); }
+        if (IsKeyPressed(KEY_DOWN) && (voiceLimit > 4)) { voiceLimit /= 2; SetAudioVoiceLimit(voiceLimit); }
+        if (IsKeyPressed(KEY_RIGHT) && (effectsPerFrame < 32)) effectsPerFrame *= 2;
+        if (IsKeyPressed(KEY_LEFT) && (effectsPerFrame > 1)) effectsPerFrame /= 2;
+
+        // Trigger one-shot effects, the oldest effect voice is restarted
+        for (int i = 0; i < effectsPerFrame; i++)
+        {
+            SetSoundVolume(effects[nextEffect], (float)GetRandomValue(1, 100)/100.0f);
+            SetSoundPan(effects[nextEffect], (float)GetRandomValue(0, 100)/100.0f);
+            PlaySound(effects[nextEffect]);
+
+            nextEffect = (nextEffect + 1)%MAX_EFFECTS;
+        }
+
+        alarmTimer += GetFrameTime();
+        if (alarmTimer > 2.0f)
+        {
+            PlaySound(alarm);
+            alarmTimer = 0.0f;
+        }
+
+        AudioVoiceStats stats = GetAudioVoiceStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw voices: mixed (maroon) and virtualized (light gray)
+            for (int i = 0; i < stats.playing; i++)
+            {
+                DrawRectangle(20 + (i%64)*12, 170 + (i/64)*12, 10, 10, (i < stats.mixed)? MAROON : LIGHTGRAY);
+            }
+
+            if (IsSoundPlaying(alarm)) DrawText("HIGH PRIORITY SOUND PLAYING", 20, 400, 20, DARKBLUE);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Voices: %i playing, %i mixed (limit %i)", stats.playing, stats.mixed, voiceLimit), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Virtualized: %i (stolen by priority: %i)", stats.virtualized, stats.stolen), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Effects triggered: %i per frame", effectsPerFrame), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Mixing: %.3f ms/period", stats.mixTime), 20, 80, 20, MAROON);
+            DrawText("UP/DOWN: voice limit | LEFT/RIGHT: effects per frame", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_EFFECTS; i++) UnloadSoundAlias(effects[i]);     // Unload sound aliases
+    UnloadSound(coin);              // Unload source sound data
+    UnloadSound(alarm);
+
+    CloseAudioDevice();             // Close audio device
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - animation clips blending
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Animations are converted to compressed clips [LoadAnimationClip()], baked animation
+*         data is unloaded after conversion. A locomotion blend (idle -> walk -> run) is driven
+*         by the character speed, clips are sampled at any time and blended with weights
+*         [UpdateModelAnimationClips()]. Memory per clip and sampling cost are reported
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define SAMPLES_PER_FRAME   100     // Clip samplings measured per frame, to get a stable timing
+
+// Locomotion clips, from robot.glb animations
+typedef enum {
+    CLIP_IDLE = 0,
+    CLIP_WALK,
+    CLIP_RUN
+} LocomotionClip;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - animation clips blending");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 6.0f, 6.0f, 6.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 2.0f, 0.0f };      // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };          // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;             // Camera projection type
+
+    Model model = LoadModel("resources/models/gltf/robot.glb");
+    Vector3 position = { 0.0f, 0.0f, 0.0f };
+
+    // Load animations and convert the locomotion ones into compressed clips
+    int animsCount = 0;
+    ModelAnimation *anims = LoadModelAnimations("resources/models/gltf/robot.glb", &animsCount);
+
+    const char *clipNames[3] = { "Robot_Idle", "Robot_Walking", "Robot_Running" };
+    const int animIndex[3] = { 2, 10, 6 };
+    AnimationClip clips[3] = { 0 };
+    int bakedSize[3] = { 0 };           // Baked animation data size (bytes)
+    int clipSize[3] = { 0 };            // Compressed clip data size (bytes)
+
+    for (int i = 0; i < 3; i++)
+    {
+        ModelAnimation anim = anims[animIndex[i]];
+
+        // NOTE: glTF animations are baked at ~60 frames per second
+        clips[i] = LoadAnimationClip(anim, 60.0f);
+
+        bakedSize[i] = anim.frameCount*anim.boneCount*sizeof(Transform);
+        clipSize[i] = clips[i].keyCount*(sizeof(unsigned short)*5) + clips[i].boneCount*3*(sizeof(int) + sizeof(float)*8);
+    }
+
+    // Baked animations data not required anymore
+    UnloadModelAnimations(anims, animsCount);
+
+    Transform *pose = (Transform *)MemAlloc(model.boneCount*sizeof(Transform));
+
+    float speed = 0.0f;                 // Character speed: 0.0 (idle) to 2.0 (run)
+    float time = 0.0f;
+    float weights[3] = { 0 };
+    float times[3] = { 0 };
+
+    double sampleTime = 0.0;            // Sampling time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average sampling time per bone (ns)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyDown(KEY_UP)) speed += 0.02f;
+        if (IsKeyDown(KEY_DOWN)) speed -= 0.02f;
+        if (speed < 0.0f) speed = 0.0f;
+        if (speed > 2.0f) speed = 2.0f;
+
+        time += GetFrameTime();
+
+        // Locomotion blend: idle -> walk for speed [0..1], walk -> run for speed [1..2]
+        weights[CLIP_IDLE] = (speed < 1.0f)? 1.0f - speed : 0.0f;
+        weights[CLIP_WALK] = (speed < 1.0f)? speed : 2.0f - speed;
+        weights[CLIP_RUN] = (speed > 1.0f)? speed - 1.0f : 0.0f;
+
+        // Walk and run clips share the same length, they are played in sync
+        for (int i = 0; i < 3; i++) times[i] = time;
+
+        UpdateModelAnimationClips(model, clips, times, weights, 3);
+
+        // Measure single clip sampling cost
+        double startTime = GetTime();
+        for (int i = 0; i < SAMPLES_PER_FRAME; i++) SampleAnimationClip(clips[CLIP_RUN], time + i*0.01f, pose);
+        sampleTime += (GetTime() - startTime);
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = (float)(sampleTime*1000000000.0/(measuredFrames*SAMPLES_PER_FRAME*model.boneCount));
+            sampleTime = 0.0;
+            measuredFrames = 0;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawModel(model, position, 1.0f, WHITE);
+                DrawGrid(10, 1.0f);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 400, 150, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 400, 150, BLUE);
+            DrawText(TextFormat("Speed: %.2f (UP/DOWN)", speed), 20, 20, 10, BLACK);
+
+            for (int i = 0; i < 3; i++)
+            {
+                DrawText(TextFormat("%s: weight %.2f, %i keys, %i KB (baked: %i KB)", clipNames[i], weights[i],
+                    clips[i].keyCount, clipSize[i]/1024, bakedSize[i]/1024), 20, 40 + i*20, 10, BLACK);
+            }
+
+            DrawText(TextFormat("Clip sampling: %.1f ns/bone", averageTime), 20, 110, 20, MAROON);
+            DrawText(TextFormat("%i bones", model.boneCount), 20, 135, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    MemFree(pose);
+    for (int i = 0; i < 3; i++) UnloadAnimationClip(clips[i]);
+    UnloadModel(model);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,283 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - bones update benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Compares the per-mesh bones update path (reference implementation below, bind pose
+*         inverted for every bone every frame) with UpdateModelAnimationBones() (precomputed
+*         inverse bind matrices, bones computed once per skeleton and shared by all meshes)
+*         for a procedural rig of 32 to 256 bones, skinned by several meshes
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stddef.h>         // Required for: NULL
+
+#define MAX_BONES           256
+#define MAX_MESHES            8
+#define ANIM_FRAMES         120
+#define UPDATES_PER_FRAME   100     // Bones updates measured per frame, to get a stable timing
+#define BONE_LENGTH        0.05f
+
+// Reference bones update path: bind pose inverted for every bone of every mesh
+static void UpdateModelAnimationBonesReference(Model model, ModelAnimation anim, int frame);
+
+static Model LoadRigModel(int boneCount, int meshCount);        // Load a bones chain model (no vertex data)
+static ModelAnimation LoadRigAnimation(Model model);            // Load a wave animation for bones chain model
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - bones update benchmark");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 0.0f, 8.0f, 24.0f };     // Camera position
+    camera.target = (Vector3){ 0.0f, 6.0f, 0.0f };        // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };            // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                  // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;               // Camera projection type
+
+    int boneCount = 128;
+    int meshCount = 4;
+
+    Model model = LoadRigModel(boneCount, meshCount);
+    ModelAnimation anim = LoadRigAnimation(model);
+
+    bool useReference = false;
+    unsigned int animFrame = 0;
+
+    double updateTime = 0.0;            // Bones update time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average bones update time (us)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        int newBoneCount = boneCount;
+        int newMeshCount = meshCount;
+
+        if (IsKeyPressed(KEY_SPACE)) { useReference = !useReference; updateTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_UP) && (boneCount < MAX_BONES)) newBoneCount += 32;
+        if (IsKeyPressed(KEY_DOWN) && (boneCount > 32)) newBoneCount -= 32;
+        if (IsKeyPressed(KEY_RIGHT) && (meshCount < MAX_MESHES)) newMeshCount++;
+        if (IsKeyPressed(KEY_LEFT) && (meshCount > 1)) newMeshCount--;
+
+        if ((newBoneCount != boneCount) || (newMeshCount != meshCount))
+        {
+            UnloadModelAnimation(anim);
+            UnloadModel(model);
+
+            boneCount = newBoneCount;
+            meshCount = newMeshCount;
+            model = LoadRigModel(boneCount, meshCount);
+            anim = LoadRigAnimation(model);
+
+            updateTime = 0.0;
+            measuredFrames = 0;
+        }
+
+        animFrame = (animFrame + 1)%anim.frameCount;
+
+        double startTime = GetTime();
+        for (int i = 0; i < UPDATES_PER_FRAME; i++)
+        {
+            if (useReference) UpdateModelAnimationBonesReference(model, anim, animFrame);
+            else UpdateModelAnimationBones(model, anim, animFrame);
+        }
+        updateTime += (GetTime() - startTime);
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = (float)(updateTime*1000000.0/(measuredFrames*UPDATES_PER_FRAME));
+            updateTime = 0.0;
+            measuredFrames = 0;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                // Draw skeleton, bind pose joints transformed by first mesh bones matrices
+                Matrix *boneMatrices = model.meshes[0].boneMatrices;
+
+                for (int i = 0; i < model.boneCount; i++)
+                {
+                    Vector3 joint = Vector3Transform(model.bindPose[i].translation, boneMatrices[i]);
+
+                    if (model.bones[i].parent >= 0)
+                    {
+                        int parent = model.bones[i].parent;
+                        Vector3 parentJoint = Vector3Transform(model.bindPose[parent].translation, boneMatrices[parent]);
+                        DrawLine3D(parentJoint, joint, MAROON);
+                    }
+
+                    if ((i%8) == 0) DrawSphere(joint, 0.1f, RED);
+                }
+
+                DrawGrid(20, 1.0f);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 380, 110, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 380, 110, BLUE);
+            DrawText(TextFormat("Rig: %i bones, %i meshes sharing skeleton", boneCount, meshCount), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Bones update path: %s", useReference? "REFERENCE (per mesh)" : "UpdateModelAnimationBones()"), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Bones update time: %.2f us", averageTime), 20, 60, 20, MAROON);
+            DrawText("SPACE: switch path | UP/DOWN: bones", 20, 90, 10, DARKGRAY);
+            DrawText("LEFT/RIGHT: meshes", 20, 105, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadModelAnimation(anim);
+    UnloadModel(model);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+// Reference bones update path: bind pose inverted for every bone of every mesh
+static void UpdateModelAnimationBonesReference(Model model, ModelAnimation anim, int frame)
+{
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices == NULL) continue;
+
+        for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
+        {
+            Vector3 inTranslation = model.bindPose[boneId].translation;
+            Quaternion inRotation = model.bindPose[boneId].rotation;
+            Vector3 inScale = model.bindPose[boneId].scale;
+
+            Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
+            Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
+            Vector3 outScale = anim.framePoses[frame][boneId].scale;
+
+            Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
+            Quaternion invRotation = QuaternionInvert(inRotation);
+            Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+            Vector3 boneTranslation = Vector3Add(Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation), outRotation), outTranslation);
+            Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
+            Vector3 boneScale = Vector3Multiply(outScale, invScale);
+
+            model.meshes[i].boneMatrices[boneId] = MatrixMultiply(MatrixMultiply(
+                QuaternionToMatrix(boneRotation),
+                MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+                MatrixScale(boneScale.x, boneScale.y, boneScale.z));
+        }
+    }
+}
+
+// Load a bones chain model (no vertex data)
+// NOTE: Only bones data is generated, meshes just keep their bones matrices
+static Model LoadRigModel(int boneCount, int meshCount)
+{
+    Model model = { 0 };
+    model.transform = MatrixIdentity();
+
+    model.boneCount = boneCount;
+    model.bones = (BoneInfo *)MemAlloc(boneCount*sizeof(BoneInfo));
+    model.bindPose = (Transform *)MemAlloc(boneCount*sizeof(Transform));
+    model.bindPoseInverse = (Matrix *)MemAlloc(boneCount*sizeof(Matrix));
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        model.bones[i].parent = i - 1;
+        model.bindPose[i].translation = (Vector3){ 0.0f, i*BONE_LENGTH, 0.0f };
+        model.bindPose[i].rotation = QuaternionIdentity();
+        model.bindPose[i].scale = (Vector3){ 1.0f, 1.0f, 1.0f };
+
+        // Inverse bind matrices are precomputed by model loaders, generated models must provide them
+        model.bindPoseInverse[i] = MatrixTranslate(0.0f, -i*BONE_LENGTH, 0.0f);
+    }
+
+    model.meshCount = meshCount;
+    model.meshes = (Mesh *)MemAlloc(meshCount*sizeof(Mesh));
+
+    for (int i = 0; i < meshCount; i++)
+    {
+        model.meshes[i].boneCount = boneCount;
+        model.meshes[i].boneMatrices = (Matrix *)MemAlloc(boneCount*sizeof(Matrix));
+        for (int j = 0; j < boneCount; j++) model.meshes[i].boneMatrices[j] = MatrixIdentity();
+    }
+
+    return model;
+}
+
+// Load a wave animation for bones chain model
+// NOTE: Frame poses are defined in model space, every bone bends relative to its parent
+static ModelAnimation LoadRigAnimation(Model model)
+{
+    ModelAnimation anim = { 0 };
+    anim.boneCount = model.boneCount;
+    anim.frameCount = ANIM_FRAMES;
+    anim.bones = (BoneInfo *)MemAlloc(model.boneCount*sizeof(BoneInfo));
+    anim.framePoses = (Transform **)MemAlloc(ANIM_FRAMES*sizeof(Transform *));
+
+    for (int i = 0; i < model.boneCount; i++) anim.bones[i] = model.bones[i];
+
+    for (int frame = 0; frame < ANIM_FRAMES; frame++)
+    {
+        anim.framePoses[frame] = (Transform *)MemAlloc(model.boneCount*sizeof(Transform));
+        Transform *pose = anim.framePoses[frame];
+
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            float angle = sinf(2.0f*PI*frame/ANIM_FRAMES + i*0.1f)*0.04f;
+            Quaternion localRotation = QuaternionFromAxisAngle((Vector3){ 0.0f, 0.0f, 1.0f }, angle);
+
+            if (i == 0)
+            {
+                pose[i].translation = (Vector3){ 0.0f, 0.0f, 0.0f };
+                pose[i].rotation = localRotation;
+            }
+            else
+            {
+                pose[i].rotation = QuaternionMultiply(pose[i - 1].rotation, localRotation);
+                pose[i].translation = Vector3Add(pose[i - 1].translation, Vector3RotateByQuaternion((Vector3){ 0.0f, BONE_LENGTH, 0.0f }, pose[i - 1].rotation));
+            }
+
+            pose[i].scale = (Vector3){ 1.0f, 1.0f, 1.0f };
+        }
+    }
+
+    return anim;
+}
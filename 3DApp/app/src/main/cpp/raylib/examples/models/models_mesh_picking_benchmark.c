@@ -0,0 +1,172 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - mesh picking benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Compares ray picking against a high-poly heightmap and a cubicmap with and without
+*         mesh BVH [GenMeshBVH()], random rays are cast every frame for a fixed time budget
+*         and queries per second are reported, mouse ray hit is drawn on the selected mesh
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+
+#include <stdlib.h>         // Required for: rand()
+
+#define QUERY_TIME_BUDGET   0.004   // Picking queries time budget per frame (seconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh picking benchmark");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 24.0f, 20.0f, 24.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };          // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };              // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                    // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                 // Camera projection type
+
+    // Generate test meshes: high-poly heightmap (~200k triangles) and cubicmap
+    const char *meshNames[2] = { "Heightmap (perlin noise 320x320)", "Cubicmap (cubicmap.png)" };
+    Mesh meshes[2] = { 0 };
+
+    Image heightmap = GenImagePerlinNoise(320, 320, 0, 0, 4.0f);
+    meshes[0] = GenMeshHeightmap(heightmap, (Vector3){ 32.0f, 6.0f, 32.0f });
+    UnloadImage(heightmap);
+
+    Image cubicmap = LoadImage("resources/cubicmap.png");
+    meshes[1] = GenMeshCubicmap(cubicmap, (Vector3){ 1.0f, 1.0f, 1.0f });
+    UnloadImage(cubicmap);
+
+    // Meshes placed centered on grid
+    Matrix transforms[2] = { MatrixTranslate(-16.0f, 0.0f, -16.0f), MatrixTranslate(-16.0f, 0.0f, -8.0f) };
+    Material material = LoadMaterialDefault();
+
+    // Compute meshes BVH, timing reported
+    double buildTime[2] = { 0 };
+    for (int i = 0; i < 2; i++)
+    {
+        double startTime = GetTime();
+        GenMeshBVH(&meshes[i]);
+        buildTime[i] = GetTime() - startTime;
+    }
+
+    int meshIndex = 0;
+    bool useBVH = true;
+
+    int queryCount = 0;                 // Queries accumulated over measured frames
+    double queryTime = 0.0;             // Queries time accumulated over measured frames
+    int measuredFrames = 0;
+    float queriesPerSecond = 0.0f;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { useBVH = !useBVH; queryCount = 0; queryTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_M)) { meshIndex = (meshIndex + 1)%2; queryCount = 0; queryTime = 0.0; measuredFrames = 0; }
+
+        // NOTE: Mesh copy without BVH, all triangles are tested
+        Mesh mesh = meshes[meshIndex];
+        if (!useBVH) mesh.bvh = NULL;
+
+        // Cast random rays from camera into the mesh area for the frame time budget
+        double startTime = GetTime();
+        double elapsedTime = 0.0;
+
+        while (elapsedTime < QUERY_TIME_BUDGET)
+        {
+            Vector3 target = { (float)(rand()%3200)/100.0f - 16.0f, 0.0f, (float)(rand()%3200)/100.0f - 16.0f };
+            Ray ray = { camera.position, Vector3Normalize(Vector3Subtract(target, camera.position)) };
+
+            GetRayCollisionMesh(ray, mesh, transforms[meshIndex]);
+
+            queryCount++;
+            elapsedTime = GetTime() - startTime;
+        }
+
+        queryTime += elapsedTime;
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            queriesPerSecond = (float)(queryCount/queryTime);
+            queryCount = 0;
+            queryTime = 0.0;
+            measuredFrames = 0;
+        }
+
+        // Mouse picking
+        Ray mouseRay = GetScreenToWorldRay(GetMousePosition(), camera);
+        RayCollision collision = GetRayCollisionMesh(mouseRay, mesh, transforms[meshIndex]);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawMesh(mesh, material, transforms[meshIndex]);
+
+                if (collision.hit)
+                {
+                    DrawSphere(collision.point, 0.2f, RED);
+                    DrawLine3D(collision.point, Vector3Add(collision.point, collision.normal), MAROON);
+                }
+
+                DrawGrid(32, 1.0f);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Mesh: %s", meshNames[meshIndex]), 20, 20, 10, BLACK);
+            DrawText(TextFormat("%i triangles, BVH: %i nodes (built in %.1f ms)", meshes[meshIndex].triangleCount,
+                meshes[meshIndex].bvh->nodeCount, buildTime[meshIndex]*1000.0), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Picking path: %s", useBVH? "mesh BVH" : "all triangles"), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Queries: %.0f/s", queriesPerSecond), 20, 80, 20, MAROON);
+            DrawText(TextFormat("Mouse hit distance: %.2f", collision.hit? collision.distance : 0.0f), 20, 105, 10, BLACK);
+            DrawText("SPACE: switch path | M: switch mesh", 20, 120, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMaterial(material);
+    for (int i = 0; i < 2; i++) UnloadMesh(meshes[i]);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
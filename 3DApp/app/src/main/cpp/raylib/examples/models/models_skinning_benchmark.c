@@ -0,0 +1,230 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - skinning benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Compares the per-vertex scalar skinning path (reference implementation below)
+*         with UpdateModelAnimation() (SIMD kernel, vertex ranges split on worker threads)
+*         and GPU skinning [SetModelGpuSkinning()], where only bone matrices are computed
+*         on CPU and vertex data is never re-uploaded, skinning time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"
+#include "rlgl.h"           // Required for: rlUpdateVertexBuffer()
+
+#include <stddef.h>         // Required for: NULL
+
+#define MAX_CROWD_SIZE      64
+
+typedef enum {
+    SKINNING_REFERENCE = 0,     // Scalar CPU skinning, reference implementation
+    SKINNING_CPU,               // UpdateModelAnimation(), SIMD and worker threads
+    SKINNING_GPU                // UpdateModelAnimationBones() + default GPU skinning shader
+} SkinningPath;
+
+// Reference scalar skinning path: bones transformed one by one for every vertex
+static void UpdateModelAnimationReference(Model model, ModelAnimation anim, int frame);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - skinning benchmark");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 18.0f, 14.0f, 18.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 2.0f, 0.0f };          // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };              // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                    // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                 // Camera projection type
+
+    // Load sample animated models: IQM and glTF
+    const char *modelNames[2] = { "IQM (guy.iqm)", "glTF (greenman.glb)" };
+    Model models[2] = { 0 };
+    models[0] = LoadModel("resources/models/iqm/guy.iqm");
+    models[1] = LoadModel("resources/models/gltf/greenman.glb");
+
+    int animsCount[2] = { 0 };
+    ModelAnimation *anims[2] = { 0 };
+    anims[0] = LoadModelAnimations("resources/models/iqm/guyanim.iqm", &animsCount[0]);
+    anims[1] = LoadModelAnimations("resources/models/gltf/greenman.glb", &animsCount[1]);
+
+    const char *pathNames[3] = { "REFERENCE (scalar CPU)", "UpdateModelAnimation() (CPU)", "SetModelGpuSkinning() (GPU)" };
+    int modelIndex = 0;
+    int crowdSize = 30;
+    int skinningPath = SKINNING_CPU;
+    unsigned int animFrame = 0;
+
+    double skinningTime = 0.0;          // Skinning time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average skinning time per frame (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            skinningPath = (skinningPath + 1)%3;
+            skinningTime = 0.0;
+            measuredFrames = 0;
+
+            // Vertex data is kept static in GPU memory on GPU skinning
+            for (int i = 0; i < 2; i++) SetModelGpuSkinning(&models[i], (skinningPath == SKINNING_GPU));
+        }
+        if (IsKeyPressed(KEY_M)) { modelIndex = (modelIndex + 1)%2; skinningTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_UP) && (crowdSize < MAX_CROWD_SIZE)) { crowdSize++; skinningTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (crowdSize > 1)) { crowdSize--; skinningTime = 0.0; measuredFrames = 0; }
+
+        Model model = models[modelIndex];
+        ModelAnimation anim = anims[modelIndex][0];
+        animFrame = (animFrame + 1)%anim.frameCount;
+
+        // Every crowd character is skinned once per frame, all of them share the same model data
+        double startTime = GetTime();
+        for (int i = 0; i < crowdSize; i++)
+        {
+            if (skinningPath == SKINNING_REFERENCE) UpdateModelAnimationReference(model, anim, animFrame + i);
+            else if (skinningPath == SKINNING_CPU) UpdateModelAnimation(model, anim, animFrame + i);
+            else UpdateModelAnimationBones(model, anim, animFrame + i);
+        }
+        skinningTime += (GetTime() - startTime);
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = (float)(skinningTime*1000.0/measuredFrames);
+            skinningTime = 0.0;
+            measuredFrames = 0;
+        }
+
+        // Vertex data uploaded to GPU per frame (positions and normals)
+        int uploadSize = 0;
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            if (model.meshes[m].animVertices != NULL) uploadSize += model.meshes[m].vertexCount*3*sizeof(float);
+            if (model.meshes[m].animNormals != NULL) uploadSize += model.meshes[m].vertexCount*3*sizeof(float);
+        }
+        uploadSize *= crowdSize;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                for (int i = 0; i < crowdSize; i++)
+                {
+                    Vector3 position = { (float)(i%8)*2.5f - 9.0f, 0.0f, (float)(i/8)*2.5f - 9.0f };
+
+                    if (modelIndex == 0) DrawModelEx(model, position, (Vector3){ 1.0f, 0.0f, 0.0f }, -90.0f, (Vector3){ 0.5f, 0.5f, 0.5f }, WHITE);
+                    else DrawModel(model, position, 1.0f, WHITE);
+                }
+
+                DrawGrid(20, 1.0f);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Model: %s", modelNames[modelIndex]), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Crowd size: %i characters", crowdSize), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Skinning path: %s", pathNames[skinningPath]), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Vertex uploads: %i KB/frame", uploadSize/1024), 20, 80, 10, BLACK);
+            DrawText(TextFormat("Skinning time: %.3f ms/frame", averageTime), 20, 100, 20, MAROON);
+            DrawText("SPACE: switch path | M: switch model | UP/DOWN: crowd size", 20, 125, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < 2; i++)
+    {
+        UnloadModelAnimations(anims[i], animsCount[i]);
+        UnloadModel(models[i]);
+    }
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+// Reference scalar skinning path: bones transformed one by one for every vertex
+static void UpdateModelAnimationReference(Model model, ModelAnimation anim, int frame)
+{
+    UpdateModelAnimationBones(model, anim, frame);
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+
+        if ((mesh.boneMatrices == NULL) || (mesh.animVertices == NULL)) continue;
+
+        for (int v = 0, boneCounter = 0; v < mesh.vertexCount*3; v += 3)
+        {
+            Vector3 animVertex = { 0 };
+            Vector3 animNormal = { 0 };
+
+            for (int j = 0; j < 4; j++, boneCounter++)
+            {
+                float boneWeight = mesh.boneWeights[boneCounter];
+                int boneId = mesh.boneIds[boneCounter];
+
+                if (boneWeight == 0.0f) continue;
+
+                Vector3 vertex = Vector3Transform((Vector3){ mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2] }, mesh.boneMatrices[boneId]);
+                animVertex = Vector3Add(animVertex, Vector3Scale(vertex, boneWeight));
+
+                if (mesh.animNormals != NULL)
+                {
+                    Vector3 normal = Vector3Transform((Vector3){ mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2] }, mesh.boneMatrices[boneId]);
+                    animNormal = Vector3Add(animNormal, Vector3Scale(normal, boneWeight));
+                }
+            }
+
+            mesh.animVertices[v] = animVertex.x;
+            mesh.animVertices[v + 1] = animVertex.y;
+            mesh.animVertices[v + 2] = animVertex.z;
+
+            if (mesh.animNormals != NULL)
+            {
+                mesh.animNormals[v] = animNormal.x;
+                mesh.animNormals[v + 1] = animNormal.y;
+                mesh.animNormals[v + 2] = animNormal.z;
+            }
+        }
+
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);
+        if (mesh.animNormals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);
+    }
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - render batch upload benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Compares render batch vertex data upload modes [rlSetRenderBatchUploadMode()]:
+*         in place updates, buffers orphaning and persistent mapping (if supported), drawing
+*         10k to 100k quads per frame on a multi-buffered custom batch, batch flushes, draw calls
+*         and uploaded data are reported by rlGetRenderStats(), drawing time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlLoadRenderBatch(), rlSetRenderBatchUploadMode(), rlGetRenderStats()
+
+#include <stddef.h>         // Required for: NULL
+
+#define BATCH_BUFFERS           3       // Custom render batch buffers (multi-buffering)
+#define BATCH_BUFFER_ELEMENTS   8192    // Custom render batch elements (quads) per buffer
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - render batch upload benchmark");
+
+    const char *modeNames[3] = { "SUBDATA (in place updates)", "ORPHAN (buffers orphaning)", "PERSISTENT (mapped buffers)" };
+    const int quadCounts[4] = { 10000, 25000, 50000, 100000 };
+    int countIndex = 1;
+    int uploadMode = RL_BATCH_UPLOAD_ORPHAN;
+
+    // Custom render batch, upload mode set on batch loading
+    rlSetRenderBatchUploadMode(uploadMode);
+    rlRenderBatch batch = rlLoadRenderBatch(BATCH_BUFFERS, BATCH_BUFFER_ELEMENTS);
+
+    double drawTime = 0.0;              // Quads drawing time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average quads drawing time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            uploadMode = (uploadMode + 1)%3;
+
+            // Batch reloaded with new upload mode, persistent mapping falls back to orphaning if not supported
+            rlUnloadRenderBatch(batch);
+            rlSetRenderBatchUploadMode(uploadMode);
+            batch = rlLoadRenderBatch(BATCH_BUFFERS, BATCH_BUFFER_ELEMENTS);
+
+            drawTime = 0.0;
+            measuredFrames = 0;
+        }
+        if (IsKeyPressed(KEY_UP) && (countIndex < 3)) { countIndex++; drawTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0)) { countIndex--; drawTime = 0.0; measuredFrames = 0; }
+
+        int quadCount = quadCounts[countIndex];
+        float time = (float)GetTime();
+
+        // Render stats of previous frame
+        rlRenderStats stats = rlGetRenderStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw quads into custom batch, flushed when full and when switching back to default batch
+            double startTime = GetTime();
+
+            rlSetRenderBatchActive(&batch);
+
+            for (int i = 0; i < quadCount; i++)
+            {
+                int x = (i*37)%screenWidth;
+                int y = (i*13 + (int)(time*60.0f))%screenHeight;
+
+                DrawRectangle(x, y, 6, 6, (Color){ (unsigned char)(i*7), (unsigned char)(i*3), 200, 255 });
+            }
+
+            rlSetRenderBatchActive(NULL);
+
+            drawTime += (GetTime() - startTime);
+            measuredFrames++;
+
+            if (measuredFrames == 30)
+            {
+                averageTime = (float)(drawTime*1000.0/measuredFrames);
+                drawTime = 0.0;
+                measuredFrames = 0;
+            }
+
+            DrawRectangle(10, 10, 380, 150, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 150, BLUE);
+            DrawText(TextFormat("Quads: %i per frame", quadCount), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Upload mode: %s", modeNames[batch.uploadMode]), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Batch flushes: %i, draw calls: %i", stats.batchFlushes, stats.drawCalls), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Uploaded: %i KB/frame, buffer waits: %i", stats.uploadSize/1024, stats.bufferWaits), 20, 80, 10, BLACK);
+            DrawText(TextFormat("Quads drawing: %.3f ms/frame", averageTime), 20, 100, 20, MAROON);
+            DrawText("SPACE: switch upload mode | UP/DOWN: quads", 20, 135, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    rlUnloadRenderBatch(batch);     // Unload custom render batch
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
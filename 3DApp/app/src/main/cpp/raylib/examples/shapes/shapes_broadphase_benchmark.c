@@ -0,0 +1,227 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - broadphase benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Compares pairwise collision checks (CheckCollisionRecs() for every bodies pair)
+*         with broadphase spatial grid (2d, uniform grid) and spatial tree (3d, dynamic
+*         bounding boxes tree), for 1k to 100k moving bodies, bodies update and overlapping
+*         pairs query time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: rand()
+#include <math.h>           // Required for: sqrtf()
+
+#define MAX_PAIRWISE_BODIES   5000      // Pairwise checks skipped over this bodies count
+#define MAX_DRAWN_BODIES     20000      // Bodies drawn, to keep rendering out of measures
+
+typedef enum {
+    BROADPHASE_PAIRWISE = 0,    // CheckCollisionRecs() for every bodies pair
+    BROADPHASE_GRID,            // Spatial grid (2d)
+    BROADPHASE_TREE             // Spatial tree (3d)
+} BroadphasePath;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - broadphase benchmark");
+
+    const int bodyCounts[7] = { 1000, 2000, 5000, 10000, 20000, 50000, 100000 };
+    const char *pathNames[3] = { "PAIRWISE (CheckCollisionRecs)", "SpatialGrid (2d)", "SpatialTree (3d)" };
+    int countIndex = 0;
+    int bodyCount = bodyCounts[countIndex];
+    int path = BROADPHASE_GRID;
+
+    // Bodies data allocated for max bodies count
+    Rectangle *bodies = (Rectangle *)MemAlloc(100000*sizeof(Rectangle));
+    Vector2 *velocities = (Vector2 *)MemAlloc(100000*sizeof(Vector2));
+    bool *colliding = (bool *)MemAlloc(100000*sizeof(bool));
+    int *gridHandles = (int *)MemAlloc(100000*sizeof(int));
+    int *treeHandles = (int *)MemAlloc(100000*sizeof(int));
+
+    int maxPairs = 100000*4;
+    BodyPair *pairs = (BodyPair *)MemAlloc(maxPairs*sizeof(BodyPair));
+    int pairCount = 0;
+
+    // World size grows with bodies count to keep bodies density
+    float worldSize = 0.0f;
+    SpatialGrid *grid = NULL;
+    SpatialTree *tree = NULL;
+    bool reset = true;
+
+    double updateTime = 0.0;            // Bodies update and pairs query time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average bodies update and pairs query time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { path = (path + 1)%3; updateTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_UP) && (countIndex < 6)) { countIndex++; reset = true; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0)) { countIndex--; reset = true; }
+
+        if (reset)
+        {
+            bodyCount = bodyCounts[countIndex];
+            worldSize = sqrtf((float)bodyCount)*12.0f;
+
+            UnloadSpatialGrid(grid);
+            UnloadSpatialTree(tree);
+
+            // NOTE: Grid cell size similar to bodies size, tree bodies boxes enlarged to skip small moves
+            grid = LoadSpatialGrid(8.0f);
+            tree = LoadSpatialTree(1.0f);
+
+            for (int i = 0; i < bodyCount; i++)
+            {
+                bodies[i] = (Rectangle){ (float)(rand()%(int)worldSize), (float)(rand()%(int)worldSize), (float)(2 + rand()%5), (float)(2 + rand()%5) };
+                velocities[i] = (Vector2){ (float)(rand()%101 - 50)/100.0f, (float)(rand()%101 - 50)/100.0f };
+
+                gridHandles[i] = AddSpatialGridBody(grid, bodies[i]);
+                treeHandles[i] = AddSpatialTreeBody(tree, (BoundingBox){ { bodies[i].x, bodies[i].y, 0.0f },
+                    { bodies[i].x + bodies[i].width, bodies[i].y + bodies[i].height, 1.0f } });
+            }
+
+            updateTime = 0.0;
+            measuredFrames = 0;
+            reset = false;
+        }
+
+        // Move bodies, bouncing on world limits
+        for (int i = 0; i < bodyCount; i++)
+        {
+            bodies[i].x += velocities[i].x;
+            bodies[i].y += velocities[i].y;
+
+            if ((bodies[i].x < 0.0f) || ((bodies[i].x + bodies[i].width) > worldSize)) velocities[i].x *= -1.0f;
+            if ((bodies[i].y < 0.0f) || ((bodies[i].y + bodies[i].height) > worldSize)) velocities[i].y *= -1.0f;
+
+            colliding[i] = false;
+        }
+
+        // Update broadphase bodies and get overlapping pairs
+        double startTime = GetTime();
+
+        if (path == BROADPHASE_PAIRWISE)
+        {
+            pairCount = 0;
+
+            if (bodyCount <= MAX_PAIRWISE_BODIES)
+            {
+                for (int i = 0; i < bodyCount; i++)
+                {
+                    for (int j = i + 1; j < bodyCount; j++)
+                    {
+                        if (CheckCollisionRecs(bodies[i], bodies[j]) && (pairCount < maxPairs)) pairs[pairCount++] = (BodyPair){ i, j };
+                    }
+                }
+            }
+        }
+        else if (path == BROADPHASE_GRID)
+        {
+            for (int i = 0; i < bodyCount; i++) UpdateSpatialGridBody(grid, gridHandles[i], bodies[i]);
+
+            pairCount = GetSpatialGridPairs(grid, pairs, maxPairs);
+        }
+        else
+        {
+            for (int i = 0; i < bodyCount; i++)
+            {
+                UpdateSpatialTreeBody(tree, treeHandles[i], (BoundingBox){ { bodies[i].x, bodies[i].y, 0.0f },
+                    { bodies[i].x + bodies[i].width, bodies[i].y + bodies[i].height, 1.0f } });
+            }
+
+            pairCount = GetSpatialTreePairs(tree, pairs, maxPairs);
+        }
+
+        updateTime += (GetTime() - startTime);
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            averageTime = (float)(updateTime*1000.0/measuredFrames);
+            updateTime = 0.0;
+            measuredFrames = 0;
+        }
+
+        // NOTE: Bodies handles match bodies indices, bodies are never removed
+        for (int i = 0; i < pairCount; i++)
+        {
+            colliding[pairs[i].a] = true;
+            colliding[pairs[i].b] = true;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // World scaled to screen height
+            float scale = (float)screenHeight/worldSize;
+            int drawnCount = (bodyCount < MAX_DRAWN_BODIES)? bodyCount : MAX_DRAWN_BODIES;
+
+            for (int i = 0; i < drawnCount; i++)
+            {
+                DrawRectangleRec((Rectangle){ screenWidth - screenHeight + bodies[i].x*scale, bodies[i].y*scale,
+                    bodies[i].width*scale, bodies[i].height*scale }, colliding[i]? RED : DARKGRAY);
+            }
+
+            DrawRectangle(10, 10, 330, 130, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 330, 130, BLUE);
+            DrawText(TextFormat("Bodies: %i (%i drawn)", bodyCount, drawnCount), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Broadphase: %s", pathNames[path]), 20, 40, 10, BLACK);
+
+            if ((path == BROADPHASE_PAIRWISE) && (bodyCount > MAX_PAIRWISE_BODIES)) DrawText("Pairwise checks skipped", 20, 60, 10, RED);
+            else DrawText(TextFormat("Overlapping pairs: %i", pairCount), 20, 60, 10, BLACK);
+
+            DrawText(TextFormat("Update + pairs: %.3f ms/frame", averageTime), 20, 80, 20, MAROON);
+            DrawText("SPACE: switch broadphase | UP/DOWN: bodies", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, screenHeight - 30);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadSpatialGrid(grid);
+    UnloadSpatialTree(tree);
+
+    MemFree(bodies);
+    MemFree(velocities);
+    MemFree(colliding);
+    MemFree(gridHandles);
+    MemFree(treeHandles);
+    MemFree(pairs);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - cached text labels
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: HUD labels are mostly identical frame to frame, they are drawn with DrawTextEx()
+*         (text decoded and laid out every call) or with DrawTextCached() (text run laid out
+*         once and cached, drawn with a single submission). A static text run [LoadTextRun()]
+*         is also drawn, labels drawing time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlDrawRenderBatchActive()
+
+#define MAX_LABELS      400     // Labels drawn per frame (static text)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - cached text labels");
+
+    Font font = GetFontDefault();
+
+    // Static labels text, a few different strings repeated (cached text runs are shared)
+    const char *labels[8] = { "HEALTH", "AMMO", "SCORE", "LEVEL", "ENEMIES", "TIME", "BONUS", "LIVES" };
+
+    // Static text run, laid out once
+    TextRun title = LoadTextRun(font, "TEXT RUN: laid out once, drawn every frame\nwith a single submission", 20.0f, 2.0f);
+
+    bool useCache = true;
+
+    double drawTime = 0.0;              // Labels drawing time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average labels drawing time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { useCache = !useCache; drawTime = 0.0; measuredFrames = 0; }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            double startTime = GetTime();
+
+            for (int i = 0; i < MAX_LABELS; i++)
+            {
+                Vector2 position = { (float)(10 + (i%10)*78), (float)(180 + (i/10)*6) };
+                Color color = ((i%3) == 0)? MAROON : DARKGRAY;
+
+                if (useCache) DrawTextCached(font, labels[i%8], position, 10.0f, 1.0f, color);
+                else DrawTextEx(font, labels[i%8], position, 10.0f, 1.0f, color);
+            }
+
+            rlDrawRenderBatchActive();
+
+            drawTime += (GetTime() - startTime);
+            measuredFrames++;
+
+            if (measuredFrames == 30)
+            {
+                averageTime = (float)(drawTime*1000.0/measuredFrames);
+                drawTime = 0.0;
+                measuredFrames = 0;
+            }
+
+            DrawTextRun(title, (Vector2){ 400.0f, 110.0f }, DARKBLUE);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Labels: %i per frame", MAX_LABELS), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Drawing: %s", useCache? "DrawTextCached() (text runs cache)" : "DrawTextEx() (laid out every call)"), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Title text run: %i glyphs, %.0fx%.0f", title.glyphCount, title.size.x, title.size.y), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Labels drawing: %.3f ms/frame", averageTime), 20, 80, 20, MAROON);
+            DrawText("SPACE: switch text cache", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextRun(title);           // Unload text run data
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - dynamic font (glyphs rasterized on demand)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: A CJK chat is simulated, new lines with random kanji are added over time. Static font
+*         [LoadFontEx()] bakes all required glyphs on loading, dynamic font [LoadDynamicFont()]
+*         keeps font data resident and rasterizes glyphs on first use into atlas pages, evicting
+*         least recently used page when full. Loading time and atlas memory are reported
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: rand()
+
+#define CJK_GLYPHS_COUNT     6000   // CJK unified ideographs baked by static font, starting at U+4E00
+#define MAX_CHAT_LINES         14   // Chat lines displayed
+#define CHAT_LINE_GLYPHS       40   // Glyphs per chat line
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - dynamic font");
+
+    // Static font: ASCII and CJK unified ideographs baked on loading
+    int codepointCount = 95 + CJK_GLYPHS_COUNT;
+    int *codepoints = (int *)MemAlloc(codepointCount*sizeof(int));
+    for (int i = 0; i < 95; i++) codepoints[i] = 32 + i;
+    for (int i = 0; i < CJK_GLYPHS_COUNT; i++) codepoints[95 + i] = 0x4e00 + i;
+
+    double startTime = GetTime();
+    Font font = LoadFontEx("resources/DotGothic16-Regular.ttf", 16, codepoints, codepointCount);
+    float staticLoadTime = (float)((GetTime() - startTime)*1000.0);
+    int staticAtlasSize = font.texture.width*font.texture.height*2;     // Gray+alpha atlas
+
+    MemFree(codepoints);
+
+    // Dynamic font: glyphs rasterized on demand into 256x256 atlas pages (max 4 pages)
+    startTime = GetTime();
+    DynamicFont *dynamicFont = LoadDynamicFont("resources/DotGothic16-Regular.ttf", 16, 256, 4);
+    float dynamicLoadTime = (float)((GetTime() - startTime)*1000.0);
+
+    // Chat lines, random kanji from baked range
+    char *lines[MAX_CHAT_LINES] = { 0 };
+    int lineCodepoints[CHAT_LINE_GLYPHS] = { 0 };
+    float lineTimer = 0.0f;
+
+    bool useDynamic = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useDynamic = !useDynamic;
+
+        // Add a new chat line every 0.5 seconds, scrolling older ones
+        lineTimer += GetFrameTime();
+        if (lineTimer > 0.5f)
+        {
+            lineTimer = 0.0f;
+
+            UnloadUTF8(lines[0]);
+            for (int i = 0; i < MAX_CHAT_LINES - 1; i++) lines[i] = lines[i + 1];
+
+            lineCodepoints[0] = 'A' + rand()%26;
+            lineCodepoints[1] = ':';
+            for (int i = 2; i < CHAT_LINE_GLYPHS; i++) lineCodepoints[i] = 0x4e00 + rand()%CJK_GLYPHS_COUNT;
+
+            lines[MAX_CHAT_LINES - 1] = LoadUTF8(lineCodepoints, CHAT_LINE_GLYPHS);
+        }
+
+        TextureAtlas *atlas = GetDynamicFontAtlas(dynamicFont);
+        int pageCount = GetTextureAtlasPageCount(atlas);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_CHAT_LINES; i++)
+            {
+                if (lines[i] == NULL) continue;
+
+                Vector2 position = { 20.0f, 160.0f + i*20.0f };
+
+                if (useDynamic) DrawTextDynamic(dynamicFont, lines[i], position, 16.0f, 0.0f, DARKGRAY);
+                else DrawTextEx(font, lines[i], position, 16.0f, 0.0f, DARKGRAY);
+            }
+
+            // Draw dynamic font atlas pages
+            for (int i = 0; i < pageCount; i++)
+            {
+                Texture2D page = GetTextureAtlasPage(atlas, i);
+                Rectangle dest = { (float)(screenWidth - 138), (float)(10 + i*110), 128.0f, 100.0f };
+
+                DrawRectangleRec(dest, DARKGRAY);
+                DrawTexturePro(page, (Rectangle){ 0.0f, 0.0f, (float)page.width, (float)page.height }, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+                DrawRectangleLinesEx(dest, 1.0f, BLACK);
+            }
+
+            DrawRectangle(10, 10, 460, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 460, 130, BLUE);
+            DrawText(TextFormat("Static font: %i glyphs, loaded in %.1f ms, atlas %i KB", font.glyphCount, staticLoadTime, staticAtlasSize/1024), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Dynamic font: loaded in %.2f ms, %i pages (%i KB)", dynamicLoadTime, pageCount, pageCount*256*256*4/1024), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Dynamic font glyphs resident: %i", GetDynamicFontGlyphCount(dynamicFont)), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Drawing with: %s", useDynamic? "DYNAMIC FONT" : "STATIC FONT"), 20, 80, 20, MAROON);
+            DrawText("SPACE: switch font", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 230, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_CHAT_LINES; i++) UnloadUTF8(lines[i]);
+
+    UnloadDynamicFont(dynamicFont); // Unload dynamic font (atlas pages and font data)
+    UnloadFont(font);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
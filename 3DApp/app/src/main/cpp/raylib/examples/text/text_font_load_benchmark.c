@@ -0,0 +1,136 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - font loading benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Font glyphs are rasterized [LoadFontData()] and packed [GenImageFontAtlas()] for
+*         several glyphs counts and font sizes, as bitmap (FONT_DEFAULT) or SDF (FONT_SDF).
+*         Glyphs are rasterized by ranges over worker threads (if available), one table cell
+*         is measured per frame, font file data is loaded once (no file access measured)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stddef.h>         // Required for: NULL
+
+#define GLYPH_COUNTS    3       // Glyphs counts measured (table rows)
+#define FONT_SIZES      3       // Font sizes measured (table columns)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font loading benchmark");
+
+    // Load font file data once, fonts are loaded from memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData("resources/DotGothic16-Regular.ttf", &dataSize);
+
+    const int glyphCounts[GLYPH_COUNTS] = { 500, 1000, 2000 };
+    const int fontSizes[FONT_SIZES] = { 16, 32, 48 };
+
+    // Codepoints: ASCII and CJK unified ideographs, starting at U+4E00
+    int codepoints[2000] = { 0 };
+    for (int i = 0; i < 2000; i++) codepoints[i] = (i < 95)? (32 + i) : (0x4e00 + i - 95);
+
+    float loadTimes[GLYPH_COUNTS][FONT_SIZES] = { 0 };     // Glyphs rasterization time (ms)
+    float packTimes[GLYPH_COUNTS][FONT_SIZES] = { 0 };     // Atlas packing time (ms)
+
+    int fontType = FONT_DEFAULT;
+    int nextCell = 0;                   // Next table cell to measure
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { fontType = (fontType == FONT_DEFAULT)? FONT_SDF : FONT_DEFAULT; nextCell = 0; }
+        if (IsKeyPressed(KEY_ENTER)) nextCell = 0;
+
+        // Measure one table cell per frame
+        if (nextCell < GLYPH_COUNTS*FONT_SIZES)
+        {
+            int row = nextCell/FONT_SIZES;
+            int col = nextCell%FONT_SIZES;
+
+            double startTime = GetTime();
+            GlyphInfo *glyphs = LoadFontData(fileData, dataSize, fontSizes[col], codepoints, glyphCounts[row], fontType);
+            double loadTime = GetTime() - startTime;
+
+            Rectangle *recs = NULL;
+            startTime = GetTime();
+            Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCounts[row], fontSizes[col], 4, 0);
+            double packTime = GetTime() - startTime;
+
+            loadTimes[row][col] = (float)(loadTime*1000.0);
+            packTimes[row][col] = (float)(packTime*1000.0);
+
+            UnloadImage(atlas);
+            MemFree(recs);
+            UnloadFontData(glyphs, glyphCounts[row]);
+
+            nextCell++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw results table: rasterization time (packing time) per glyphs count and font size
+            for (int col = 0; col < FONT_SIZES; col++) DrawText(TextFormat("%i px", fontSizes[col]), 180 + col*200, 180, 20, DARKGRAY);
+
+            for (int row = 0; row < GLYPH_COUNTS; row++)
+            {
+                DrawText(TextFormat("%i glyphs", glyphCounts[row]), 20, 220 + row*40, 20, DARKGRAY);
+
+                for (int col = 0; col < FONT_SIZES; col++)
+                {
+                    if ((row*FONT_SIZES + col) < nextCell) DrawText(TextFormat("%.1f (%.1f) ms", loadTimes[row][col], packTimes[row][col]), 180 + col*200, 220 + row*40, 20, MAROON);
+                    else DrawText("...", 180 + col*200, 220 + row*40, 20, LIGHTGRAY);
+                }
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText("Font: DotGothic16 (ASCII + CJK ideographs)", 20, 20, 10, BLACK);
+            DrawText(TextFormat("Font type: %s", (fontType == FONT_SDF)? "FONT_SDF (signed distance field)" : "FONT_DEFAULT (anti-aliased bitmap)"), 20, 40, 10, BLACK);
+            DrawText("Table: glyphs rasterization (atlas packing) time", 20, 60, 10, BLACK);
+            DrawText((nextCell < GLYPH_COUNTS*FONT_SIZES)? "MEASURING..." : "DONE", 20, 80, 20, MAROON);
+            DrawText("SPACE: switch font type | ENTER: measure again", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFileData(fileData);       // Unload font file data
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
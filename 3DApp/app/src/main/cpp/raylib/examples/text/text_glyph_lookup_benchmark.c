@@ -0,0 +1,142 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - glyph lookup benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: A CJK font with ~4000 glyphs is loaded, font glyphs lookup table is generated on
+*         loading [GenFontGlyphLookup()]. Localized text is measured for a fixed time budget
+*         every frame with lookup table (direct table + hash table) or without it (glyphs
+*         linear scan), glyphs resolved per second are reported
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stddef.h>         // Required for: NULL
+
+#define QUERY_TIME_BUDGET   0.004   // Text measuring time budget per frame (seconds)
+#define CJK_GLYPHS_COUNT     4000   // CJK unified ideographs loaded, starting at U+4E00
+#define TEXT_GLYPHS_COUNT     512   // Glyphs in measured text
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - glyph lookup benchmark");
+
+    // Load font codepoints: ASCII, hiragana, katakana and CJK unified ideographs
+    int codepointCount = 95 + 192 + CJK_GLYPHS_COUNT;
+    int *codepoints = (int *)MemAlloc(codepointCount*sizeof(int));
+
+    for (int i = 0; i < 95; i++) codepoints[i] = 32 + i;
+    for (int i = 0; i < 192; i++) codepoints[95 + i] = 0x3040 + i;
+    for (int i = 0; i < CJK_GLYPHS_COUNT; i++) codepoints[95 + 192 + i] = 0x4e00 + i;
+
+    double startTime = GetTime();
+    Font font = LoadFontEx("resources/DotGothic16-Regular.ttf", 16, codepoints, codepointCount);
+    float loadTime = (float)((GetTime() - startTime)*1000.0);
+
+    // Generate localized text from font codepoints (kana and kanji mixed, some line breaks)
+    int *textCodepoints = (int *)MemAlloc(TEXT_GLYPHS_COUNT*sizeof(int));
+    for (int i = 0; i < TEXT_GLYPHS_COUNT; i++)
+    {
+        if ((i%48) == 47) textCodepoints[i] = '\n';
+        else if ((i%3) == 0) textCodepoints[i] = codepoints[95 + (i*7)%192];
+        else textCodepoints[i] = codepoints[95 + 192 + (i*131)%CJK_GLYPHS_COUNT];
+    }
+
+    char *text = LoadUTF8(textCodepoints, TEXT_GLYPHS_COUNT);
+
+    bool useLookup = true;
+
+    int glyphCount = 0;                 // Glyphs resolved over measured frames
+    double queryTime = 0.0;             // Measuring time accumulated over measured frames
+    int measuredFrames = 0;
+    float glyphsPerSecond = 0.0f;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { useLookup = !useLookup; glyphCount = 0; queryTime = 0.0; measuredFrames = 0; }
+
+        // NOTE: Font copy without lookup table, glyphs are scanned linearly
+        Font measuredFont = font;
+        if (!useLookup) measuredFont.lookup = NULL;
+
+        // Measure text for the frame time budget
+        startTime = GetTime();
+        double elapsedTime = 0.0;
+
+        while (elapsedTime < QUERY_TIME_BUDGET)
+        {
+            MeasureTextEx(measuredFont, text, 16.0f, 0.0f);
+
+            glyphCount += TEXT_GLYPHS_COUNT;
+            elapsedTime = GetTime() - startTime;
+        }
+
+        queryTime += elapsedTime;
+        measuredFrames++;
+
+        if (measuredFrames == 30)
+        {
+            glyphsPerSecond = (float)(glyphCount/queryTime);
+            glyphCount = 0;
+            queryTime = 0.0;
+            measuredFrames = 0;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawTextEx(measuredFont, text, (Vector2){ 20.0f, 160.0f }, 16.0f, 0.0f, DARKGRAY);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Font: %i glyphs (loaded in %.1f ms)", font.glyphCount, loadTime), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Lookup table: %i hash slots", (font.lookup != NULL)? font.lookup->hashSize : 0), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Glyph lookup: %s", useLookup? "LOOKUP TABLE (direct + hash)" : "LINEAR SCAN (all glyphs)"), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Glyphs: %.2f M/s", glyphsPerSecond/1000000.0f), 20, 80, 20, MAROON);
+            DrawText("SPACE: switch glyph lookup", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadUTF8(text);
+    MemFree(textCodepoints);
+    MemFree(codepoints);
+    UnloadFont(font);               // Unload font and glyphs lookup table
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
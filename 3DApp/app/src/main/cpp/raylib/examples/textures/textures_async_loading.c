@@ -0,0 +1,123 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - async loading (decoding on worker threads, upload budget)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Image files are added to a texture loader [AddTextureLoaderFile()], decoded and
+*         mipmaps generated on worker threads (if available), decoded images are uploaded to
+*         GPU on main thread [UpdateTextureLoader()], up to a time budget per frame. Without
+*         worker threads (web, single core), images are decoded on main thread within budget
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_IMAGE_FILES     8       // Image files loaded
+#define MAX_TEXTURES       48       // Textures loaded (every image file loaded several times)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - async loading");
+
+    const char *fileNames[MAX_IMAGE_FILES] = {
+        "resources/parrots.png", "resources/fudesumi.png", "resources/cat.png", "resources/road.png",
+        "resources/cyberpunk_street_background.png", "resources/cyberpunk_street_midground.png",
+        "resources/cyberpunk_street_foreground.png", "resources/patterns.png"
+    };
+
+    TextureLoader *loader = LoadTextureLoader();
+    int handles[MAX_TEXTURES] = { 0 };
+
+    float budget = 2.0f;                // Upload time budget per frame (ms)
+    int maxUploaded = 0;                // Maximum textures uploaded in one frame
+    float maxUploadTime = 0.0f;         // Maximum upload time in one frame (ms)
+    bool reload = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_ENTER)) reload = true;
+        if (IsKeyPressed(KEY_UP) && (budget < 16.0f)) budget *= 2.0f;
+        if (IsKeyPressed(KEY_DOWN) && (budget > 0.5f)) budget /= 2.0f;
+
+        if (reload)
+        {
+            // Unload previous textures and add all files again, mipmaps generated on decoding
+            UnloadTextureLoader(loader);
+            loader = LoadTextureLoader();
+
+            for (int i = 0; i < MAX_TEXTURES; i++) handles[i] = AddTextureLoaderFile(loader, fileNames[i%MAX_IMAGE_FILES], 0, true);
+
+            maxUploaded = 0;
+            maxUploadTime = 0.0f;
+            reload = false;
+        }
+
+        UpdateTextureLoader(loader, budget);   // Upload decoded textures, within budget
+
+        TextureLoaderStats stats = GetTextureLoaderStats(loader);
+
+        if (stats.uploaded > maxUploaded) maxUploaded = stats.uploaded;
+        if (stats.uploadTime > maxUploadTime) maxUploadTime = stats.uploadTime;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw loaded textures thumbnails, pending ones as placeholders
+            for (int i = 0; i < MAX_TEXTURES; i++)
+            {
+                Rectangle cell = { 10.0f + (i%12)*65.0f, 160.0f + (i/12)*70.0f, 64.0f, 64.0f };
+                Texture2D texture = GetTextureLoaderTexture(loader, handles[i]);
+
+                if (texture.id > 0) DrawTexturePro(texture, (Rectangle){ 0, 0, (float)texture.width, (float)texture.height }, cell, (Vector2){ 0, 0 }, 0.0f, WHITE);
+                else DrawRectangleRec(cell, (GetTextureLoadState(loader, handles[i]) == TEXTURE_LOAD_FAILED)? RED : LIGHTGRAY);
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Textures: %i loaded, %i pending", stats.loaded, stats.pending), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Decoding: %.2f MB/s | Upload: %.2f MB/s", stats.decodeRate, stats.uploadRate), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Max per frame: %i textures, %.2f ms", maxUploaded, maxUploadTime), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Budget: %.1f ms/frame", budget), 20, 80, 20, MAROON);
+            DrawText("UP/DOWN: upload budget | ENTER: reload", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextureLoader(loader);    // Unload texture loader and its textures
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - texture atlas batching
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Many small sprites images are packed at runtime into texture atlas pages
+*         [AddTextureAtlasImages()], sprites are drawn by handle from atlas pages (batched
+*         together) or from one texture per sprite (one draw call per texture switch),
+*         draw calls are reported by rlGetRenderStats(), drawing time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlGetRenderStats()
+
+#include <math.h>           // Required for: sinf(), cosf()
+
+#define MAX_SPRITE_IMAGES   64      // Sprites images generated, no resources required
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - texture atlas batching");
+
+    // Generate sprites images with different sizes and patterns
+    Image images[MAX_SPRITE_IMAGES] = { 0 };
+    Texture2D textures[MAX_SPRITE_IMAGES] = { 0 };
+
+    for (int i = 0; i < MAX_SPRITE_IMAGES; i++)
+    {
+        int size = 12 + (i%5)*6;
+        Color colorA = ColorFromHSV((float)(i*360/MAX_SPRITE_IMAGES), 0.8f, 0.9f);
+        Color colorB = ColorFromHSV((float)((i*360/MAX_SPRITE_IMAGES + 180)%360), 0.8f, 0.5f);
+
+        if ((i%2) == 0) images[i] = GenImageChecked(size, size, size/4, size/4, colorA, colorB);
+        else images[i] = GenImageGradientRadial(size, size, 0.0f, colorA, colorB);
+
+        textures[i] = LoadTextureFromImage(images[i]);
+    }
+
+    // Pack all sprites images into texture atlas pages (256x256, unlimited pages, 1 pixel padding)
+    TextureAtlas *atlas = LoadTextureAtlas(256, 0, 1);
+    int sprites[MAX_SPRITE_IMAGES] = { 0 };
+
+    double startTime = GetTime();
+    int packedCount = AddTextureAtlasImages(atlas, images, MAX_SPRITE_IMAGES, sprites);
+    float packTime = (float)((GetTime() - startTime)*1000.0);
+
+    for (int i = 0; i < MAX_SPRITE_IMAGES; i++) UnloadImage(images[i]);
+
+    const int spriteCounts[4] = { 1000, 2500, 5000, 10000 };
+    int countIndex = 1;
+    bool useAtlas = true;
+
+    double drawTime = 0.0;              // Sprites drawing time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average sprites drawing time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { useAtlas = !useAtlas; drawTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_UP) && (countIndex < 3)) { countIndex++; drawTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0)) { countIndex--; drawTime = 0.0; measuredFrames = 0; }
+
+        int spriteCount = spriteCounts[countIndex];
+        float time = (float)GetTime();
+
+        // Render stats of previous frame
+        rlRenderStats stats = rlGetRenderStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            startTime = GetTime();
+
+            for (int i = 0; i < spriteCount; i++)
+            {
+                int index = i%MAX_SPRITE_IMAGES;
+                Vector2 position = { (float)((i*37)%screenWidth) + sinf(time + i)*8.0f, (float)((i*13)%screenHeight) + cosf(time + i)*8.0f };
+
+                // NOTE: Consecutive sprites use different images, every sprite switches texture when not using atlas
+                if (useAtlas) DrawTextureAtlasSprite(atlas, sprites[index], position, WHITE);
+                else DrawTextureV(textures[index], position, WHITE);
+            }
+
+            rlDrawRenderBatchActive();
+
+            drawTime += (GetTime() - startTime);
+            measuredFrames++;
+
+            if (measuredFrames == 30)
+            {
+                averageTime = (float)(drawTime*1000.0/measuredFrames);
+                drawTime = 0.0;
+                measuredFrames = 0;
+            }
+
+            // Draw atlas pages thumbnails
+            int pageCount = GetTextureAtlasPageCount(atlas);
+            for (int i = 0; i < pageCount; i++)
+            {
+                Texture2D page = GetTextureAtlasPage(atlas, i);
+                Rectangle dest = { (float)(screenWidth - 138*(i + 1)), (float)(screenHeight - 138), 128.0f, 128.0f };
+
+                DrawRectangleRec(dest, DARKGRAY);
+                DrawTexturePro(page, (Rectangle){ 0.0f, 0.0f, (float)page.width, (float)page.height }, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+                DrawRectangleLinesEx(dest, 1.0f, BLACK);
+            }
+
+            DrawRectangle(10, 10, 380, 150, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 150, BLUE);
+            DrawText(TextFormat("Sprites: %i (%i images)", spriteCount, MAX_SPRITE_IMAGES), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Atlas: %i images packed in %i pages (%.2f ms)", packedCount, pageCount, packTime), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Drawing from: %s", useAtlas? "ATLAS PAGES (batched)" : "TEXTURES (one per image)"), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Draw calls: %i, batch flushes: %i", stats.drawCalls, stats.batchFlushes), 20, 80, 10, BLACK);
+            DrawText(TextFormat("Sprites drawing: %.3f ms/frame", averageTime), 20, 100, 20, MAROON);
+            DrawText("SPACE: switch atlas | UP/DOWN: sprites", 20, 135, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextureAtlas(atlas);      // Unload texture atlas pages
+    for (int i = 0; i < MAX_SPRITE_IMAGES; i++) UnloadTexture(textures[i]);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - render batch sorting
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Interleaved UI and sprites drawing: every widget draws a panel, an icon (two textures),
+*         an additive glow and a label, switching texture and blending mode several times.
+*         Sorted render batch [rlEnableRenderBatchSorting()] records state per draw and merges
+*         draws sharing state inside every layer (panels, icons, labels), draw calls submitted
+*         and issued are reported by rlGetRenderStats(), drawing time is averaged over frames
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlEnableRenderBatchSorting(), rlSetRenderBatchLayer(), rlGetRenderStats()
+
+#include <math.h>           // Required for: sinf()
+
+// Widgets draw layers, draws order is only kept between layers
+typedef enum {
+    LAYER_PANELS = 0,
+    LAYER_ICONS,
+    LAYER_LABELS
+} WidgetLayer;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - render batch sorting");
+
+    // Generate icons textures, no resources required
+    Image image = GenImageChecked(32, 32, 8, 8, ORANGE, MAROON);
+    Texture2D iconA = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    image = GenImageGradientRadial(32, 32, 0.0f, SKYBLUE, DARKBLUE);
+    Texture2D iconB = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    const int widgetCounts[4] = { 50, 100, 200, 400 };
+    int countIndex = 1;
+    bool sorting = true;
+
+    double drawTime = 0.0;              // Widgets drawing time accumulated over measured frames
+    int measuredFrames = 0;
+    float averageTime = 0.0f;           // Average widgets drawing time (ms)
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) { sorting = !sorting; drawTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_UP) && (countIndex < 3)) { countIndex++; drawTime = 0.0; measuredFrames = 0; }
+        if (IsKeyPressed(KEY_DOWN) && (countIndex > 0)) { countIndex--; drawTime = 0.0; measuredFrames = 0; }
+
+        int widgetCount = widgetCounts[countIndex];
+        float time = (float)GetTime();
+
+        // Render stats of previous frame
+        rlRenderStats stats = rlGetRenderStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            double startTime = GetTime();
+
+            if (sorting) rlEnableRenderBatchSorting();
+
+            for (int i = 0; i < widgetCount; i++)
+            {
+                int x = 10 + (i%20)*39;
+                int y = 170 + ((i/20)%7)*39 + (int)(sinf(time*2.0f + i*0.3f)*4.0f);
+                Texture2D icon = ((i%2) == 0)? iconA : iconB;
+
+                rlSetRenderBatchLayer(LAYER_PANELS);
+                DrawRectangle(x, y, 36, 36, LIGHTGRAY);
+                DrawRectangleLines(x, y, 36, 36, GRAY);
+
+                rlSetRenderBatchLayer(LAYER_ICONS);
+                DrawTexture(icon, x + 2, y + 2, WHITE);
+
+                BeginBlendMode(BLEND_ADDITIVE);
+                    DrawCircle(x + 18, y + 18, 6.0f, Fade(YELLOW, 0.3f));
+                EndBlendMode();
+
+                rlSetRenderBatchLayer(LAYER_LABELS);
+                DrawText(TextFormat("%03i", i), x + 4, y + 24, 10, BLACK);
+            }
+
+            rlSetRenderBatchLayer(LAYER_PANELS);
+
+            // NOTE: Disabling sorting draws the batch
+            if (sorting) rlDisableRenderBatchSorting();
+            else rlDrawRenderBatchActive();
+
+            drawTime += (GetTime() - startTime);
+            measuredFrames++;
+
+            if (measuredFrames == 30)
+            {
+                averageTime = (float)(drawTime*1000.0/measuredFrames);
+                drawTime = 0.0;
+                measuredFrames = 0;
+            }
+
+            DrawRectangle(10, 10, 380, 150, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 150, BLUE);
+            DrawText(TextFormat("Widgets: %i (panel, icon, glow, label)", widgetCount), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Render batch: %s", sorting? "SORTED (merged by state)" : "UNSORTED (submission order)"), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Draw calls submitted: %i, issued: %i", stats.drawCallsSubmitted, stats.drawCalls), 20, 60, 10, BLACK);
+            DrawText(TextFormat("Batch flushes: %i", stats.batchFlushes), 20, 80, 10, BLACK);
+            DrawText(TextFormat("Widgets drawing: %.3f ms/frame", averageTime), 20, 100, 20, MAROON);
+            DrawText("SPACE: switch sorting | UP/DOWN: widgets", 20, 135, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(iconA);
+    UnloadTexture(iconB);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - compressed loading (GPU formats encoded on CPU, KTX cache)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Image file is compressed into GPU format (DXT1/DXT3/DXT5, ETC1/ETC2/EAC) on loading
+*         [LoadImageCompressed()], mipmaps included, and cached into a KTX file, next loads
+*         read the cache. Compression quality is checked on CPU: compressed image is decoded
+*         back to R8G8B8A8 [ImageFormat()] and compared with source image (PSNR)
+*
+*   NOTE: Compressed formats support depends on GPU, DXT on desktop, ETC1 on most mobile
+*         GPUs and ETC2/EAC on OpenGL ES 3.0 and OpenGL 4.3 GPUs
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>               // Required for: log10f()
+
+#define MAX_FORMATS     7       // Compressed formats encoded
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static float GetImagePSNR(Image image, Image source);   // Get image PSNR (RGB channels) compared with source image
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - compressed loading");
+
+    const char *fileName = "resources/parrots.png";
+    const int formats[MAX_FORMATS] = {
+        PIXELFORMAT_COMPRESSED_DXT1_RGB, PIXELFORMAT_COMPRESSED_DXT1_RGBA, PIXELFORMAT_COMPRESSED_DXT3_RGBA,
+        PIXELFORMAT_COMPRESSED_DXT5_RGBA, PIXELFORMAT_COMPRESSED_ETC1_RGB, PIXELFORMAT_COMPRESSED_ETC2_RGB,
+        PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA
+    };
+    const char *formatNames[MAX_FORMATS] = { "DXT1 RGB", "DXT1 RGBA", "DXT3 RGBA", "DXT5 RGBA", "ETC1 RGB", "ETC2 RGB", "ETC2 EAC RGBA" };
+
+    // Source image, used to measure compression quality
+    Image source = LoadImage(fileName);
+    ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Texture2D texture = { 0 };
+    int currentFormat = 0;
+    float loadTime = 0.0f;              // Compressed image load time (ms), compression or cache
+    float psnr = 0.0f;                  // Compressed image PSNR (dB)
+    float ratio = 0.0f;                 // Compressed data size ratio (R8G8B8A8 to compressed)
+    bool reload = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_RIGHT)) { currentFormat = (currentFormat + 1)%MAX_FORMATS; reload = true; }
+        if (IsKeyPressed(KEY_LEFT)) { currentFormat = (currentFormat + MAX_FORMATS - 1)%MAX_FORMATS; reload = true; }
+
+        if (reload)
+        {
+            UnloadTexture(texture);
+
+            // Load image compressed, from cache file if available
+            double startTime = GetTime();
+            Image image = LoadImageCompressed(fileName, formats[currentFormat], true);
+            loadTime = (float)((GetTime() - startTime)*1000.0);
+
+            // Decode compressed image on CPU to measure quality
+            if (IsImageValid(image))
+            {
+                Image decoded = ImageCopy(image);
+                ImageFormat(&decoded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+                psnr = GetImagePSNR(decoded, source);
+                ratio = (float)GetPixelDataSize(image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)/GetPixelDataSize(image.width, image.height, image.format);
+                UnloadImage(decoded);
+            }
+
+            // NOTE: Texture is not loaded if compressed format is not supported by GPU (id = 0)
+            texture = LoadTextureFromImage(image);
+            if (texture.id > 0) SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+            UnloadImage(image);
+
+            reload = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (texture.id > 0) DrawTexturePro(texture, (Rectangle){ 0, 0, (float)texture.width, (float)texture.height }, (Rectangle){ 400, 150, 380, 285 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+            else DrawText("Format not supported by GPU", 460, 280, 20, RED);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Source: %s (%ix%i)", fileName, source.width, source.height), 20, 20, 10, BLACK);
+            DrawText(TextFormat("Load time: %.2f ms (compression or KTX cache)", loadTime), 20, 40, 10, BLACK);
+            DrawText(TextFormat("Quality: %.2f dB PSNR | Size: %.0f:1", psnr, ratio), 20, 60, 10, BLACK);
+            DrawText(formatNames[currentFormat], 20, 80, 20, MAROON);
+            DrawText("LEFT/RIGHT: change compressed format", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);         // Unload texture from VRAM
+    UnloadImage(source);            // Unload source image from RAM
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get image PSNR (RGB channels) compared with source image
+// NOTE: Both images expected in R8G8B8A8 format, same size
+static float GetImagePSNR(Image image, Image source)
+{
+    const unsigned char *pixels = (const unsigned char *)image.data;
+    const unsigned char *sourcePixels = (const unsigned char *)source.data;
+    double error = 0.0;
+
+    for (int i = 0; i < image.width*image.height; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            double diff = (double)pixels[i*4 + c] - sourcePixels[i*4 + c];
+            error += diff*diff;
+        }
+    }
+
+    error /= (double)image.width*image.height*3;
+
+    return (error > 0.0)? 10.0f*log10f((float)(255.0*255.0/error)) : 99.0f;
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - image kernels benchmark
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Image processing functions are measured for several image sizes: blur, convolution,
+*         contrast, tint, dither and resize (R8G8B8A8 and R32 float). Images are processed
+*         in their own format, by rows ranges over worker threads (if available), dithering
+*         is sequential. One table cell is measured per frame, image copy is not measured
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define IMAGE_OPERATIONS    7       // Image operations measured (table rows)
+#define IMAGE_SIZES         3       // Image sizes measured (table columns)
+
+// Image operations measured
+typedef enum {
+    OPERATION_BLUR = 0,
+    OPERATION_CONVOLUTION,
+    OPERATION_CONTRAST,
+    OPERATION_TINT,
+    OPERATION_DITHER,
+    OPERATION_RESIZE,
+    OPERATION_RESIZE_FLOAT
+} ImageOperation;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - image kernels benchmark");
+
+    const int imageSizes[IMAGE_SIZES] = { 512, 1024, 2048 };
+    const char *operationNames[IMAGE_OPERATIONS] = { "Blur (4 px)", "Convolution 3x3", "Contrast", "Tint", "Dither 565", "Resize 1/2", "Resize 1/2 R32" };
+
+    // Source images generated once, copied for every measure
+    Image images[IMAGE_SIZES] = { 0 };
+    for (int i = 0; i < IMAGE_SIZES; i++) images[i] = GenImagePerlinNoise(imageSizes[i], imageSizes[i], 0, 0, 4.0f);
+
+    // Sharpen kernel
+    const float kernel[9] = {
+        0.0f, -1.0f, 0.0f,
+        -1.0f, 5.0f, -1.0f,
+        0.0f, -1.0f, 0.0f
+    };
+
+    float times[IMAGE_OPERATIONS][IMAGE_SIZES] = { 0 };    // Operation time (ms)
+
+    int nextCell = 0;                   // Next table cell to measure
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_ENTER)) nextCell = 0;
+
+        // Measure one table cell per frame
+        if (nextCell < IMAGE_OPERATIONS*IMAGE_SIZES)
+        {
+            int row = nextCell/IMAGE_SIZES;
+            int col = nextCell%IMAGE_SIZES;
+
+            Image image = ImageCopy(images[col]);
+            if (row == OPERATION_RESIZE_FLOAT) ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R32);
+
+            double startTime = GetTime();
+
+            switch (row)
+            {
+                case OPERATION_BLUR: ImageBlurGaussian(&image, 4); break;
+                case OPERATION_CONVOLUTION: ImageKernelConvolution(&image, kernel, 9); break;
+                case OPERATION_CONTRAST: ImageColorContrast(&image, 40.0f); break;
+                case OPERATION_TINT: ImageColorTint(&image, ORANGE); break;
+                case OPERATION_DITHER: ImageDither(&image, 5, 6, 5, 0); break;
+                case OPERATION_RESIZE:
+                case OPERATION_RESIZE_FLOAT: ImageResize(&image, image.width/2, image.height/2); break;
+                default: break;
+            }
+
+            times[row][col] = (float)((GetTime() - startTime)*1000.0);
+
+            UnloadImage(image);
+
+            nextCell++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw results table: operation time per image size
+            for (int col = 0; col < IMAGE_SIZES; col++) DrawText(TextFormat("%ix%i", imageSizes[col], imageSizes[col]), 240 + col*180, 160, 20, DARKGRAY);
+
+            for (int row = 0; row < IMAGE_OPERATIONS; row++)
+            {
+                DrawText(operationNames[row], 20, 195 + row*35, 20, DARKGRAY);
+
+                for (int col = 0; col < IMAGE_SIZES; col++)
+                {
+                    if ((row*IMAGE_SIZES + col) < nextCell) DrawText(TextFormat("%.2f ms", times[row][col]), 240 + col*180, 195 + row*35, 20, MAROON);
+                    else DrawText("...", 240 + col*180, 195 + row*35, 20, LIGHTGRAY);
+                }
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText("Source: perlin noise images (R8G8B8A8)", 20, 20, 10, BLACK);
+            DrawText("Images processed in own format, by rows ranges", 20, 40, 10, BLACK);
+            DrawText("Table: operation time, image copy not measured", 20, 60, 10, BLACK);
+            DrawText((nextCell < IMAGE_OPERATIONS*IMAGE_SIZES)? "MEASURING..." : "DONE", 20, 80, 20, MAROON);
+            DrawText("ENTER: measure again", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < IMAGE_SIZES; i++) UnloadImage(images[i]);   // Unload source images
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
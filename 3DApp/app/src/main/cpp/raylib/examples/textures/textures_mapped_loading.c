@@ -0,0 +1,232 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - mapped loading (file views, load time and peak memory)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Image files are loaded through file views [LoadFileView()], file data is mapped into
+*         memory if supported by platform (desktop POSIX and uncompressed Android assets), no
+*         file data is copied into heap memory. Loading from file data [LoadFileData()] is
+*         measured for comparison
+*
+*   NOTE: Peak memory is process peak resident set size, only available on Linux and Android,
+*         it is reset before every load. Mapped file pages are counted while read but they are
+*         clean pages, shared with system file cache and reclaimable
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: FILE, fopen(), fgets(), fputs(), fclose()
+#include <stdlib.h>             // Required for: atoi()
+#include <string.h>             // Required for: strncmp()
+
+#define MAX_LOAD_MODES      4
+
+#define IMAGE_SIZE       2048   // Generated images size (width and height)
+
+// Load modes: image from generated QOI and RAW files, mapped or from file data
+typedef enum {
+    LOAD_IMAGE_QOI_MAPPED = 0,
+    LOAD_IMAGE_QOI_DATA,
+    LOAD_IMAGE_RAW_MAPPED,
+    LOAD_IMAGE_RAW_DATA
+} LoadMode;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static int ResetPeakMemory(void);                   // Reset process peak memory, returns current memory (KB)
+static int GetPeakMemory(void);                     // Get process peak memory since reset (KB)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - mapped loading");
+
+    // Generate QOI and RAW (R8G8B8A8 pixels) files to be loaded
+    Image noise = GenImagePerlinNoise(IMAGE_SIZE, IMAGE_SIZE, 0, 0, 4.0f);
+    ExportImage(noise, "noise_mapped.qoi");
+    ExportImage(noise, "noise_mapped.raw");
+    UnloadImage(noise);
+
+    // Check if file views are mapped on this platform
+    FileView view = LoadFileView("noise_mapped.raw");
+    bool mapped = view.mapped;
+    UnloadFileView(view);
+
+    const char *modeNames[MAX_LOAD_MODES] = {
+        "LoadImage(qoi)", "LoadImageFromMemory(qoi)",
+        "LoadImageRaw(raw)", "LoadFileData(raw) + ImageCopy()"
+    };
+
+    float loadTime[MAX_LOAD_MODES] = { 0 };         // Load time (ms)
+    int peakMemory[MAX_LOAD_MODES] = { 0 };         // Peak memory increase on loading (KB)
+    bool measured[MAX_LOAD_MODES] = { 0 };
+
+    Image image = { 0 };
+    Texture2D texture = { 0 };
+    int currentMode = -1;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        int mode = GetKeyPressed() - KEY_ONE;
+
+        if ((mode >= 0) && (mode < MAX_LOAD_MODES))
+        {
+            // Unload previous image and texture, before measuring
+            UnloadImage(image);
+            UnloadTexture(texture);
+            image = (Image){ 0 };
+            texture = (Texture2D){ 0 };
+
+            int baseMemory = ResetPeakMemory();
+            double startTime = GetTime();
+
+            switch (mode)
+            {
+                case LOAD_IMAGE_QOI_MAPPED: image = LoadImage("noise_mapped.qoi"); break;
+                case LOAD_IMAGE_QOI_DATA:
+                {
+                    int dataSize = 0;
+                    unsigned char *data = LoadFileData("noise_mapped.qoi", &dataSize);
+                    image = LoadImageFromMemory(".qoi", data, dataSize);
+                    UnloadFileData(data);
+                } break;
+                case LOAD_IMAGE_RAW_MAPPED: image = LoadImageRaw("noise_mapped.raw", IMAGE_SIZE, IMAGE_SIZE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 0); break;
+                case LOAD_IMAGE_RAW_DATA:
+                {
+                    // NOTE: Pixel data copied from file data, both kept in heap memory while copying
+                    int dataSize = 0;
+                    unsigned char *data = LoadFileData("noise_mapped.raw", &dataSize);
+                    Image dataImage = { data, IMAGE_SIZE, IMAGE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                    if (dataSize >= GetPixelDataSize(IMAGE_SIZE, IMAGE_SIZE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) image = ImageCopy(dataImage);
+                    UnloadFileData(data);
+                } break;
+                default: break;
+            }
+
+            loadTime[mode] = (float)((GetTime() - startTime)*1000.0);
+            peakMemory[mode] = (baseMemory >= 0)? (GetPeakMemory() - baseMemory) : -1;
+            measured[mode] = true;
+            currentMode = mode;
+
+            if (IsImageValid(image)) texture = LoadTextureFromImage(image);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_LOAD_MODES; i++)
+            {
+                int y = 170 + i*40;
+
+                DrawRectangle(20, y, 500, 32, (i == currentMode)? Fade(MAROON, 0.2f) : Fade(LIGHTGRAY, 0.5f));
+                DrawText(TextFormat("[%i] %s", i + 1, modeNames[i]), 30, y + 10, 10, DARKGRAY);
+
+                if (measured[i])
+                {
+                    DrawText(TextFormat("%.2f ms", loadTime[i]), 250, y + 10, 10, BLACK);
+
+                    if (peakMemory[i] >= 0) DrawText(TextFormat("peak +%.2f MB", peakMemory[i]/1024.0f), 360, y + 10, 10, MAROON);
+                    else DrawText("peak memory not available", 360, y + 10, 10, GRAY);
+                }
+            }
+
+            if (texture.id > 0) DrawTexturePro(texture, (Rectangle){ 0, 0, (float)texture.width, (float)texture.height }, (Rectangle){ 540, 170, 232, 232 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText(TextFormat("Source: %ix%i perlin noise exported to QOI and RAW", IMAGE_SIZE, IMAGE_SIZE), 20, 20, 10, BLACK);
+            DrawText(TextFormat("File views: %s", mapped? "mapped into memory, no data copy" : "file data loaded (mapping not available)"), 20, 40, 10, BLACK);
+            DrawText("Data: file data loaded into heap memory", 20, 60, 10, BLACK);
+            if (currentMode >= 0) DrawText(TextFormat("%.2f ms | %s", loadTime[currentMode], (peakMemory[currentMode] >= 0)? TextFormat("+%.1f MB", peakMemory[currentMode]/1024.0f) : "n/a"), 20, 80, 20, MAROON);
+            DrawText("1-4: load image (previous one is unloaded)", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);         // Unload texture from VRAM
+    UnloadImage(image);             // Unload image from RAM
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Reset process peak memory, returns current memory (KB)
+// NOTE: Peak resident set size is reset writing "5" to /proc/self/clear_refs (Linux 4.0),
+// returns -1 if it can not be reset, peak measured would include previous loads
+static int ResetPeakMemory(void)
+{
+#if defined(__linux__)
+    FILE *clearRefs = fopen("/proc/self/clear_refs", "w");
+
+    if (clearRefs == NULL) return -1;
+
+    // NOTE: Write error is reported on stream flush, on close
+    bool reset = (fputs("5", clearRefs) >= 0);
+    if (fclose(clearRefs) != 0) reset = false;
+
+    return reset? GetPeakMemory() : -1;
+#else
+    return -1;
+#endif
+}
+
+// Get process peak memory since reset (KB)
+static int GetPeakMemory(void)
+{
+    int peak = -1;
+
+#if defined(__linux__)
+    FILE *status = fopen("/proc/self/status", "r");
+
+    if (status != NULL)
+    {
+        char line[256] = { 0 };
+
+        while (fgets(line, 256, status) != NULL)
+        {
+            if (strncmp(line, "VmHWM:", 6) == 0) { peak = atoi(line + 6); break; }
+        }
+
+        fclose(status);
+    }
+#endif
+
+    return peak;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - mipmaps benchmark (mipmaps generation on CPU)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   NOTE: Mipmaps generation [ImageMipmapsEx()] is measured for several image sizes, box and
+*         Kaiser filters, linear and gamma-correct (sRGB) filtering, R8G8B8A8 and R32G32B32A32
+*         float images. Every level is filtered from previous one, in image format, large levels
+*         rows over worker threads (if available). One table cell is measured per frame
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MIPMAP_MODES        5       // Mipmaps generation modes measured (table rows)
+#define IMAGE_SIZES         3       // Image sizes measured (table columns)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - mipmaps benchmark");
+
+    const int imageSizes[IMAGE_SIZES] = { 512, 1024, 2048 };
+    const char *modeNames[MIPMAP_MODES] = { "Box", "Box sRGB", "Kaiser", "Kaiser sRGB", "Box R32G32B32A32" };
+    const int modeFilters[MIPMAP_MODES] = { MIPMAP_FILTER_BOX, MIPMAP_FILTER_BOX, MIPMAP_FILTER_KAISER, MIPMAP_FILTER_KAISER, MIPMAP_FILTER_BOX };
+    const bool modeSrgb[MIPMAP_MODES] = { false, true, false, true, false };
+
+    // Source images generated once, copied for every measure
+    Image images[IMAGE_SIZES] = { 0 };
+    for (int i = 0; i < IMAGE_SIZES; i++) images[i] = GenImagePerlinNoise(imageSizes[i], imageSizes[i], 0, 0, 4.0f);
+
+    float times[MIPMAP_MODES][IMAGE_SIZES] = { 0 };    // Mipmaps generation time (ms)
+
+    int nextCell = 0;                   // Next table cell to measure
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_ENTER)) nextCell = 0;
+
+        // Measure one table cell per frame
+        if (nextCell < MIPMAP_MODES*IMAGE_SIZES)
+        {
+            int row = nextCell/IMAGE_SIZES;
+            int col = nextCell%IMAGE_SIZES;
+
+            Image image = ImageCopy(images[col]);
+            if (row == (MIPMAP_MODES - 1)) ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32);
+
+            double startTime = GetTime();
+
+            ImageMipmapsEx(&image, modeFilters[row], modeSrgb[row]);
+
+            times[row][col] = (float)((GetTime() - startTime)*1000.0);
+
+            UnloadImage(image);
+
+            nextCell++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Draw results table: mipmaps generation time per image size
+            for (int col = 0; col < IMAGE_SIZES; col++) DrawText(TextFormat("%ix%i", imageSizes[col], imageSizes[col]), 240 + col*180, 160, 20, DARKGRAY);
+
+            for (int row = 0; row < MIPMAP_MODES; row++)
+            {
+                DrawText(modeNames[row], 20, 195 + row*35, 20, DARKGRAY);
+
+                for (int col = 0; col < IMAGE_SIZES; col++)
+                {
+                    if ((row*IMAGE_SIZES + col) < nextCell) DrawText(TextFormat("%.2f ms", times[row][col]), 240 + col*180, 195 + row*35, 20, MAROON);
+                    else DrawText("...", 240 + col*180, 195 + row*35, 20, LIGHTGRAY);
+                }
+            }
+
+            DrawRectangle(10, 10, 380, 130, Fade(SKYBLUE, 0.9f));
+            DrawRectangleLines(10, 10, 380, 130, BLUE);
+            DrawText("Source: perlin noise images (R8G8B8A8)", 20, 20, 10, BLACK);
+            DrawText("Levels filtered from previous level, in image format", 20, 40, 10, BLACK);
+            DrawText("Table: all mipmap levels generation time", 20, 60, 10, BLACK);
+            DrawText((nextCell < MIPMAP_MODES*IMAGE_SIZES)? "MEASURING..." : "DONE", 20, 80, 20, MAROON);
+            DrawText("ENTER: measure again", 20, 115, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < IMAGE_SIZES; i++) UnloadImage(images[i]);   // Unload source images
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -129,6 +129,8 @@
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_UPLOAD_MODE           1      // Default batch vertex data upload mode: 0-SubData, 1-Orphaning, 2-Persistent mapping (3 batch buffers recommended)
+//#define RL_BATCH_FLOAT_TEXCOORDS             1      // Batch texcoords stored as float, default: 16-bit normalized, float buffer on [0..1] range exceeded
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 
@@ -212,6 +214,9 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support GPU compressed formats (DXT1/DXT3/DXT5, ETC1/ETC2/EAC) encoding and decoding on CPU [ImageFormat()]
+// and compressed images loading, cached into KTX files [LoadImageCompressed()]
+#define SUPPORT_IMAGE_COMPRESSION       1
 
 
 //------------------------------------------------------------------------------------
@@ -239,6 +244,8 @@
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define MAX_TEXT_RUN_CACHE             64       // Maximum number of cached text runs: DrawTextCached(), MeasureTextCached()
+#define MAX_TEXT_FORMAT_ARENA_SIZE 1048576      // Maximum size of per-thread frame arena for formatted strings: TextFormat()
 
 
 //------------------------------------------------------------------------------------
@@ -264,6 +271,8 @@
 #else
 #define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
 #endif
+#define MAX_GPU_SKINNING_BONES         64       // Maximum bones per mesh supported by default GPU skinning shader
+#define ANIMATION_KEY_TOLERANCE   0.0005f       // Maximum error of animation clip keys interpolation, on keys removal
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -284,6 +293,9 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_COMMANDS              1024    // Maximum number of audio commands queued to mixer (power of two)
+#define MAX_AUDIO_VOICES                  32    // Maximum number of voices mixed at once, exceeding voices are virtualized
+#define SOUND_MAPPED_DATA_SIZE       1048576    // WAV sounds PCM data size (bytes) referenced from mapped file, converted on mixing
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -294,9 +306,14 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Use a pool of worker threads to split heavy CPU work (i.e. mesh skinning, font glyphs rasterization) by ranges
+// NOTE: Requires POSIX threads, on other platforms the work is run on the calling thread
+#define SUPPORT_WORKER_THREADS          1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS              8       // Maximum number of threads in the worker pool
+#define MAX_WORKER_JOBS                64       // Maximum number of jobs queued in the worker pool
 
 #endif // CONFIG_H
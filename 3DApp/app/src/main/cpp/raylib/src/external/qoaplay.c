@@ -41,6 +41,7 @@ typedef struct {
     unsigned char *file_data;       // QOA file data on memory
     unsigned int file_data_size;    // QOA file data on memory size
     unsigned int file_data_offset;  // QOA file data on memory offset for next read
+    int file_data_copy;             // QOA file data on memory is a copy managed internally (freed on closing)
 
     unsigned int first_frame_pos;   // First frame position (after QOA header, required for offset)
     unsigned int sample_position;   // Current streaming sample position
@@ -64,6 +65,7 @@ extern "C" {            // Prevents name mangling of functions
 
 qoaplay_desc *qoaplay_open(const char *path);
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size);
+qoaplay_desc *qoaplay_open_view(const unsigned char *data, int data_size);
 void qoaplay_close(qoaplay_desc *qoa_ctx);
 
 void qoaplay_rewind(qoaplay_desc *qoa_ctx);
@@ -128,6 +130,22 @@ qoaplay_desc *qoaplay_open(const char *path)
 // Open QOA file from memory, no FILE pointer required
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
 {
+    qoaplay_desc *qoa_ctx = qoaplay_open_view(data, data_size);
+    if (!qoa_ctx) return NULL;
+
+    // Keep a copy of file data provided to be managed internally
+    qoa_ctx->file_data = (unsigned char *)QOA_MALLOC(data_size);
+    memcpy(qoa_ctx->file_data, data, data_size);
+    qoa_ctx->file_data_copy = 1;
+
+    return qoa_ctx;
+}
+
+// Open QOA file from memory, file data is not copied (it must be kept valid until closing)
+qoaplay_desc *qoaplay_open_view(const unsigned char *data, int data_size)
+{
+    if (data_size < QOA_MIN_FILESIZE) return NULL;
+
     // Read and decode the file header
     unsigned char header[QOA_MIN_FILESIZE];
     memcpy(header, data, QOA_MIN_FILESIZE);
@@ -145,12 +163,10 @@ qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
     memset(qoa_ctx, 0, sizeof(qoaplay_desc));
 
     qoa_ctx->file = NULL;
-
-    // Keep a copy of file data provided to be managed internally
-    qoa_ctx->file_data = (unsigned char *)QOA_MALLOC(data_size);
-    memcpy(qoa_ctx->file_data, data, data_size);
+    qoa_ctx->file_data = (unsigned char *)data;
     qoa_ctx->file_data_size = data_size;
-    qoa_ctx->file_data_offset = 0;
+    qoa_ctx->file_data_offset = first_frame_pos;
+    qoa_ctx->file_data_copy = 0;
     qoa_ctx->first_frame_pos = first_frame_pos;
 
     // Setup data pointers to previously allocated data
@@ -169,7 +185,7 @@ void qoaplay_close(qoaplay_desc *qoa_ctx)
 {
     if (qoa_ctx->file) fclose(qoa_ctx->file);
 
-    if ((qoa_ctx->file_data) && (qoa_ctx->file_data_size > 0))
+    if ((qoa_ctx->file_data) && qoa_ctx->file_data_copy)
     {
         QOA_FREE(qoa_ctx->file_data);
         qoa_ctx->file_data_size = 0;
@@ -181,16 +197,24 @@ void qoaplay_close(qoaplay_desc *qoa_ctx)
 // Decode one frame from QOA data
 unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 {
-    if (qoa_ctx->file) qoa_ctx->buffer_len = fread(qoa_ctx->buffer, 1, qoa_max_frame_size(&qoa_ctx->info), qoa_ctx->file);
+    unsigned int frame_len = 0;
+
+    if (qoa_ctx->file)
+    {
+        qoa_ctx->buffer_len = fread(qoa_ctx->buffer, 1, qoa_max_frame_size(&qoa_ctx->info), qoa_ctx->file);
+        qoa_decode_frame(qoa_ctx->buffer, qoa_ctx->buffer_len, &qoa_ctx->info, qoa_ctx->sample_data, &frame_len);
+    }
     else
     {
+        // Frame decoded straight from file data, reading up to the end of data
         qoa_ctx->buffer_len = qoa_max_frame_size(&qoa_ctx->info);
-        memcpy(qoa_ctx->buffer, qoa_ctx->file_data + qoa_ctx->file_data_offset, qoa_ctx->buffer_len);
-        qoa_ctx->file_data_offset += qoa_ctx->buffer_len;
+        if (qoa_ctx->file_data_offset >= qoa_ctx->file_data_size) qoa_ctx->buffer_len = 0;
+        else if (qoa_ctx->buffer_len > (qoa_ctx->file_data_size - qoa_ctx->file_data_offset)) qoa_ctx->buffer_len = qoa_ctx->file_data_size - qoa_ctx->file_data_offset;
+
+        unsigned int frame_size = qoa_decode_frame(qoa_ctx->file_data + qoa_ctx->file_data_offset, qoa_ctx->buffer_len, &qoa_ctx->info, qoa_ctx->sample_data, &frame_len);
+        qoa_ctx->file_data_offset += frame_size;
     }
 
-    unsigned int frame_len;
-    qoa_decode_frame(qoa_ctx->buffer, qoa_ctx->buffer_len, &qoa_ctx->info, qoa_ctx->sample_data, &frame_len);
     qoa_ctx->sample_data_pos = 0;
     qoa_ctx->sample_data_len = frame_len;
 
@@ -201,7 +225,7 @@ unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 void qoaplay_rewind(qoaplay_desc *qoa_ctx)
 {
     if (qoa_ctx->file) fseek(qoa_ctx->file, qoa_ctx->first_frame_pos, SEEK_SET);
-    else qoa_ctx->file_data_offset = 0;
+    else qoa_ctx->file_data_offset = qoa_ctx->first_frame_pos;
 
     qoa_ctx->sample_position = 0;
     qoa_ctx->sample_data_len = 0;
@@ -10,6 +10,9 @@
 *     Note that some file formats (DDS, PVR, KTX) also support uncompressed data storage.
 *     In those cases data is loaded uncompressed and format is returned.
 *
+*     Optionally, 4x4 pixels blocks can be compressed and decompressed on CPU, for
+*     DXT1/DXT3/DXT5 (BC1/BC2/BC3) and ETC1/ETC2/EAC formats.
+*
 *   TODO:
 *     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx_to_memory()
 *     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
@@ -23,6 +26,9 @@
 *   #define RL_GPUTEX_SUPPORT_ASTC
 *       Define desired file formats to be supported
 *
+*   #define RL_GPUTEX_SUPPORT_COMPRESSION
+*       Support pixels blocks compression and decompression: rl_compress_block(), rl_decompress_block()
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -68,6 +74,10 @@ RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned in
 
 RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
+// Compress/decompress 4x4 pixels blocks (R8G8B8A8, rows order), DXT1/DXT3/DXT5 and ETC1/ETC2/EAC formats
+RLAPI void rl_compress_block(const unsigned char *rgba, int format, unsigned char *block);
+RLAPI void rl_decompress_block(const unsigned char *block, int format, unsigned char *rgba);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -98,6 +108,25 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 // Get pixel data size in bytes for certain pixel format
 static int get_pixel_data_size(int width, int height, int format);
 
+#if defined(RL_GPUTEX_SUPPORT_COMPRESSION)
+static int clamp_byte(int value);       // Clamp value to byte range [0..255]
+static void get_dxt_color_palette(unsigned short color0, unsigned short color1, int four_colors, int palette[4][3]);
+static int fit_dxt_color_block(const unsigned char *rgba, int transparent_mode, unsigned short *color0, unsigned short *color1, unsigned int *indices);
+static unsigned short quantize_rgb565(const float *color);
+static void compress_dxt_color_block(const unsigned char *rgba, int transparent_mode, unsigned char *block);
+static void decompress_dxt_color_block(const unsigned char *block, int four_colors_only, unsigned char *rgba);
+static void get_dxt5_alpha_palette(int alpha0, int alpha1, int palette[8]);
+static int fit_dxt5_alpha_block(const unsigned char *rgba, int alpha0, int alpha1, unsigned long long *indices);
+static void compress_dxt5_alpha_block(const unsigned char *rgba, unsigned char *block);
+static void decompress_dxt5_alpha_block(const unsigned char *block, unsigned char *rgba);
+static int fit_etc1_subblock(const unsigned char *rgba, int flip, int subblock, const int *base, int *table, unsigned int *indices);
+static void compress_etc1_block(const unsigned char *rgba, unsigned char *block);
+static void decompress_etc2_block(const unsigned char *block, unsigned char *rgba);
+static int fit_eac_alpha_block(const unsigned char *rgba, int base, int multiplier, int table, int max_error, unsigned long long *indices);
+static void compress_eac_alpha_block(const unsigned char *rgba, unsigned char *block);
+static void decompress_eac_alpha_block(const unsigned char *block, unsigned char *rgba);
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -423,7 +452,7 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
     {
         ktx_header *header = (ktx_header *)file_data_ptr;
 
-        if ((header->id[1] != 'K') || (header->id[2] != 'T') || (header->id[3] != 'X') ||
+        if ((file_size < sizeof(ktx_header)) || (header->id[1] != 'K') || (header->id[2] != 'T') || (header->id[3] != 'X') ||
             (header->id[4] != ' ') || (header->id[5] != '1') || (header->id[6] != '1'))
         {
             LOG("WARNING: IMAGE: KTX file data not valid");
@@ -434,22 +463,52 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             *width = header->width;
             *height = header->height;
-            *mips = header->mipmap_levels;
+            *mips = (header->mipmap_levels > 0)? header->mipmap_levels : 1;
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
-
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-            memcpy(image_data, file_data_ptr, data_size);
-
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
             else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            else if (header->gl_internal_format == 0x83F0) *format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+            else if (header->gl_internal_format == 0x83F1) *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+            else if (header->gl_internal_format == 0x83F2) *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+            else if (header->gl_internal_format == 0x83F3) *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+            else if (header->gl_internal_format == 0x93B0) *format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA;
+            else if (header->gl_internal_format == 0x93B7) *format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
 
             // TODO: Support uncompressed data formats? Right now it returns format = 0!
+
+            // Load all mipmap levels data, every level data is preceded by its size
+            // NOTE: Levels data size is padded to 4 bytes (always for compressed formats)
+            const unsigned char *file_data_end = file_data + file_size;
+            const unsigned char *level_ptr = file_data_ptr;
+            int data_size = 0;
+
+            for (int i = 0; i < *mips; i++)
+            {
+                if ((level_ptr + sizeof(unsigned int)) > file_data_end) { *mips = i; break; }
+
+                unsigned int level_size = ((unsigned int *)level_ptr)[0];
+                if ((level_ptr + sizeof(unsigned int) + level_size) > file_data_end) { *mips = i; break; }
+
+                data_size += level_size;
+                level_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+            }
+
+            if (data_size > 0)
+            {
+                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+
+                for (int i = 0, offset = 0; i < *mips; i++)
+                {
+                    unsigned int level_size = ((unsigned int *)file_data_ptr)[0];
+
+                    memcpy((unsigned char *)image_data + offset, file_data_ptr + sizeof(unsigned int), level_size);
+                    offset += level_size;
+                    file_data_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+                }
+            }
         }
     }
 
@@ -483,13 +542,14 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         // KTX 2.0 defines additional header elements...
     } ktx_header;
 
-    // Calculate file data_size required
+    // Calculate file data_size required, every mipmap level data preceded by its size
     int data_size = sizeof(ktx_header);
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
-        w /= 2; h /= 2;
+        data_size += sizeof(unsigned int) + get_pixel_data_size(w, h, format);
+        w = (w > 1)? w/2 : 1;
+        h = (h > 1)? h/2 : 1;
     }
 
     unsigned char *file_data = RL_CALLOC(data_size, 1);
@@ -505,7 +565,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     // Get the image header
     memcpy(header.id, ktx_identifier, 12);  // KTX 1.1 signature
-    header.endianness = 0;
+    header.endianness = 0x04030201;
     header.gl_type = 0;                     // Obtained from format
     header.gl_type_size = 1;
     header.gl_format = 0;                   // Obtained from format
@@ -519,12 +579,28 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     header.key_value_data_size = 0;         // No extra data after the header
 
-    rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
-    header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
+    // Compressed formats tokens defined by extensions, not depending on current GPU support
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: header.gl_internal_format = 0x83F0; header.gl_base_internal_format = 0x1907; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.gl_internal_format = 0x83F1; header.gl_base_internal_format = 0x1908; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.gl_internal_format = 0x83F2; header.gl_base_internal_format = 0x1908; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.gl_internal_format = 0x83F3; header.gl_base_internal_format = 0x1908; break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB: header.gl_internal_format = 0x8D64; header.gl_base_internal_format = 0x1907; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: header.gl_internal_format = 0x9274; header.gl_base_internal_format = 0x1907; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: header.gl_internal_format = 0x9278; header.gl_base_internal_format = 0x1908; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: header.gl_internal_format = 0x93B0; header.gl_base_internal_format = 0x1908; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: header.gl_internal_format = 0x93B7; header.gl_base_internal_format = 0x1908; break;
+        default:
+        {
+            rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
+            header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
+        } break;
+    }
 
     // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
 
-    if (header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
+    if ((int)header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
     else
     {
         memcpy(file_data_ptr, &header, sizeof(ktx_header));
@@ -542,8 +618,8 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
             memcpy(file_data_ptr, &data_size, sizeof(unsigned int));
             memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
 
-            temp_width /= 2;
-            temp_height /= 2;
+            temp_width = (temp_width > 1)? temp_width/2 : 1;
+            temp_height = (temp_height > 1)? temp_height/2 : 1;
             data_offset += data_size;
             file_data_ptr += (4 + data_size);
         }
@@ -558,7 +634,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), data_size, file);
 
         if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
-        else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+        else if (count != (unsigned int)data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
         else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
 
         int result = fclose(file);
@@ -776,6 +852,87 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
 }
 #endif
 
+#if defined(RL_GPUTEX_SUPPORT_COMPRESSION)
+// ETC1 intensity modifiers tables (small and large modifiers, applied positive or negative)
+static const int etc1_modifier_table[8][2] = {
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+// ETC2 T and H modes distance table
+static const int etc2_distance_table[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// EAC alpha modifiers tables
+static const int eac_modifier_table[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+// Compress 4x4 pixels block (R8G8B8A8, rows order) into GPU compressed format block
+// NOTE: Supported formats: DXT1_RGB, DXT1_RGBA, DXT3_RGBA, DXT5_RGBA, ETC1_RGB, ETC2_RGB, ETC2_EAC_RGBA
+void rl_compress_block(const unsigned char *rgba, int format, unsigned char *block)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: compress_dxt_color_block(rgba, 0, block); break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: compress_dxt_color_block(rgba, 1, block); break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        {
+            // Explicit 4-bit alpha, pixels in rows order, low nibble first
+            for (int i = 0; i < 8; i++) block[i] = (unsigned char)(((rgba[i*8 + 3]*15 + 127)/255) | (((rgba[i*8 + 7]*15 + 127)/255) << 4));
+            compress_dxt_color_block(rgba, 0, block + 8);
+        } break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        {
+            compress_dxt5_alpha_block(rgba, block);
+            compress_dxt_color_block(rgba, 0, block + 8);
+        } break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: compress_etc1_block(rgba, block); break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        {
+            compress_eac_alpha_block(rgba, block);
+            compress_etc1_block(rgba, block + 8);
+        } break;
+        default: break;
+    }
+}
+
+// Decompress GPU compressed format block into 4x4 pixels block (R8G8B8A8, rows order)
+// NOTE: Supported formats: DXT1_RGB, DXT1_RGBA, DXT3_RGBA, DXT5_RGBA, ETC1_RGB, ETC2_RGB, ETC2_EAC_RGBA
+void rl_decompress_block(const unsigned char *block, int format, unsigned char *rgba)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        {
+            decompress_dxt_color_block(block, 0, rgba);
+            for (int i = 0; i < 16; i++) rgba[i*4 + 3] = 255;     // Black pixels are opaque
+        } break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: decompress_dxt_color_block(block, 0, rgba); break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        {
+            decompress_dxt_color_block(block + 8, 1, rgba);
+            for (int i = 0; i < 16; i++) rgba[i*4 + 3] = (unsigned char)(((block[i/2] >> ((i%2)*4)) & 0x0f)*17);
+        } break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        {
+            decompress_dxt_color_block(block + 8, 1, rgba);
+            decompress_dxt5_alpha_block(block, rgba);
+        } break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: decompress_etc2_block(block, rgba); break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        {
+            decompress_etc2_block(block + 8, rgba);
+            decompress_eac_alpha_block(block, rgba);
+        } break;
+        default: break;
+    }
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -813,14 +970,727 @@ static int get_pixel_data_size(int width, int height, int format)
 
     data_size = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks (ASTC 8x8 on 8x8 blocks),
+    // data size is rounded up to full blocks (PVRT minimum data size is 16)
+    if (((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)) data_size = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) data_size = ((width + 7)/8)*((height + 7)/8)*16;
+    else if ((format >= PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) data_size = 16;
+
+    return data_size;
+}
+
+#if defined(RL_GPUTEX_SUPPORT_COMPRESSION)
+// Clamp value to byte range [0..255]
+static int clamp_byte(int value)
+{
+    return (value < 0)? 0 : ((value > 255)? 255 : value);
+}
+
+// Get DXT color block palette from RGB565 endpoints
+// NOTE: Three colors mode palette includes transparent black (index 3)
+static void get_dxt_color_palette(unsigned short color0, unsigned short color1, int four_colors, int palette[4][3])
+{
+    unsigned short colors[2] = { color0, color1 };
+
+    for (int i = 0; i < 2; i++)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
+        int r = colors[i] >> 11;
+        int g = (colors[i] >> 5) & 0x3f;
+        int b = colors[i] & 0x1f;
+
+        palette[i][0] = (r << 3) | (r >> 2);
+        palette[i][1] = (g << 2) | (g >> 4);
+        palette[i][2] = (b << 3) | (b >> 2);
     }
 
-    return data_size;
+    for (int c = 0; c < 3; c++)
+    {
+        if (four_colors)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+    }
 }
+
+// Fit pixels to DXT color block endpoints, returns squared error and 2-bit indices (rows order)
+// NOTE: Endpoints are ordered for block mode: four colors mode (color0 > color1) or
+// three colors mode (color0 <= color1), used for transparent pixels (alpha < 128, index 3)
+static int fit_dxt_color_block(const unsigned char *rgba, int transparent_mode, unsigned short *color0, unsigned short *color1, unsigned int *indices)
+{
+    if ((!transparent_mode && (*color0 < *color1)) || (transparent_mode && (*color0 > *color1)))
+    {
+        unsigned short color = *color0;
+        *color0 = *color1;
+        *color1 = color;
+    }
+
+    // NOTE: Equal endpoints in four colors mode get all indices 0, valid for both modes
+    int palette[4][3] = { 0 };
+    get_dxt_color_palette(*color0, *color1, !transparent_mode, palette);
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        const unsigned char *pixel = rgba + i*4;
+        int best = 3;
+        int best_error = 0;
+
+        if (!transparent_mode || (pixel[3] >= 128))
+        {
+            best_error = 0x7fffffff;
+
+            for (int k = 0; k < (transparent_mode? 3 : 4); k++)
+            {
+                int dr = palette[k][0] - pixel[0];
+                int dg = palette[k][1] - pixel[1];
+                int db = palette[k][2] - pixel[2];
+                int pixel_error = dr*dr + dg*dg + db*db;
+
+                if (pixel_error < best_error) { best = k; best_error = pixel_error; }
+            }
+        }
+
+        error += best_error;
+        *indices |= (unsigned int)best << (i*2);
+    }
+
+    return error;
+}
+
+// Quantize color (floats, [0..255]) to RGB565
+static unsigned short quantize_rgb565(const float *color)
+{
+    int channels[3] = { 0 };
+    const int max[3] = { 31, 63, 31 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        float value = (color[c] < 0.0f)? 0.0f : ((color[c] > 255.0f)? 255.0f : color[c]);
+        channels[c] = (int)(value*max[c]/255.0f + 0.5f);
+    }
+
+    return (unsigned short)((channels[0] << 11) | (channels[1] << 5) | channels[2]);
+}
+
+// Compress 4x4 pixels colors into DXT color block (RGB565 endpoints, 2-bit indices)
+// NOTE: Endpoints are set on colors principal axis extremes and refined by least squares fitting,
+// three colors mode only used if transparent mode is requested and block has transparent pixels
+static void compress_dxt_color_block(const unsigned char *rgba, int transparent_mode, unsigned char *block)
+{
+    float mean[3] = { 0 };
+    int count = 0;
+    int transparent = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparent_mode && (rgba[i*4 + 3] < 128)) { transparent = 1; continue; }
+
+        for (int c = 0; c < 3; c++) mean[c] += rgba[i*4 + c];
+        count++;
+    }
+
+    transparent_mode = transparent;
+
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+    unsigned int indices = 0xffffffff;      // All pixels transparent
+
+    if (count > 0)
+    {
+        for (int c = 0; c < 3; c++) mean[c] /= count;
+
+        // Colors covariance matrix (rr, rg, rb, gg, gb, bb)
+        float cov[6] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent_mode && (rgba[i*4 + 3] < 128)) continue;
+
+            float r = rgba[i*4] - mean[0];
+            float g = rgba[i*4 + 1] - mean[1];
+            float b = rgba[i*4 + 2] - mean[2];
+
+            cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+            cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+        }
+
+        // Principal axis by power iteration, normalized by max component
+        float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+        for (int k = 0; k < 8; k++)
+        {
+            float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+            float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+            float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+
+            float max = (x < 0.0f)? -x : x;
+            if (((y < 0.0f)? -y : y) > max) max = (y < 0.0f)? -y : y;
+            if (((z < 0.0f)? -z : z) > max) max = (z < 0.0f)? -z : z;
+
+            if (max == 0.0f) break;
+
+            axis[0] = x/max; axis[1] = y/max; axis[2] = z/max;
+        }
+
+        float length = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+        float tmin = 0.0f;
+        float tmax = 0.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent_mode && (rgba[i*4 + 3] < 128)) continue;
+
+            float t = ((rgba[i*4] - mean[0])*axis[0] + (rgba[i*4 + 1] - mean[1])*axis[1] + (rgba[i*4 + 2] - mean[2])*axis[2])/length;
+
+            if (t < tmin) tmin = t;
+            if (t > tmax) tmax = t;
+        }
+
+        float endpoint0[3] = { mean[0] + axis[0]*tmax, mean[1] + axis[1]*tmax, mean[2] + axis[2]*tmax };
+        float endpoint1[3] = { mean[0] + axis[0]*tmin, mean[1] + axis[1]*tmin, mean[2] + axis[2]*tmin };
+
+        color0 = quantize_rgb565(endpoint0);
+        color1 = quantize_rgb565(endpoint1);
+        int error = fit_dxt_color_block(rgba, transparent_mode, &color0, &color1, &indices);
+
+        // Endpoints refinement: least squares fitting of pixels to current indices
+        // NOTE: Palette index weights of color0 (color1 weight is 1 - weight)
+        const float weights[2][4] = { { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f }, { 1.0f, 0.0f, 0.5f, 0.0f } };
+
+        for (int iteration = 0; (iteration < 2) && (error > 0); iteration++)
+        {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ax[3] = { 0 }, bx[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                int index = (indices >> (i*2)) & 3;
+                if (transparent_mode && (index == 3)) continue;
+
+                float a = weights[transparent_mode][index];
+                float b = 1.0f - a;
+
+                aa += a*a; ab += a*b; bb += b*b;
+                for (int c = 0; c < 3; c++) { ax[c] += a*rgba[i*4 + c]; bx[c] += b*rgba[i*4 + c]; }
+            }
+
+            float det = aa*bb - ab*ab;
+            if ((det < 1e-6f) && (det > -1e-6f)) break;
+
+            for (int c = 0; c < 3; c++)
+            {
+                endpoint0[c] = (ax[c]*bb - bx[c]*ab)/det;
+                endpoint1[c] = (bx[c]*aa - ax[c]*ab)/det;
+            }
+
+            unsigned short refined0 = quantize_rgb565(endpoint0);
+            unsigned short refined1 = quantize_rgb565(endpoint1);
+            unsigned int refined_indices = 0;
+            int refined_error = fit_dxt_color_block(rgba, transparent_mode, &refined0, &refined1, &refined_indices);
+
+            if (refined_error >= error) break;
+
+            color0 = refined0;
+            color1 = refined1;
+            indices = refined_indices;
+            error = refined_error;
+        }
+    }
+
+    block[0] = (unsigned char)(color0 & 0xff);
+    block[1] = (unsigned char)(color0 >> 8);
+    block[2] = (unsigned char)(color1 & 0xff);
+    block[3] = (unsigned char)(color1 >> 8);
+    for (int k = 0; k < 4; k++) block[4 + k] = (unsigned char)((indices >> (k*8)) & 0xff);
+}
+
+// Decompress DXT color block into 4x4 pixels (RGB and alpha)
+// NOTE: DXT3/DXT5 color blocks are always decoded in four colors mode
+static void decompress_dxt_color_block(const unsigned char *block, int four_colors_only, unsigned char *rgba)
+{
+    unsigned short color0 = (unsigned short)(block[0] | (block[1] << 8));
+    unsigned short color1 = (unsigned short)(block[2] | (block[3] << 8));
+    unsigned int indices = (unsigned int)block[4] | ((unsigned int)block[5] << 8) | ((unsigned int)block[6] << 16) | ((unsigned int)block[7] << 24);
+    int four_colors = four_colors_only || (color0 > color1);
+
+    int palette[4][3] = { 0 };
+    get_dxt_color_palette(color0, color1, four_colors, palette);
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (indices >> (i*2)) & 3;
+
+        rgba[i*4] = (unsigned char)palette[index][0];
+        rgba[i*4 + 1] = (unsigned char)palette[index][1];
+        rgba[i*4 + 2] = (unsigned char)palette[index][2];
+        rgba[i*4 + 3] = (!four_colors && (index == 3))? 0 : 255;
+    }
+}
+
+// Get DXT5 alpha block palette from endpoints
+// NOTE: Six values mode (alpha0 <= alpha1) includes 0 and 255
+static void get_dxt5_alpha_palette(int alpha0, int alpha1, int palette[8])
+{
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+
+    if (alpha0 > alpha1)
+    {
+        for (int k = 1; k < 7; k++) palette[k + 1] = ((7 - k)*alpha0 + k*alpha1)/7;
+    }
+    else
+    {
+        for (int k = 1; k < 5; k++) palette[k + 1] = ((5 - k)*alpha0 + k*alpha1)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Fit pixels alpha to DXT5 alpha block endpoints, returns squared error and 3-bit indices (rows order)
+static int fit_dxt5_alpha_block(const unsigned char *rgba, int alpha0, int alpha1, unsigned long long *indices)
+{
+    int palette[8] = { 0 };
+    get_dxt5_alpha_palette(alpha0, alpha1, palette);
+
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 0;
+        int best_error = 0x7fffffff;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int pixel_error = (palette[k] - rgba[i*4 + 3])*(palette[k] - rgba[i*4 + 3]);
+            if (pixel_error < best_error) { best = k; best_error = pixel_error; }
+        }
+
+        error += best_error;
+        *indices |= (unsigned long long)best << (i*3);
+    }
+
+    return error;
+}
+
+// Compress 4x4 pixels alpha into DXT5 alpha block (8-bit endpoints, 3-bit indices)
+// NOTE: Eight values mode on alpha range is compared with six values mode on
+// alpha range excluding 0 and 255 (exact values in that mode)
+static void compress_dxt5_alpha_block(const unsigned char *rgba, unsigned char *block)
+{
+    int min = 255, max = 0;
+    int min6 = 255, max6 = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int alpha = rgba[i*4 + 3];
+
+        if (alpha < min) min = alpha;
+        if (alpha > max) max = alpha;
+        if ((alpha > 0) && (alpha < 255))
+        {
+            if (alpha < min6) min6 = alpha;
+            if (alpha > max6) max6 = alpha;
+        }
+    }
+
+    if (min6 > max6) { min6 = 0; max6 = 0; }    // Only 0 and 255 values
+
+    int alpha0 = min6;
+    int alpha1 = max6;
+    unsigned long long indices = 0;
+    int error = fit_dxt5_alpha_block(rgba, alpha0, alpha1, &indices);
+
+    if ((error > 0) && (max > min))
+    {
+        unsigned long long indices8 = 0;
+        int error8 = fit_dxt5_alpha_block(rgba, max, min, &indices8);
+
+        if (error8 < error) { alpha0 = max; alpha1 = min; indices = indices8; }
+    }
+
+    block[0] = (unsigned char)alpha0;
+    block[1] = (unsigned char)alpha1;
+    for (int k = 0; k < 6; k++) block[2 + k] = (unsigned char)((indices >> (k*8)) & 0xff);
+}
+
+// Decompress DXT5 alpha block into 4x4 pixels alpha
+static void decompress_dxt5_alpha_block(const unsigned char *block, unsigned char *rgba)
+{
+    int palette[8] = { 0 };
+    get_dxt5_alpha_palette(block[0], block[1], palette);
+
+    unsigned long long indices = 0;
+    for (int k = 0; k < 6; k++) indices |= (unsigned long long)block[2 + k] << (k*8);
+
+    for (int i = 0; i < 16; i++) rgba[i*4 + 3] = (unsigned char)palette[(indices >> (i*3)) & 7];
+}
+
+// Fit ETC1 subblock pixels to base color, returns squared error, modifiers table and pixels indices bits
+// NOTE: Pixels indices are in columns order, most significant bits in high half
+static int fit_etc1_subblock(const unsigned char *rgba, int flip, int subblock, const int *base, int *table, unsigned int *indices)
+{
+    int best_error = 0x7fffffff;
+
+    for (int t = 0; t < 8; t++)
+    {
+        int error = 0;
+        unsigned int bits = 0;
+
+        for (int i = 0; (i < 16) && (error < best_error); i++)
+        {
+            int x = i%4;
+            int y = i/4;
+
+            if ((flip? (y/2) : (x/2)) != subblock) continue;
+
+            const unsigned char *pixel = rgba + i*4;
+            int best = 0;
+            int best_pixel_error = 0x7fffffff;
+
+            for (int k = 0; k < 4; k++)
+            {
+                // Index least significant bit selects large modifier, most significant bit negative modifier
+                int modifier = etc1_modifier_table[t][k & 1];
+                if (k & 2) modifier = -modifier;
+
+                int dr = clamp_byte(base[0] + modifier) - pixel[0];
+                int dg = clamp_byte(base[1] + modifier) - pixel[1];
+                int db = clamp_byte(base[2] + modifier) - pixel[2];
+                int pixel_error = dr*dr + dg*dg + db*db;
+
+                if (pixel_error < best_pixel_error) { best = k; best_pixel_error = pixel_error; }
+            }
+
+            error += best_pixel_error;
+            bits |= ((unsigned int)(best >> 1) << (16 + x*4 + y)) | ((unsigned int)(best & 1) << (x*4 + y));
+        }
+
+        if (error < best_error)
+        {
+            best_error = error;
+            *table = t;
+            *indices = bits;
+        }
+    }
+
+    return best_error;
+}
+
+// Compress 4x4 pixels colors into ETC1 block (two subblocks, individual or differential base colors)
+// NOTE: Base colors are subblocks average colors, flipped and not flipped subblocks tried on both modes,
+// block is also a valid ETC2 block (differential mode never overflows, T, H and planar modes not used)
+static void compress_etc1_block(const unsigned char *rgba, unsigned char *block)
+{
+    unsigned int best_high = 0;
+    unsigned int best_low = 0;
+    int best_error = 0x7fffffff;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        float average[2][3] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int subblock = flip? (i/4)/2 : (i%4)/2;
+            for (int c = 0; c < 3; c++) average[subblock][c] += rgba[i*4 + c]/8.0f;
+        }
+
+        int table[2] = { 0 };
+        unsigned int indices[2] = { 0 };
+        int color[2][3] = { 0 };
+
+        // Individual mode: 4-bit base colors
+        int base4[2][3] = { 0 };
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                base4[s][c] = (int)(average[s][c]*15.0f/255.0f + 0.5f);
+                color[s][c] = base4[s][c]*17;
+            }
+        }
+
+        int error = fit_etc1_subblock(rgba, flip, 0, color[0], &table[0], &indices[0]);
+        if (error < best_error) error += fit_etc1_subblock(rgba, flip, 1, color[1], &table[1], &indices[1]);
+
+        if (error < best_error)
+        {
+            best_error = error;
+            best_high = ((unsigned int)base4[0][0] << 28) | ((unsigned int)base4[1][0] << 24) | ((unsigned int)base4[0][1] << 20) |
+                        ((unsigned int)base4[1][1] << 16) | ((unsigned int)base4[0][2] << 12) | ((unsigned int)base4[1][2] << 8) |
+                        ((unsigned int)table[0] << 5) | ((unsigned int)table[1] << 2) | (unsigned int)flip;
+            best_low = indices[0] | indices[1];
+        }
+
+        // Differential mode: 5-bit base colors, second one as 3-bit signed difference [-4..3]
+        int base5[3] = { 0 };
+        int delta[3] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            base5[c] = (int)(average[0][c]*31.0f/255.0f + 0.5f);
+            delta[c] = (int)(average[1][c]*31.0f/255.0f + 0.5f) - base5[c];
+            if (delta[c] < -4) delta[c] = -4;
+            else if (delta[c] > 3) delta[c] = 3;
+
+            color[0][c] = (base5[c] << 3) | (base5[c] >> 2);
+            color[1][c] = ((base5[c] + delta[c]) << 3) | ((base5[c] + delta[c]) >> 2);
+        }
+
+        error = fit_etc1_subblock(rgba, flip, 0, color[0], &table[0], &indices[0]);
+        if (error < best_error) error += fit_etc1_subblock(rgba, flip, 1, color[1], &table[1], &indices[1]);
+
+        if (error < best_error)
+        {
+            best_error = error;
+            best_high = ((unsigned int)base5[0] << 27) | ((unsigned int)(delta[0] & 7) << 24) | ((unsigned int)base5[1] << 19) |
+                        ((unsigned int)(delta[1] & 7) << 16) | ((unsigned int)base5[2] << 11) | ((unsigned int)(delta[2] & 7) << 8) |
+                        ((unsigned int)table[0] << 5) | ((unsigned int)table[1] << 2) | 2u | (unsigned int)flip;
+            best_low = indices[0] | indices[1];
+        }
+    }
+
+    for (int k = 0; k < 4; k++)
+    {
+        block[k] = (unsigned char)((best_high >> (24 - k*8)) & 0xff);
+        block[4 + k] = (unsigned char)((best_low >> (24 - k*8)) & 0xff);
+    }
+}
+
+// Decompress ETC2 block (including ETC1 blocks) into 4x4 pixels (RGB, opaque alpha)
+// NOTE: ETC2 T, H and planar modes are encoded as differential mode overflows
+static void decompress_etc2_block(const unsigned char *block, unsigned char *rgba)
+{
+    unsigned int high = ((unsigned int)block[0] << 24) | ((unsigned int)block[1] << 16) | ((unsigned int)block[2] << 8) | (unsigned int)block[3];
+    unsigned int low = ((unsigned int)block[4] << 24) | ((unsigned int)block[5] << 16) | ((unsigned int)block[6] << 8) | (unsigned int)block[7];
+
+    int base[2][3] = { 0 };         // Subblocks base colors (individual and differential modes)
+    int paint[4][3] = { 0 };        // Paint colors (T and H modes)
+    int mode = 0;                   // 0: Individual/differential, 1: T or H, 2: planar
+
+    if (((high >> 1) & 1) == 0)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            base[0][c] = ((high >> (28 - c*8)) & 0x0f)*17;
+            base[1][c] = ((high >> (24 - c*8)) & 0x0f)*17;
+        }
+    }
+    else
+    {
+        int channels[3] = { 0 };
+        int deltas[3] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            channels[c] = (high >> (27 - c*8)) & 0x1f;
+            deltas[c] = (high >> (24 - c*8)) & 0x07;
+            if (deltas[c] & 4) deltas[c] -= 8;
+        }
+
+        if (((channels[0] + deltas[0]) < 0) || ((channels[0] + deltas[0]) > 31))
+        {
+            // T mode
+            int color0[3] = { ((((high >> 27) & 3) << 2) | ((high >> 24) & 3))*17, ((high >> 20) & 0x0f)*17, ((high >> 16) & 0x0f)*17 };
+            int color1[3] = { ((high >> 12) & 0x0f)*17, ((high >> 8) & 0x0f)*17, ((high >> 4) & 0x0f)*17 };
+            int distance = etc2_distance_table[(((high >> 2) & 3) << 1) | (high & 1)];
+
+            for (int c = 0; c < 3; c++)
+            {
+                paint[0][c] = color0[c];
+                paint[1][c] = clamp_byte(color1[c] + distance);
+                paint[2][c] = color1[c];
+                paint[3][c] = clamp_byte(color1[c] - distance);
+            }
+
+            mode = 1;
+        }
+        else if (((channels[1] + deltas[1]) < 0) || ((channels[1] + deltas[1]) > 31))
+        {
+            // H mode
+            int color0[3] = { (high >> 27) & 0x0f, (((high >> 24) & 7) << 1) | ((high >> 20) & 1), (((high >> 19) & 1) << 3) | ((high >> 15) & 7) };
+            int color1[3] = { (high >> 11) & 0x0f, (high >> 7) & 0x0f, (high >> 3) & 0x0f };
+            int order = (((color0[0] << 8) | (color0[1] << 4) | color0[2]) >= ((color1[0] << 8) | (color1[1] << 4) | color1[2]))? 1 : 0;
+            int distance = etc2_distance_table[(((high >> 2) & 1) << 2) | ((high & 1) << 1) | order];
+
+            for (int c = 0; c < 3; c++)
+            {
+                paint[0][c] = clamp_byte(color0[c]*17 + distance);
+                paint[1][c] = clamp_byte(color0[c]*17 - distance);
+                paint[2][c] = clamp_byte(color1[c]*17 + distance);
+                paint[3][c] = clamp_byte(color1[c]*17 - distance);
+            }
+
+            mode = 1;
+        }
+        else if (((channels[2] + deltas[2]) < 0) || ((channels[2] + deltas[2]) > 31)) mode = 2;
+        else
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                base[0][c] = (channels[c] << 3) | (channels[c] >> 2);
+                base[1][c] = ((channels[c] + deltas[c]) << 3) | ((channels[c] + deltas[c]) >> 2);
+            }
+        }
+    }
+
+    if (mode == 2)
+    {
+        // Planar mode: origin, horizontal and vertical colors (RGB676) interpolated
+        unsigned long long bits = ((unsigned long long)high << 32) | low;
+
+        int ro = (int)((bits >> 57) & 0x3f);
+        int go = (int)((((bits >> 56) & 1) << 6) | ((bits >> 49) & 0x3f));
+        int bo = (int)((((bits >> 48) & 1) << 5) | (((bits >> 43) & 3) << 3) | ((bits >> 39) & 7));
+        int rh = (int)((((bits >> 34) & 0x1f) << 1) | ((bits >> 32) & 1));
+        int gh = (int)((bits >> 25) & 0x7f);
+        int bh = (int)((bits >> 19) & 0x3f);
+        int rv = (int)((bits >> 13) & 0x3f);
+        int gv = (int)((bits >> 6) & 0x7f);
+        int bv = (int)(bits & 0x3f);
+
+        int origin[3] = { (ro << 2) | (ro >> 4), (go << 1) | (go >> 6), (bo << 2) | (bo >> 4) };
+        int horizontal[3] = { (rh << 2) | (rh >> 4), (gh << 1) | (gh >> 6), (bh << 2) | (bh >> 4) };
+        int vertical[3] = { (rv << 2) | (rv >> 4), (gv << 1) | (gv >> 6), (bv << 2) | (bv >> 4) };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int x = i%4;
+            int y = i/4;
+
+            for (int c = 0; c < 3; c++) rgba[i*4 + c] = (unsigned char)clamp_byte((x*(horizontal[c] - origin[c]) + y*(vertical[c] - origin[c]) + 4*origin[c] + 2) >> 2);
+            rgba[i*4 + 3] = 255;
+        }
+    }
+    else
+    {
+        int flip = high & 1;
+        int tables[2] = { (high >> 5) & 7, (high >> 2) & 7 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int x = i%4;
+            int y = i/4;
+            int msb = (low >> (16 + x*4 + y)) & 1;
+            int lsb = (low >> (x*4 + y)) & 1;
+
+            for (int c = 0; c < 3; c++)
+            {
+                if (mode == 1) rgba[i*4 + c] = (unsigned char)paint[(msb << 1) | lsb][c];
+                else
+                {
+                    int subblock = flip? (y/2) : (x/2);
+                    int modifier = etc1_modifier_table[tables[subblock]][lsb];
+
+                    rgba[i*4 + c] = (unsigned char)clamp_byte(base[subblock][c] + (msb? -modifier : modifier));
+                }
+            }
+
+            rgba[i*4 + 3] = 255;
+        }
+    }
+}
+
+// Fit pixels alpha to EAC block parameters, returns squared error and 3-bit indices (columns order, first pixel in high bits)
+// NOTE: Fitting stops once error reaches max error
+static int fit_eac_alpha_block(const unsigned char *rgba, int base, int multiplier, int table, int max_error, unsigned long long *indices)
+{
+    int error = 0;
+    *indices = 0;
+
+    for (int i = 0; (i < 16) && (error < max_error); i++)
+    {
+        int best = 0;
+        int best_error = 0x7fffffff;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int delta = clamp_byte(base + eac_modifier_table[table][k]*multiplier) - rgba[i*4 + 3];
+            if (delta*delta < best_error) { best = k; best_error = delta*delta; }
+        }
+
+        error += best_error;
+        *indices |= (unsigned long long)best << (45 - 3*((i%4)*4 + i/4));
+    }
+
+    return error;
+}
+
+// Compress 4x4 pixels alpha into EAC block (base codeword, multiplier, modifiers table, 3-bit indices)
+// NOTE: Constant alpha is encoded exactly (table 13 includes zero modifier), otherwise
+// every table is tried with multipliers covering alpha range, centered on range
+static void compress_eac_alpha_block(const unsigned char *rgba, unsigned char *block)
+{
+    int min = 255, max = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (rgba[i*4 + 3] < min) min = rgba[i*4 + 3];
+        if (rgba[i*4 + 3] > max) max = rgba[i*4 + 3];
+    }
+
+    int best_base = min;
+    int best_multiplier = 1;
+    int best_table = 13;
+    unsigned long long best_indices = 0;
+    int best_error = fit_eac_alpha_block(rgba, min, 1, 13, 0x7fffffff, &best_indices);
+
+    for (int t = 0; (t < 16) && (best_error > 0); t++)
+    {
+        int low = eac_modifier_table[t][3];
+        int high = eac_modifier_table[t][7];
+        int multiplier = ((max - min) + (high - low)/2)/(high - low);
+
+        for (int m = multiplier - 1; m <= multiplier + 1; m++)
+        {
+            if ((m < 1) || (m > 15)) continue;
+
+            int base = clamp_byte((min + max + 1)/2 - ((low + high)*m)/2);
+            unsigned long long indices = 0;
+            int error = fit_eac_alpha_block(rgba, base, m, t, best_error, &indices);
+
+            if (error < best_error)
+            {
+                best_error = error;
+                best_base = base;
+                best_multiplier = m;
+                best_table = t;
+                best_indices = indices;
+            }
+        }
+    }
+
+    block[0] = (unsigned char)best_base;
+    block[1] = (unsigned char)((best_multiplier << 4) | best_table);
+    for (int k = 0; k < 6; k++) block[2 + k] = (unsigned char)((best_indices >> (40 - k*8)) & 0xff);
+}
+
+// Decompress EAC block into 4x4 pixels alpha
+static void decompress_eac_alpha_block(const unsigned char *block, unsigned char *rgba)
+{
+    int base = block[0];
+    int multiplier = block[1] >> 4;
+    int table = block[1] & 0x0f;
+
+    unsigned long long indices = 0;
+    for (int k = 0; k < 6; k++) indices = (indices << 8) | block[2 + k];
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (int)((indices >> (45 - 3*((i%4)*4 + i/4))) & 7);
+        rgba[i*4 + 3] = (unsigned char)clamp_byte(base + eac_modifier_table[table][index]*multiplier);
+    }
+}
+#endif
 #endif // RL_GPUTEX_IMPLEMENTATION
@@ -282,6 +282,15 @@ typedef struct tagBITMAPINFOHEADER {
     #include "external/jar_mod.h"       // MOD loading functions
 #endif
 
+// SIMD instructions set used on audio mixing [MixAudioFrames()]
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: float32x4_t, vmlaq_f32(), vld1q_f32()...
+    #define MIXING_SIMD_NEON
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>      // Required for: __m128, _mm_mul_ps(), _mm_add_ps(), _mm_loadu_ps()...
+    #define MIXING_SIMD_SSE
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -298,6 +307,35 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS              1024    // Audio commands queued to mixer (power of two)
+#endif
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                  32    // Maximum number of voices mixed at once, exceeding voices are virtualized
+#endif
+#ifndef AUDIO_VOICE_AUDIBLE_VOLUME
+    #define AUDIO_VOICE_AUDIBLE_VOLUME    0.001f    // Minimum voice volume to be mixed, quieter voices are virtualized
+#endif
+#ifndef AUDIO_STREAM_PRIORITY
+    #define AUDIO_STREAM_PRIORITY            100    // Audio streams (and music) default priority, sounds default priority is 0
+#endif
+#ifndef SOUND_MAPPED_DATA_SIZE
+    #define SOUND_MAPPED_DATA_SIZE       1048576    // WAV sounds PCM data size (bytes) referenced from mapped file, converted on mixing
+#endif
+
+#ifndef MUSIC_DECODER_CHUNK_FRAMES
+    #define MUSIC_DECODER_CHUNK_FRAMES      4096    // Music frames decoded at once by decoding thread
+#endif
+#ifndef MUSIC_DECODER_SLEEP_TIME
+    #define MUSIC_DECODER_SLEEP_TIME           4    // Decoding thread sleep time while music buffers are full (milliseconds)
+#endif
+
+#define AUDIO_STREAM_RESTART          0x04      // Audio stream sub-buffers state flag: restart from first sub-buffer
+
+// Music decoding thread requires threads and sleeping, not available on web
+#if !defined(__EMSCRIPTEN__) && !defined(MA_NO_THREADING)
+    #define MUSIC_DECODING_THREAD
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -315,6 +353,14 @@ typedef enum {
     LOG_FATAL,          // Fatal logging, used to abort program: exit(EXIT_FAILURE)
     LOG_NONE            // Disable logging
 } TraceLogLevel;
+
+// File view, file data loaded (no mapping available on standalone module)
+typedef struct FileView {
+    const unsigned char *data;      // File data (read-only)
+    int dataSize;                   // File data size in bytes
+    bool mapped;                    // File data is mapped, not loaded
+    void *handle;                   // Platform handle, NULL if not required
+} FileView;
 #endif
 
 // Music context type
@@ -338,6 +384,29 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Music decoder, keeps a ring buffer of music frames decoded ahead of playback by decoding thread
+// NOTE: Single producer (decoding thread), single consumer (mixer) ring, positions wrap around
+typedef struct MusicDecoder {
+    Music music;                    // Music decoded (audio context, only accessed by decoding thread)
+    unsigned char *data;            // Ring buffer decoded frames (stream format)
+    unsigned int sizeInFrames;      // Ring buffer size in frames (power of two)
+    unsigned int frameSize;         // Frame size in bytes
+    unsigned int position;          // Music frame to be decoded next (decoding thread)
+
+    ma_uint32 writePos;             // Ring position written by decoding thread (atomic)
+    ma_uint32 readPos;              // Ring position read by mixer (atomic)
+    ma_uint64 flush;                // Ring position (low bits) and music frame (high bits) after last seek (atomic)
+    ma_uint32 seekRequest;          // Music frame requested to seek plus one, 0 if no request pending (atomic)
+    ma_uint32 looping;              // Music looping, updated by API functions (atomic)
+    ma_uint32 ended;                // Music decoded up to last frame, not looping (atomic)
+
+    ma_uint32 underruns;            // Times mixer ran out of decoded frames (atomic)
+    ma_uint32 decodeTime;           // Decoding time accumulated (microseconds, atomic)
+    ma_uint32 decodedFrames;        // Frames decoded accumulated (atomic)
+
+    struct MusicDecoder *next;      // Next music decoder on decoding thread list
+} MusicDecoder;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -349,20 +418,42 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
+    ma_uint32 playing;              // Audio buffer state: AUDIO_PLAYING (atomic, cleared by mixer when playback ends)
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 subBufferState;       // SubBuffers processed flags (virtual double buffer) and AUDIO_STREAM_RESTART (atomic)
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    FileView view;                  // File view audio data is read from (music file or sound PCM data), unloaded along the buffer
+    bool dataMapped;                // Data buffer references file view data (sound PCM data mapped from file), not allocated
+    MusicDecoder *decoder;          // Music decoder, if music is decoded on decoding thread
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
+
+    // Mixer state, only accessed by audio thread, updated from commands queue
+    float mixVolume;                // Audio buffer volume applied on mixing
+    float mixPan;                   // Audio buffer pan applied on mixing
+    float mixPitch;                 // Audio buffer pitch applied on mixing
+    ma_uint32 mixFraction;          // Frame cursor position fractional part (0.32 fixed point), resampled buffers
+    bool mixDirect;                 // Audio buffer data is in mixing format, read without converter [ReadAudioBufferFramesResampled()]
+    bool mixPlaying;                // Audio buffer is mixed, not stopped
+    bool mixPaused;                 // Audio buffer is paused on mixer
+    ma_uint32 mixing;               // Audio buffer is on mixer voices list (atomic, checked on unloading)
+    unsigned int commandIndex;      // Index of last command queued for this buffer (checked on unloading)
+    bool unloadData;                // Audio buffer data is unloaded along the buffer (not shared with aliases)
+    MusicDecoder *mixDecoder;       // Music decoder frames are read from, instead of data buffer
+    int mixPriority;                // Audio buffer priority, lowest priority voices are virtualized first
+    bool mixSelected;               // Audio buffer is selected to be mixed on current device period
+    bool mixVirtual;                // Audio buffer is virtualized, playback advances without mixing
+
+    rAudioBuffer *mixNext;          // Next audio buffer on mixer voices list
+    rAudioBuffer *mixPrev;          // Previous audio buffer on mixer voices list
 };
 
 // Audio processor struct
@@ -375,6 +466,34 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio command type, queued by API functions and applied by mixer
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Play audio buffer from start
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch
+    AUDIO_COMMAND_PAN,              // Set audio buffer pan
+    AUDIO_COMMAND_PRIORITY,         // Set audio buffer priority
+    AUDIO_COMMAND_CALLBACK,         // Set audio buffer callback (audio stream)
+    AUDIO_COMMAND_ATTACH,           // Attach processor to audio buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH,           // Detach processor from audio buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DECODER,          // Set music decoder audio buffer frames are read from
+    AUDIO_COMMAND_RELEASE           // Remove audio buffer from mixer, buffer is going to be unloaded
+} AudioCommandType;
+
+// Audio command
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Audio buffer the command applies to
+    float value;                    // Command value: volume, pitch or pan
+    AudioCallback callback;         // Command callback: stream callback or processor to detach
+    rAudioProcessor *processor;     // Command processor: processor to attach
+    MusicDecoder *decoder;          // Command music decoder: decoder to set (or NULL)
+    int intValue;                   // Command integer value: priority
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
@@ -390,6 +509,29 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand commands[MAX_AUDIO_COMMANDS]; // Commands queue (single producer, single consumer ring)
+        ma_uint32 commandHead;      // Commands queued by API functions (atomic)
+        ma_uint32 commandTail;      // Commands applied by mixer (atomic)
+        AudioBuffer *first;         // Pointer to first AudioBuffer in mixer voices list
+        AudioBuffer *last;          // Pointer to last AudioBuffer in mixer voices list
+        rAudioProcessor *released;  // Processors detached by mixer, to be freed by API functions
+        AudioBuffer *releasedBuffers; // Audio buffers unloaded, to be freed once not referenced by mixer
+        ma_uint32 voiceLimit;       // Maximum number of voices mixed at once (atomic)
+        ma_timer timer;             // Mixing timer
+        ma_uint32 voicesPlaying;    // Voices playing on last device period (atomic)
+        ma_uint32 voicesMixed;      // Voices mixed on last device period (atomic)
+        ma_uint32 voicesStolen;     // Mixed voices virtualized by higher ranked voices, accumulated (atomic)
+        ma_uint32 mixTime;          // Mixing time of last device period (microseconds, atomic)
+    } Mixer;
+    struct {
+#if defined(MUSIC_DECODING_THREAD)
+        ma_thread thread;           // Music decoding thread
+        ma_mutex lock;              // Music decoders list mutex lock
+#endif
+        ma_uint32 running;          // Music decoding thread is running (atomic)
+        MusicDecoder *first;        // Pointer to first MusicDecoder in the list
+    } Decoder;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +545,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Mixer.voiceLimit = MAX_AUDIO_VOICES,
     .mixedProcessor = NULL
 };
 
@@ -414,14 +557,38 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 // Reads audio data from an AudioBuffer object in internal/device formats
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static ma_uint32 ReadAudioBufferFramesResampled(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static void ResampleAudioFrame(float *frameOut, const float *framesIn, const float *weights, ma_uint32 channels);
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+// Mixer commands queue and voices management
+static unsigned int PushAudioCommandInLockedState(AudioCommand command);
+static void WaitAudioCommandInLockedState(unsigned int index);
+static bool IsAudioMixerRunning(void);
+static void ProcessAudioCommands(void);
+static bool IsAudioBufferMixed(AudioBuffer *buffer);
+static void UnloadReleasedAudioBuffersInLockedState(void);
+static void AddMixerVoice(AudioBuffer *buffer);
+static void RemoveMixerVoice(AudioBuffer *buffer);
+static void StopMixerVoice(AudioBuffer *buffer);
+static bool IsMixerVoiceRankedHigher(AudioBuffer *buffer, AudioBuffer *other);
+static void AdvanceMixerVoice(AudioBuffer *buffer, ma_uint32 frameCount);
+
+// Music decoding and decoding thread
+static unsigned int ReadMusicContextFrames(Music music, void *frames, unsigned int frameCount);
+static unsigned int SeekMusicContext(Music music, unsigned int positionInFrames);
+static FileView LoadMappedFileView(const char *fileName);
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static void UnloadMusicDecoder(AudioBuffer *buffer);
+#if defined(MUSIC_DECODING_THREAD)
+static bool DecodeMusicFrames(MusicDecoder *decoder, ma_timer *timer);
+static ma_thread_result MA_THREADCALL MusicDecodingThread(void *userData);
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -429,6 +596,8 @@ static const char *GetFileName(const char *filePath);               // Get point
 static const char *GetFileNameWithoutExt(const char *filePath);     // Get filename string without extension (uses static string)
 
 static unsigned char *LoadFileData(const char *fileName, int *dataSize);    // Load file data as byte array (read)
+static FileView LoadFileView(const char *fileName);                 // Load file view (file data loaded)
+static void UnloadFileView(FileView view);                          // Unload file view
 static bool SaveFileData(const char *fileName, void *data, int dataSize);   // Save data to file from byte array (write)
 static bool SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
 #endif
@@ -448,6 +617,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -490,8 +660,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread, API functions queue commands to the mixer [PushAudioCommandInLockedState()]
+    // NOTE: Mutex only serializes API functions (commands queue producers), mixing never locks it to keep real-time
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -500,6 +670,8 @@ void InitAudioDevice(void)
         return;
     }
 
+    ma_timer_init(&AUDIO.Mixer.timer);
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -526,11 +698,25 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+#if defined(MUSIC_DECODING_THREAD)
+        // Music decoding thread is stopped, music decoders are unloaded along their music streams
+        if (ma_atomic_load_32(&AUDIO.Decoder.running) != 0)
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.running, 0);
+            ma_thread_wait(&AUDIO.Decoder.thread);
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+        }
+#endif
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+
+        // Mixing is stopped, apply pending commands, further commands are applied immediately
+        ProcessAudioCommands();
+        UnloadReleasedAudioBuffersInLockedState();
+        ma_mutex_uninit(&AUDIO.System.lock);
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -560,6 +746,30 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set maximum number of voices mixed at once (up to MAX_AUDIO_VOICES)
+// NOTE: Exceeding voices are virtualized by priority, playback advances without being mixed
+void SetAudioVoiceLimit(int count)
+{
+    if (count < 1) count = 1;
+    else if (count > MAX_AUDIO_VOICES) count = MAX_AUDIO_VOICES;
+
+    ma_atomic_store_32(&AUDIO.Mixer.voiceLimit, (ma_uint32)count);
+}
+
+// Get mixer voices stats, last device period mixed
+AudioVoiceStats GetAudioVoiceStats(void)
+{
+    AudioVoiceStats stats = { 0 };
+
+    stats.playing = (int)ma_atomic_load_32(&AUDIO.Mixer.voicesPlaying);
+    stats.mixed = (int)ma_atomic_load_32(&AUDIO.Mixer.voicesMixed);
+    stats.virtualized = stats.playing - stats.mixed;
+    stats.stolen = (int)ma_atomic_load_32(&AUDIO.Mixer.voicesStolen);
+    stats.mixTime = (float)ma_atomic_load_32(&AUDIO.Mixer.mixTime)/1000.0f;
+
+    return stats;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -594,11 +804,15 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
+    audioBuffer->mixVolume = 1.0f;
+    audioBuffer->mixPan = 0.5f;
+    audioBuffer->mixPitch = 1.0f;
+    audioBuffer->mixPriority = (usage == AUDIO_BUFFER_USAGE_STREAM)? AUDIO_STREAM_PRIORITY : 0;
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
-    audioBuffer->playing = false;
+    audioBuffer->playing = 0;
     audioBuffer->paused = false;
     audioBuffer->looping = false;
 
@@ -606,10 +820,14 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
 
+    // Static buffers already in mixing format (sounds converted on loading) are not converted on mixing,
+    // frames are copied (not pitched) or resampled by mixer (pitched), converter is not used
+    audioBuffer->mixDirect = ((usage == AUDIO_BUFFER_USAGE_STATIC) && (format == ma_format_f32) &&
+        (channels == AUDIO_DEVICE_CHANNELS) && (sampleRate == AUDIO.System.device.sampleRate));
+
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->subBufferState = 0x03;
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -618,24 +836,30 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Memory is freed once mixer is not referencing the buffer [UnloadReleasedAudioBuffersInLockedState()]
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
         UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        buffer->unloadData = true;
+        buffer->next = AUDIO.Mixer.releasedBuffers;
+        AUDIO.Mixer.releasedBuffers = buffer;
+        UnloadReleasedAudioBuffersInLockedState();
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing
+// NOTE: Playing state is cleared by mixer when a non-looping buffer reaches its end
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL) result = ((ma_atomic_load_32(&buffer->playing) != 0) && !buffer->paused);
+
     return result;
 }
 
@@ -647,18 +871,28 @@ void PlayAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
+        ma_atomic_store_32(&buffer->playing, 1);
         buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_PLAY, buffer, 0.0f, NULL, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
+    if (IsAudioBufferPlaying(buffer))
+    {
+        ma_atomic_store_32(&buffer->playing, 0);
+        buffer->paused = false;
+        buffer->framesProcessed = 0;
+
+        // Sub-buffers are marked as processed immediately, mixer stops reading them
+        ma_atomic_fetch_or_32(&buffer->subBufferState, 0x03);
+
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_STOP, buffer, 0.0f, NULL, NULL });
+    }
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -669,6 +903,7 @@ void PauseAudioBuffer(AudioBuffer *buffer)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->paused = true;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_PAUSE, buffer, 0.0f, NULL, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -680,6 +915,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->paused = false;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_RESUME, buffer, 0.0f, NULL, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -691,24 +927,20 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->volume = volume;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_VOLUME, buffer, volume, NULL, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Set pitch for an audio buffer
+// NOTE: Sample rate adjustment is applied by mixer [ProcessAudioCommands()]
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
         buffer->pitch = pitch;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_PITCH, buffer, pitch, NULL, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -723,6 +955,18 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     {
         ma_mutex_lock(&AUDIO.System.lock);
         buffer->pan = pan;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_PAN, buffer, pan, NULL, NULL });
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set priority for an audio buffer, lowest priority voices are virtualized first
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority)
+{
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_PRIORITY, buffer, 0.0f, NULL, NULL, NULL, priority });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -745,6 +989,7 @@ void TrackAudioBuffer(AudioBuffer *buffer)
 }
 
 // Untrack audio buffer from linked list
+// NOTE: If mixer still references the buffer (queued commands or voice), buffer is removed from mixer
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
@@ -757,6 +1002,8 @@ void UntrackAudioBuffer(AudioBuffer *buffer)
 
         buffer->prev = NULL;
         buffer->next = NULL;
+
+        if (IsAudioBufferMixed(buffer)) PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_RELEASE, buffer, 0.0f, NULL, NULL });
     }
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -770,14 +1017,13 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file view, file data mapped into memory (if available), no file data copy
+    FileView view = LoadFileView(fileName);
 
     // Loading wave from memory data
-    if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
+    if (view.data != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), view.data, view.dataSize);
 
-    UnloadFileData(fileData);
+    UnloadFileView(view);
 
     return wave;
 }
@@ -910,9 +1156,81 @@ bool IsWaveValid(Wave wave)
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 Sound LoadSound(const char *fileName)
 {
+    Sound sound = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    // WAV PCM data is read straight from file view (mapped into memory, if available), no wave data copy
+    // NOTE: Mapped PCM data already in mixing format or bigger than SOUND_MAPPED_DATA_SIZE is referenced by sound,
+    // not copied into heap memory, it is converted on mixing (unless in mixing format) and unmapped along the sound
+    // NOTE: PCM data not aligned to sample size in file (i.e. chunks with odd sizes) is loaded by LoadWave()
+    if (IsFileExtension(fileName, ".wav"))
+    {
+        FileView view = LoadFileView(fileName);
+
+        if (view.data == NULL) return sound;
+
+        drwav wav = { 0 };
+
+        if (drwav_init_memory(&wav, view.data, view.dataSize, NULL))
+        {
+            // PCM data stored little-endian in a format supported by converter: u8, s16 or f32
+            // WARNING: Samples read from misaligned addresses are undefined behaviour (bus error on some ARM devices)
+            if ((wav.container != drwav_container_rifx) && (wav.container != drwav_container_aiff) &&
+                (((wav.translatedFormatTag == DR_WAVE_FORMAT_PCM) && ((wav.bitsPerSample == 8) || (wav.bitsPerSample == 16))) ||
+                ((wav.translatedFormatTag == DR_WAVE_FORMAT_IEEE_FLOAT) && (wav.bitsPerSample == 32))) &&
+                (((size_t)(view.data + wav.dataChunkDataPos)%(wav.bitsPerSample/8)) == 0))
+            {
+                Wave wave = { 0 };
+                wave.sampleRate = wav.sampleRate;
+                wave.sampleSize = wav.bitsPerSample;
+                wave.channels = wav.channels;
+                wave.data = (void *)(view.data + wav.dataChunkDataPos);
+
+                // Make sure PCM data frames are available in file data
+                unsigned int frameSize = wave.channels*wave.sampleSize/8;
+                unsigned int dataFrames = (unsigned int)((view.dataSize - wav.dataChunkDataPos)/frameSize);
+                wave.frameCount = ((unsigned int)wav.totalPCMFrameCount < dataFrames)? (unsigned int)wav.totalPCMFrameCount : dataFrames;
+
+                bool mixingFormat = ((wave.sampleSize == 32) && (wave.channels == AUDIO_DEVICE_CHANNELS) && (wave.sampleRate == AUDIO.System.device.sampleRate));
+
+                if (view.mapped && (wave.frameCount > 0) && (mixingFormat || ((wave.frameCount*frameSize) >= SOUND_MAPPED_DATA_SIZE)))
+                {
+                    ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+                    AudioBuffer *audioBuffer = LoadAudioBuffer(formatIn, wave.channels, wave.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+                    if (audioBuffer != NULL)
+                    {
+                        audioBuffer->data = (unsigned char *)wave.data;
+                        audioBuffer->sizeInFrames = wave.frameCount;
+                        audioBuffer->dataMapped = true;
+                        audioBuffer->view = view;
+                        view = (FileView){ 0 };     // File view is unloaded along the sound buffer
+
+                        sound.frameCount = wave.frameCount;
+                        sound.stream.sampleRate = wave.sampleRate;
+                        sound.stream.sampleSize = wave.sampleSize;
+                        sound.stream.channels = wave.channels;
+                        sound.stream.buffer = audioBuffer;
+
+                        TRACELOG(LOG_INFO, "SOUND: [%s] PCM data mapped from file (%i frames)", fileName, sound.frameCount);
+                    }
+                    else TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                }
+                else sound = LoadSoundFromWave(wave);   // PCM data converted straight from file view
+            }
+
+            drwav_uninit(&wav);
+        }
+
+        UnloadFileView(view);
+
+        if (sound.stream.buffer != NULL) return sound;
+    }
+#endif
+
     Wave wave = LoadWave(fileName);
 
-    Sound sound = LoadSoundFromWave(wave);
+    sound = LoadSoundFromWave(wave);
 
     UnloadWave(wave);       // Sound is loaded, we can unload wave
 
@@ -936,10 +1254,15 @@ Sound LoadSoundFromWave(Wave wave)
         //
         // First option has been selected, format conversion is done on the loading stage
         // The downside is that it uses more memory if the original sound is u8 or s16
+        // NOTE: Sounds are not converted again on mixing [mixDirect], resampling to device sample rate is done
+        // only once here, so the highest quality low-pass filter order is used
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        ma_data_converter_config converterConfig = ma_data_converter_config_init(formatIn, AUDIO_DEVICE_FORMAT, wave.channels, AUDIO_DEVICE_CHANNELS, wave.sampleRate, AUDIO.System.device.sampleRate);
+        converterConfig.resampling.linear.lpfOrder = MA_MAX_FILTER_ORDER;
+
+        ma_uint32 frameCount = (ma_uint32)ma_convert_frames_ex(NULL, 0, NULL, frameCountIn, &converterConfig);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
@@ -949,7 +1272,7 @@ Sound LoadSoundFromWave(Wave wave)
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        frameCount = (ma_uint32)ma_convert_frames_ex(audioBuffer->data, frameCount, wave.data, frameCountIn, &converterConfig);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
         sound.frameCount = frameCount;
@@ -970,7 +1293,9 @@ Sound LoadSoundAlias(Sound source)
 
     if (source.stream.buffer->data != NULL)
     {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        // NOTE: Source sound data could be mapped from file in its own format [LoadSound()]
+        AudioBuffer *audioBuffer = LoadAudioBuffer(source.stream.buffer->converter.formatIn, source.stream.buffer->converter.channelsIn,
+            source.stream.buffer->converter.sampleRateIn, 0, AUDIO_BUFFER_USAGE_STATIC);
 
         if (audioBuffer == NULL)
         {
@@ -980,12 +1305,14 @@ Sound LoadSoundAlias(Sound source)
 
         audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
         audioBuffer->volume = source.stream.buffer->volume;
+        audioBuffer->mixVolume = audioBuffer->volume;
         audioBuffer->data = source.stream.buffer->data;
+        audioBuffer->dataMapped = source.stream.buffer->dataMapped;  // Mapped data is read-only, alias can not be updated [UpdateSound()]
 
         sound.frameCount = source.frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.sampleRate = source.stream.sampleRate;
+        sound.stream.sampleSize = source.stream.sampleSize;
+        sound.stream.channels = source.stream.channels;
         sound.stream.buffer = audioBuffer;
     }
 
@@ -1024,11 +1351,17 @@ void UnloadSound(Sound sound)
 void UnloadSoundAlias(Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
+    // NOTE: Alias buffer has no file view, shared data is not freed or unmapped (unloadData = false)
     if (alias.stream.buffer != NULL)
     {
         UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        alias.stream.buffer->unloadData = false;
+        alias.stream.buffer->next = AUDIO.Mixer.releasedBuffers;
+        AUDIO.Mixer.releasedBuffers = alias.stream.buffer;
+        UnloadReleasedAudioBuffersInLockedState();
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -1037,6 +1370,12 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+        if (sound.stream.buffer->dataMapped)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Sound data is mapped from file (read-only), it can not be updated");
+            return;
+        }
+
         StopAudioBuffer(sound.stream.buffer);
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
@@ -1220,6 +1559,12 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set priority for a sound
+void SetSoundPriority(Sound sound, int priority)
+{
+    SetAudioBufferPriority(sound.stream.buffer, priority);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1328,12 +1673,18 @@ Music LoadMusicStream(const char *fileName)
     Music music = { 0 };
     bool musicLoaded = false;
 
+    // WAV and QOA music is decoded from file view if mapped into memory (no file reads on streaming)
+    // NOTE: File view is unloaded along the music stream buffer
+    FileView view = { 0 };
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (IsFileExtension(fileName, ".wav"))
     {
         drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
-        bool success = drwav_init_file(ctxWav, fileName, NULL);
+
+        view = LoadMappedFileView(fileName);
+        bool success = (view.data != NULL)? drwav_init_memory(ctxWav, view.data, view.dataSize, NULL) : drwav_init_file(ctxWav, fileName, NULL);
 
         if (success)
         {
@@ -1403,7 +1754,8 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_QOA)
     else if (IsFileExtension(fileName, ".qoa"))
     {
-        qoaplay_desc *ctxQoa = qoaplay_open(fileName);
+        view = LoadMappedFileView(fileName);
+        qoaplay_desc *ctxQoa = (view.data != NULL)? qoaplay_open_view(view.data, view.dataSize) : qoaplay_open(fileName);
 
         if (ctxQoa != NULL)
         {
@@ -1496,6 +1848,9 @@ Music LoadMusicStream(const char *fileName)
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: [%s] File format not supported", fileName);
 
+    if (musicLoaded && (music.stream.buffer != NULL)) music.stream.buffer->view = view;
+    else UnloadFileView(view);
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: [%s] Music file could not be opened", fileName);
@@ -1503,7 +1858,7 @@ Music LoadMusicStream(const char *fileName)
     else
     {
         // Show some music stream info
-        TRACELOG(LOG_INFO, "FILEIO: [%s] Music file loaded successfully", fileName);
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Music file loaded successfully%s", fileName, (view.data != NULL)? " (mapped)" : "");
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
@@ -1739,13 +2094,15 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) UnloadMusicDecoder(music.stream.buffer);
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
     {
         if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
-        else if (music.ctxType == MUSIC_AUDIO_WAV) drwav_uninit((drwav *)music.ctxData);
+        else if (music.ctxType == MUSIC_AUDIO_WAV) { drwav_uninit((drwav *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
 #if defined(SUPPORT_FILEFORMAT_OGG)
         else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
@@ -1771,6 +2128,8 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) ma_atomic_store_32(&music.stream.buffer->decoder->looping, music.looping);
+
     PlayAudioStream(music.stream);
 }
 
@@ -1791,31 +2150,11 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    // Music decoded on decoding thread is rewound by decoding thread
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL) ma_atomic_store_32(&decoder->seekRequest, 1);
+    else SeekMusicContext(music, 0);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1826,37 +2165,21 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA:
-        {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+    // Music decoded on decoding thread is seeked asynchronously, decoded frames are discarded [DecodeMusicFrames()]
+    MusicDecoder *decoder = music.stream.buffer->decoder;
 
-            // We need to compute QOA frame number and update positionInFrames
-            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
-        } break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
+    if (decoder != NULL)
+    {
+        ma_atomic_store_32(&decoder->seekRequest, positionInFrames + 1);
+        return;
     }
 
+    positionInFrames = SeekMusicContext(music, positionInFrames);
+
+    // NOTE: Sub-buffers are refilled on next UpdateMusicStream(), mixer restarts from first one
     ma_mutex_lock(&AUDIO.System.lock);
     music.stream.buffer->framesProcessed = positionInFrames;
-    music.stream.buffer->isSubBufferProcessed[0] = true;
-    music.stream.buffer->isSubBufferProcessed[1] = true;
+    ma_atomic_fetch_or_32(&music.stream.buffer->subBufferState, 0x03);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -1865,6 +2188,13 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    // Music decoded on decoding thread, only looping state is updated
+    if (music.stream.buffer->decoder != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->decoder->looping, music.looping);
+        return;
+    }
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1883,7 +2213,7 @@ void UpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if ((ma_atomic_load_32(&music.stream.buffer->subBufferState) & (1 << i)) == 0) continue; // No refilling required, move to next sub-buffer
 
         unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
@@ -1891,116 +2221,7 @@ void UpdateMusicStream(Music music)
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        ReadMusicContextFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
@@ -2061,6 +2282,27 @@ float GetMusicTimePlayed(Music music)
     float secondsPlayed = 0.0f;
     if (music.stream.buffer != NULL)
     {
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+
+        if (decoder != NULL)
+        {
+            // Frames played by mixer since last seek, requested position is returned while a seek is pending
+            ma_uint32 seekRequest = ma_atomic_load_32(&decoder->seekRequest);
+            unsigned int framesPlayed = 0;
+
+            if (seekRequest != 0) framesPlayed = seekRequest - 1;
+            else
+            {
+                ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+                ma_uint64 flush = ma_atomic_load_64(&decoder->flush);
+                int framesSinceSeek = (int)(readPos - (ma_uint32)flush);
+
+                framesPlayed = (unsigned int)(flush >> 32) + ((framesSinceSeek > 0)? framesSinceSeek : 0);
+            }
+
+            secondsPlayed = (float)(framesPlayed%music.frameCount)/music.stream.sampleRate;
+        }
+        else
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
@@ -2076,8 +2318,9 @@ float GetMusicTimePlayed(Music music)
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
             int framesProcessed = (int)music.stream.buffer->framesProcessed;
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
+            ma_uint32 subBufferState = ma_atomic_load_32(&music.stream.buffer->subBufferState);
+            int framesInFirstBuffer = (subBufferState & 0x01)? 0 : subBufferSize;
+            int framesInSecondBuffer = (subBufferState & 0x02)? 0 : subBufferSize;
             int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
@@ -2089,49 +2332,156 @@ float GetMusicTimePlayed(Music music)
     return secondsPlayed;
 }
 
-// Load audio stream (to stream audio pcm data)
-AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+// Set music decoded on a background thread, keeping bufferTime seconds decoded ahead of playback (0.0f to disable)
+// NOTE: UpdateMusicStream() is not required while enabled, seeking is applied asynchronously by decoding thread,
+// music looping state is updated on PlayMusicStream() and UpdateMusicStream()
+void SetMusicStreamAsync(Music music, float bufferTime)
 {
-    AudioStream stream = { 0 };
+    if (music.stream.buffer == NULL) return;
 
-    stream.sampleRate = sampleRate;
-    stream.sampleSize = sampleSize;
-    stream.channels = channels;
+    // Music continues playing from current position
+    unsigned int positionInFrames = (unsigned int)(GetMusicTimePlayed(music)*music.stream.sampleRate);
 
-    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    if (music.stream.buffer->decoder != NULL)
+    {
+        UnloadMusicDecoder(music.stream.buffer);
 
-    // The size of a streaming buffer must be at least double the size of a period
-    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+        // Music decoded again on UpdateMusicStream()
+        if (bufferTime <= 0.0f) SeekMusicStream(music, (float)positionInFrames/music.stream.sampleRate);
+    }
 
-    // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate
-    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.device.sampleRate/30 : AUDIO.Buffer.defaultSize;
+    if (bufferTime <= 0.0f) return;
 
-    if (subBufferSize < periodSize) subBufferSize = periodSize;
+#if defined(MUSIC_DECODING_THREAD)
+    // Decoding thread is created on first music decoded
+    if (ma_atomic_load_32(&AUDIO.Decoder.running) == 0)
+    {
+        if (ma_mutex_init(&AUDIO.Decoder.lock) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create mutex for music decoding");
+            return;
+        }
 
-    // Create a double audio buffer of defined size
-    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+        ma_atomic_store_32(&AUDIO.Decoder.running, 1);
 
-    if (stream.buffer != NULL)
-    {
-        stream.buffer->looping = true;    // Always loop for streaming buffers
-        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+        if (ma_thread_create(&AUDIO.Decoder.thread, ma_thread_priority_default, 0, MusicDecodingThread, NULL, NULL) != MA_SUCCESS)
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.running, 0);
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoding thread");
+            return;
+        }
     }
-    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
 
-    return stream;
-}
+    // Ring buffer size is a power of two, positions are masked
+    unsigned int sizeInFrames = 1024;
+    while (sizeInFrames < (unsigned int)(bufferTime*music.stream.sampleRate)) sizeInFrames *= 2;
 
-// Checks if an audio stream is valid (buffers initialized)
-bool IsAudioStreamValid(AudioStream stream)
-{
-    return ((stream.buffer != NULL) &&    // Validate stream buffer
-            (stream.sampleRate > 0) &&    // Validate sample rate is supported
-            (stream.sampleSize > 0) &&    // Validate sample size is supported
-            (stream.channels > 0));       // Validate number of channels supported
-}
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+    decoder->frameSize = music.stream.channels*music.stream.sampleSize/8;
+    decoder->data = (unsigned char *)RL_CALLOC(sizeInFrames, decoder->frameSize);
 
-// Unload audio stream and free memory
-void UnloadAudioStream(AudioStream stream)
+    if (decoder->data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music decoding buffer");
+        RL_FREE(decoder);
+        return;
+    }
+
+    decoder->music = music;
+    decoder->sizeInFrames = sizeInFrames;
+    decoder->looping = music.looping;
+
+    // NOTE: Module formats can not be seeked, they continue from current decoding position
+    if ((music.ctxType != MUSIC_MODULE_XM) && (music.ctxType != MUSIC_MODULE_MOD)) decoder->seekRequest = positionInFrames + 1;
+
+    // Decoder is added to decoding thread list, then mixer reads frames from it
+    ma_mutex_lock(&AUDIO.Decoder.lock);
+    decoder->next = AUDIO.Decoder.first;
+    AUDIO.Decoder.first = decoder;
+    ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    music.stream.buffer->decoder = decoder;
+    PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_DECODER, music.stream.buffer, 0.0f, NULL, NULL, decoder });
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    TRACELOG(LOG_INFO, "STREAM: Music decoded on decoding thread (%i frames buffered)", sizeInFrames);
+#else
+    TRACELOG(LOG_WARNING, "STREAM: Music decoding thread not supported on this platform, use UpdateMusicStream()");
+#endif
+}
+
+// Get music decoding stats, music must be decoded on decoding thread [SetMusicStreamAsync()]
+MusicStreamStats GetMusicStreamStats(Music music)
+{
+    MusicStreamStats stats = { 0 };
+
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+
+        // Frames skipped by mixer after a seek are not considered buffered
+        ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+        ma_uint32 flushPos = (ma_uint32)ma_atomic_load_64(&decoder->flush);
+        if ((int)(flushPos - readPos) > 0) readPos = flushPos;
+
+        ma_uint32 framesBuffered = ma_atomic_load_32(&decoder->writePos) - readPos;
+        if (ma_atomic_load_32(&decoder->seekRequest) != 0) framesBuffered = 0;
+        ma_uint32 decodedFrames = ma_atomic_load_32(&decoder->decodedFrames);
+
+        stats.bufferTime = (float)framesBuffered/music.stream.sampleRate;
+        stats.bufferFill = (float)framesBuffered/decoder->sizeInFrames;
+        if (decodedFrames > 0) stats.decodeTime = ((float)ma_atomic_load_32(&decoder->decodeTime)/1000.0f)/((float)decodedFrames/music.stream.sampleRate);
+        stats.underruns = (int)ma_atomic_load_32(&decoder->underruns);
+    }
+
+    return stats;
+}
+
+// Load audio stream (to stream audio pcm data)
+AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    AudioStream stream = { 0 };
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+
+    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    // The size of a streaming buffer must be at least double the size of a period
+    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+
+    // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate
+    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.device.sampleRate/30 : AUDIO.Buffer.defaultSize;
+
+    if (subBufferSize < periodSize) subBufferSize = periodSize;
+
+    // Create a double audio buffer of defined size
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+
+    if (stream.buffer != NULL)
+    {
+        stream.buffer->looping = true;    // Always loop for streaming buffers
+        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
+
+    return stream;
+}
+
+// Checks if an audio stream is valid (buffers initialized)
+bool IsAudioStreamValid(AudioStream stream)
+{
+    return ((stream.buffer != NULL) &&    // Validate stream buffer
+            (stream.sampleRate > 0) &&    // Validate sample rate is supported
+            (stream.sampleSize > 0) &&    // Validate sample size is supported
+            (stream.channels > 0));       // Validate number of channels supported
+}
+
+// Unload audio stream and free memory
+void UnloadAudioStream(AudioStream stream)
 {
     UnloadAudioBuffer(stream.buffer);
 
@@ -2153,10 +2503,8 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+    bool result = ((ma_atomic_load_32(&stream.buffer->subBufferState) & 0x03) != 0);
+
     return result;
 }
 
@@ -2208,6 +2556,12 @@ void SetAudioStreamPan(AudioStream stream, float pan)
     SetAudioBufferPan(stream.buffer, pan);
 }
 
+// Set priority for audio stream
+void SetAudioStreamPriority(AudioStream stream, int priority)
+{
+    SetAudioBufferPriority(stream.buffer, priority);
+}
+
 // Default size for new audio streams
 void SetAudioStreamBufferSizeDefault(int size)
 {
@@ -2220,14 +2574,14 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
+        PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_CALLBACK, stream.buffer, 0.0f, callback, NULL });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
 // The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
+// a given stream, mixer iterates through the list to find the end. That way we don't need a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
@@ -2235,44 +2589,25 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
+    PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_ATTACH, stream.buffer, 0.0f, NULL, processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Remove processor from audio stream
+// NOTE: Waits until mixer has removed the processor, it could be running
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
-    rAudioProcessor *processor = stream.buffer->processor;
+    unsigned int index = PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_DETACH, stream.buffer, 0.0f, process, NULL });
+    WaitAudioCommandInLockedState(index);
 
-    while (processor)
+    while (AUDIO.Mixer.released != NULL)
     {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
+        rAudioProcessor *next = AUDIO.Mixer.released->next;
+        RL_FREE(AUDIO.Mixer.released);
+        AUDIO.Mixer.released = next;
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
@@ -2288,18 +2623,7 @@ void AttachAudioMixedProcessor(AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
+    PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_ATTACH, NULL, 0.0f, NULL, processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2309,23 +2633,14 @@ void DetachAudioMixedProcessor(AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    unsigned int index = PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_DETACH, NULL, 0.0f, process, NULL });
+    WaitAudioCommandInLockedState(index);
 
-    while (processor)
+    while (AUDIO.Mixer.released != NULL)
     {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
+        rAudioProcessor *next = AUDIO.Mixer.released->next;
+        RL_FREE(AUDIO.Mixer.released);
+        AUDIO.Mixer.released = next;
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
@@ -2354,17 +2669,22 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         return frameCount;
     }
 
+    // Music decoded on decoding thread, frames are read from decoder ring buffer
+    if (audioBuffer->mixDecoder != NULL) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
+
+    // Stream restarted from first sub-buffer [UpdateAudioStreamInLockedState()]
+    if (ma_atomic_load_32(&audioBuffer->subBufferState) & AUDIO_STREAM_RESTART)
+    {
+        audioBuffer->frameCursorPos = 0;
+        ma_atomic_fetch_and_32(&audioBuffer->subBufferState, ~AUDIO_STREAM_RESTART);
+    }
+
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
     if (currentSubBufferIndex > 1) return 0;
 
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
-
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
@@ -2375,13 +2695,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         //  - For static buffers, we simply fill as much data as we can
         //  - For streaming buffers we only fill half of the buffer that are processed
         //    Unprocessed halves must keep their audio data in-tact
+        // NOTE: Processed state is updated by other threads [UpdateAudioStream(), StopAudioBuffer()]
         if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
         {
             if (framesRead >= frameCount) break;
         }
         else
         {
-            if (isSubBufferProcessed[currentSubBufferIndex]) break;
+            if (ma_atomic_load_32(&audioBuffer->subBufferState) & (1 << currentSubBufferIndex)) break;
         }
 
         ma_uint32 totalFramesRemaining = (frameCount - framesRead);
@@ -2408,15 +2729,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
-            isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_fetch_or_32(&audioBuffer->subBufferState, (1 << currentSubBufferIndex));
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
 
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopMixerVoice(audioBuffer);
                 break;
             }
         }
@@ -2444,7 +2764,16 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    // NOTE: Input buffer is not cleared, frames not read from audio buffer are zero-filled when reading
+
+    // Audio buffer data already in mixing format, no conversion required
+    if (audioBuffer->mixDirect)
+    {
+        if (audioBuffer->mixPitch == 1.0f) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+        else return ReadAudioBufferFramesResampled(audioBuffer, framesOut, frameCount);
+    }
+
+    ma_uint8 inputBuffer[4096];
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2478,9 +2807,113 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     return totalOutputFramesProcessed;
 }
 
+// Reads audio data from an AudioBuffer object in mixing format, resampled by pitch
+// NOTE: Cubic interpolation (Catmull-Rom) over 4 frames, shared by all voices (no per-voice resampler state),
+// frame cursor keeps a fractional part in 0.32 fixed point [mixFraction], data out of buffer range is silence
+static ma_uint32 ReadAudioBufferFramesResampled(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    const float *data = (const float *)audioBuffer->data;
+    const ma_uint32 channels = audioBuffer->converter.channelsIn;
+    const ma_uint32 sizeInFrames = audioBuffer->sizeInFrames;
+    const ma_uint64 step = (ma_uint64)((double)audioBuffer->mixPitch*4294967296.0);
+
+    ma_uint64 position = ((ma_uint64)audioBuffer->frameCursorPos << 32) | audioBuffer->mixFraction;
+    float edgeFrames[4*AUDIO_DEVICE_CHANNELS];      // Frames around buffer start/end, wrapped when looping
+    ma_uint32 framesRead = 0;
+
+    if (sizeInFrames == 0) return 0;
+
+    for (; framesRead < frameCount; framesRead++)
+    {
+        ma_uint32 frame = (ma_uint32)(position >> 32);
+
+        if (frame >= sizeInFrames)
+        {
+            if (!audioBuffer->looping)
+            {
+                StopMixerVoice(audioBuffer);
+                return framesRead;
+            }
+
+            frame %= sizeInFrames;
+            position = ((ma_uint64)frame << 32) | (ma_uint32)position;
+        }
+
+        const float t = (float)(ma_uint32)position*(1.0f/4294967296.0f);
+        const float t2 = t*t;
+        const float t3 = t2*t;
+        const float weights[4] = {
+            0.5f*(-t3 + 2.0f*t2 - t),
+            0.5f*(3.0f*t3 - 5.0f*t2 + 2.0f),
+            0.5f*(-3.0f*t3 + 4.0f*t2 + t),
+            0.5f*(t3 - t2)
+        };
+
+        const float *framesIn = NULL;
+
+        if ((frame >= 1) && ((frame + 2) < sizeInFrames)) framesIn = data + (frame - 1)*channels;
+        else
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                ma_int64 index = (ma_int64)frame - 1 + i;
+
+                if (audioBuffer->looping) index = (index + sizeInFrames)%sizeInFrames;
+
+                if ((index >= 0) && (index < sizeInFrames)) memcpy(edgeFrames + i*channels, data + index*channels, channels*sizeof(float));
+                else memset(edgeFrames + i*channels, 0, channels*sizeof(float));
+            }
+
+            framesIn = edgeFrames;
+        }
+
+        ResampleAudioFrame(framesOut + framesRead*channels, framesIn, weights, channels);
+
+        position += step;
+    }
+
+    audioBuffer->frameCursorPos = (unsigned int)(position >> 32);
+    audioBuffer->mixFraction = (ma_uint32)position;
+
+    return framesRead;
+}
+
+// Interpolate one frame from 4 consecutive frames by weights
+// NOTE: Stereo frames are interpolated 2 frames at a time with SIMD instructions (if available)
+static void ResampleAudioFrame(float *frameOut, const float *framesIn, const float *weights, ma_uint32 channels)
+{
+#if defined(MIXING_SIMD_SSE)
+    if (channels == 2)
+    {
+        __m128 out = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(framesIn), _mm_set_ps(weights[1], weights[1], weights[0], weights[0])),
+            _mm_mul_ps(_mm_loadu_ps(framesIn + 4), _mm_set_ps(weights[3], weights[3], weights[2], weights[2])));
+
+        out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+        _mm_storel_pi((__m64 *)frameOut, out);
+        return;
+    }
+#elif defined(MIXING_SIMD_NEON)
+    if (channels == 2)
+    {
+        float32x4_t out = vmulq_f32(vld1q_f32(framesIn), vcombine_f32(vdup_n_f32(weights[0]), vdup_n_f32(weights[1])));
+        out = vmlaq_f32(out, vld1q_f32(framesIn + 4), vcombine_f32(vdup_n_f32(weights[2]), vdup_n_f32(weights[3])));
+
+        vst1_f32(frameOut, vadd_f32(vget_low_f32(out), vget_high_f32(out)));
+        return;
+    }
+#endif
+
+    for (ma_uint32 channel = 0; channel < channels; channel++)
+    {
+        frameOut[channel] = framesIn[channel]*weights[0] + framesIn[channels + channel]*weights[1] +
+            framesIn[2*channels + channel]*weights[2] + framesIn[3*channels + channel]*weights[3];
+    }
+}
+
 // Sending audio data to device callback function
 // This function will be called when miniaudio needs more data
-// NOTE: All the mixing takes place here
+// NOTE: All the mixing takes place here, commands queued by API functions are applied first,
+// mixer voices list is only accessed by this thread so no lock is required (real-time safe)
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
 {
     (void)pDevice;
@@ -2488,83 +2921,139 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    ProcessAudioCommands();
+
+    double startTime = ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer);
+
+    // Select voices to be mixed, audible voices ranked higher up to voice limit, remaining voices are virtualized
+    // NOTE: Selection is kept sorted by rank, lowest ranked voice is dropped when a higher ranked one is found
+    AudioBuffer *selectedVoices[MAX_AUDIO_VOICES];
+    int selectedCount = 0;
+    int playingCount = 0;
+    int stolenCount = 0;
+    int voiceLimit = (int)ma_atomic_load_32(&AUDIO.Mixer.voiceLimit);
+
+    for (AudioBuffer *audioBuffer = AUDIO.Mixer.first; audioBuffer != NULL; audioBuffer = audioBuffer->mixNext)
+    {
+        audioBuffer->mixSelected = false;
+
+        if (audioBuffer->mixPaused) continue;
+
+        playingCount++;
+
+        if (audioBuffer->mixVolume < AUDIO_VOICE_AUDIBLE_VOLUME) continue;
+
+        int index = selectedCount;
+
+        if (selectedCount < voiceLimit) selectedCount++;
+        else if (IsMixerVoiceRankedHigher(audioBuffer, selectedVoices[selectedCount - 1])) index = selectedCount - 1;
+        else continue;
+
+        while ((index > 0) && IsMixerVoiceRankedHigher(audioBuffer, selectedVoices[index - 1]))
+        {
+            selectedVoices[index] = selectedVoices[index - 1];
+            index--;
+        }
+
+        selectedVoices[index] = audioBuffer;
+    }
+
+    for (int i = 0; i < selectedCount; i++) selectedVoices[i]->mixSelected = true;
+
+    AudioBuffer *nextBuffer = NULL;
+
+    for (AudioBuffer *audioBuffer = AUDIO.Mixer.first; audioBuffer != NULL; audioBuffer = nextBuffer)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        nextBuffer = audioBuffer->mixNext;
+
+        // Ignore paused sounds
+        if (audioBuffer->mixPaused) continue;
+
+        // Virtual voices playback advances without mixing
+        if (!audioBuffer->mixSelected)
+        {
+            if (!audioBuffer->mixVirtual && (audioBuffer->mixVolume >= AUDIO_VOICE_AUDIBLE_VOLUME)) stolenCount++;
+            audioBuffer->mixVirtual = true;
+
+            AdvanceMixerVoice(audioBuffer, frameCount);
+
+            if (!audioBuffer->mixPlaying) RemoveMixerVoice(audioBuffer);
+            continue;
+        }
+
+        audioBuffer->mixVirtual = false;
+
+        ma_uint32 framesRead = 0;
+
+        while (1)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            if (framesRead >= frameCount) break;
 
-            ma_uint32 framesRead = 0;
+            // Just read as much data as we can from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
 
-            while (1)
+            while (framesToRead > 0)
             {
-                if (framesRead >= frameCount) break;
+                // NOTE: Temp buffer is not cleared, only frames read are mixed
+                float tempBuffer[1024]; // Frames for stereo
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                {
+                    framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                }
 
-                while (framesToRead > 0)
+                ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+                if (framesJustRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = tempBuffer;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    // Apply processors chain if defined
+                    rAudioProcessor *processor = audioBuffer->processor;
+                    while (processor)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        processor->process(framesIn, framesJustRead);
+                        processor = processor->next;
                     }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+                    MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                if (!audioBuffer->mixPlaying)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
 
-                    if (!audioBuffer->playing)
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        StopMixerVoice(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        audioBuffer->frameCursorPos = 0;
+                        continue;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            // If for some reason we weren't able to read every frame we'll need to break from the loop
+            // Not doing this could theoretically put us into an infinite loop
+            if (framesToRead > 0) break;
         }
+
+        // Voices stopped on mixing are removed once mixed, buffer is not accessed anymore
+        if (!audioBuffer->mixPlaying) RemoveMixerVoice(audioBuffer);
     }
 
     rAudioProcessor *processor = AUDIO.mixedProcessor;
@@ -2574,99 +3063,85 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_store_32(&AUDIO.Mixer.voicesPlaying, (ma_uint32)playingCount);
+    ma_atomic_store_32(&AUDIO.Mixer.voicesMixed, (ma_uint32)selectedCount);
+    ma_atomic_fetch_add_32(&AUDIO.Mixer.voicesStolen, (ma_uint32)stolenCount);
+    ma_atomic_store_32(&AUDIO.Mixer.mixTime, (ma_uint32)((ma_timer_get_time_in_seconds(&AUDIO.Mixer.timer) - startTime)*1000000.0));
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Samples are accumulated 4 at a time with SIMD instructions (if available), levels repeat every 4 samples
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
-    const float localVolume = buffer->volume;
+    const float localVolume = buffer->mixVolume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const ma_uint32 sampleCount = frameCount*channels;
+
+    // Output accumulates input multiplied by volume to provided output (usually 0)
+    float levels[4] = { localVolume, localVolume, localVolume, localVolume };
 
     if (channels == 2)  // We consider panning
     {
-        const float left = buffer->pan;
+        const float left = buffer->mixPan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        levels[0] = localVolume*0.5f*left*(3.0f - left*left);
+        levels[1] = localVolume*0.5f*right*(3.0f - right*right);
+        levels[2] = levels[0];
+        levels[3] = levels[1];
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    ma_uint32 sample = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(MIXING_SIMD_SSE)
+    const __m128 level = _mm_loadu_ps(levels);
 
-            frameOut += 2;
-            frameIn += 2;
-        }
-    }
-    else  // We do not consider panning
+    for (; (sample + 4) <= sampleCount; sample += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
-
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+        __m128 out = _mm_loadu_ps(framesOut + sample);
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_loadu_ps(framesIn + sample), level));
+        _mm_storeu_ps(framesOut + sample, out);
     }
-}
-
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
-{
-    bool result = false;
-
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
-
-    return result;
-}
+#elif defined(MIXING_SIMD_NEON)
+    const float32x4_t level = vld1q_f32(levels);
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
-{
-    if (buffer != NULL)
+    for (; (sample + 4) <= sampleCount; sample += 4)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
+        float32x4_t out = vld1q_f32(framesOut + sample);
+        out = vmlaq_f32(out, vld1q_f32(framesIn + sample), level);
+        vst1q_f32(framesOut + sample, out);
     }
+#endif
+
+    for (; sample < sampleCount; sample++) framesOut[sample] += (framesIn[sample]*levels[sample%4]);
 }
 
 // Update audio stream, assuming the audio system mutex has been locked
+// NOTE: Only processed sub-buffers are written, mixer is not reading them
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        ma_uint32 subBufferState = ma_atomic_load_32(&stream.buffer->subBufferState);
+
+        if (subBufferState & 0x03)
         {
             ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 restart = 0;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if ((subBufferState & 0x03) == 0x03)
             {
                 // Both buffers are available for updating
                 // Update the first one and make sure the cursor is moved back to the front
                 subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                restart = AUDIO_STREAM_RESTART;
             }
             else
             {
                 // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                subBufferToUpdate = (subBufferState & 0x01)? 0 : 1;
             }
 
             ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
@@ -2689,7 +3164,8 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                // Sub-buffer is made available to mixer, restart request must be published along with it
+                while (!ma_atomic_compare_exchange_strong_32(&stream.buffer->subBufferState, &subBufferState, (subBufferState & ~(1 << subBufferToUpdate)) | restart)) { }
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
@@ -2697,52 +3173,691 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
-// Some required functions for audio standalone module version
-#if defined(RAUDIO_STANDALONE)
-// Check file extension
-static bool IsFileExtension(const char *fileName, const char *ext)
+// Push command to mixer commands queue, assuming the audio system mutex has been locked
+// NOTE: Commands are applied by mixer on next device period, if mixer is not running they are applied immediately,
+// returned index can be used to wait for the command to be applied [WaitAudioCommandInLockedState()]
+static unsigned int PushAudioCommandInLockedState(AudioCommand command)
 {
-    bool result = false;
-    const char *fileExt;
+    ma_uint32 head = AUDIO.Mixer.commandHead;
 
-    if ((fileExt = strrchr(fileName, '.')) != NULL)
+    // Commands queue is full, wait for mixer to apply some commands
+    while ((head - ma_atomic_load_32(&AUDIO.Mixer.commandTail)) >= MAX_AUDIO_COMMANDS)
     {
-        if (strcmp(fileExt, ext) == 0) result = true;
+        if (IsAudioMixerRunning()) ma_yield();
+        else ProcessAudioCommands();
     }
 
-    return result;
-}
+    AUDIO.Mixer.commands[head%MAX_AUDIO_COMMANDS] = command;
+    ma_atomic_store_32(&AUDIO.Mixer.commandHead, head + 1);
 
-// Get pointer to extension for a filename string (includes the dot: .png)
-static const char *GetFileExtension(const char *fileName)
-{
-    const char *dot = strrchr(fileName, '.');
+    if (command.buffer != NULL) command.buffer->commandIndex = head + 1;
 
-    if (!dot || dot == fileName) return NULL;
+    if (!IsAudioMixerRunning()) ProcessAudioCommands();
 
-    return dot;
+    if (AUDIO.Mixer.releasedBuffers != NULL) UnloadReleasedAudioBuffersInLockedState();
+
+    return head + 1;
 }
 
-// String pointer reverse break: returns right-most occurrence of charset in s
-static const char *strprbrk(const char *s, const char *charset)
+// Wait until a queued command has been applied by mixer, assuming the audio system mutex has been locked
+static void WaitAudioCommandInLockedState(unsigned int index)
 {
-    const char *latestMatch = NULL;
-    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
-    return latestMatch;
+    while ((int)(index - ma_atomic_load_32(&AUDIO.Mixer.commandTail)) > 0)
+    {
+        if (IsAudioMixerRunning()) ma_yield();
+        else ProcessAudioCommands();
+    }
 }
 
-// Get pointer to filename for a path string
-static const char *GetFileName(const char *filePath)
+// Check if mixer is running on audio thread
+// NOTE: On web, audio device callback runs on main thread
+static bool IsAudioMixerRunning(void)
 {
-    const char *fileName = NULL;
-    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
-
-    if (!fileName) return filePath;
-
-    return fileName + 1;
+#if defined(__EMSCRIPTEN__)
+    return false;
+#else
+    return (AUDIO.System.isReady && ma_device_is_started(&AUDIO.System.device));
+#endif
 }
 
-// Get filename string without extension (uses static string)
+// Apply commands queued by API functions, called by mixer (or API functions if mixer is not running)
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Mixer.commandTail);
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Mixer.commandHead);
+
+    for (; tail != head; tail++)
+    {
+        AudioCommand *command = &AUDIO.Mixer.commands[tail%MAX_AUDIO_COMMANDS];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
+        {
+            case AUDIO_COMMAND_PLAY:
+            {
+                buffer->frameCursorPos = 0;
+                buffer->mixFraction = 0;
+                buffer->mixPaused = false;
+                if (!buffer->mixPlaying) AddMixerVoice(buffer);
+                ma_atomic_store_32(&buffer->playing, 1);
+            } break;
+            case AUDIO_COMMAND_STOP:
+            {
+                buffer->frameCursorPos = 0;
+                buffer->mixFraction = 0;
+                buffer->mixPaused = false;
+                if (buffer->mixPlaying) RemoveMixerVoice(buffer);
+                ma_atomic_store_32(&buffer->playing, 0);
+            } break;
+            case AUDIO_COMMAND_PAUSE: buffer->mixPaused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->mixPaused = false; break;
+            case AUDIO_COMMAND_VOLUME: buffer->mixVolume = command->value; break;
+            case AUDIO_COMMAND_PAN: buffer->mixPan = command->value; break;
+            case AUDIO_COMMAND_PRIORITY: buffer->mixPriority = command->intValue; break;
+            case AUDIO_COMMAND_PITCH:
+            {
+                // Pitching is just an adjustment of the sample rate
+                // Note that this changes the duration of the sound:
+                //  - higher pitches will make the sound faster
+                //  - lower pitches make it slower
+                // NOTE: Audio buffers in mixing format are resampled by mixer [ReadAudioBufferFramesResampled()]
+                buffer->mixPitch = command->value;
+
+                if (!buffer->mixDirect)
+                {
+                    ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+                    ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+                }
+            } break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_DECODER: buffer->mixDecoder = command->decoder; break;
+            case AUDIO_COMMAND_ATTACH:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *last = *first;
+
+                while (last && last->next) last = last->next;
+
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH:
+            {
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *processor = *first;
+
+                while (processor)
+                {
+                    rAudioProcessor *next = processor->next;
+                    rAudioProcessor *prev = processor->prev;
+
+                    if (processor->process == command->callback)
+                    {
+                        if (*first == processor) *first = next;
+                        if (prev) prev->next = next;
+                        if (next) next->prev = prev;
+
+                        // Detached processor is freed by API function [Detach*Processor()]
+                        processor->next = AUDIO.Mixer.released;
+                        AUDIO.Mixer.released = processor;
+                    }
+
+                    processor = next;
+                }
+            } break;
+            case AUDIO_COMMAND_RELEASE: if (buffer->mixPlaying) RemoveMixerVoice(buffer); break;
+            default: break;
+        }
+    }
+
+    ma_atomic_store_32(&AUDIO.Mixer.commandTail, tail);
+}
+
+// Check if audio buffer is referenced by mixer (queued commands or mixer voice)
+static bool IsAudioBufferMixed(AudioBuffer *buffer)
+{
+    bool result = (((int)(buffer->commandIndex - ma_atomic_load_32(&AUDIO.Mixer.commandTail)) > 0) ||
+        (ma_atomic_load_32(&buffer->mixing) != 0));
+
+    return result;
+}
+
+// Unload released audio buffers once none of them is referenced by mixer, assuming the audio system mutex has been locked
+// NOTE: Released buffers are freed together, alias buffers could share data with other released buffers
+static void UnloadReleasedAudioBuffersInLockedState(void)
+{
+    for (AudioBuffer *buffer = AUDIO.Mixer.releasedBuffers; buffer != NULL; buffer = buffer->next)
+    {
+        if (IsAudioBufferMixed(buffer)) return;
+    }
+
+    while (AUDIO.Mixer.releasedBuffers != NULL)
+    {
+        AudioBuffer *buffer = AUDIO.Mixer.releasedBuffers;
+        AUDIO.Mixer.releasedBuffers = buffer->next;
+
+        ma_data_converter_uninit(&buffer->converter, NULL);
+        if (buffer->unloadData)
+        {
+            if (!buffer->dataMapped) RL_FREE(buffer->data);
+            UnloadFileView(buffer->view);
+        }
+        RL_FREE(buffer);
+    }
+}
+
+// Add audio buffer to mixer voices list
+static void AddMixerVoice(AudioBuffer *buffer)
+{
+    if (AUDIO.Mixer.first == NULL) AUDIO.Mixer.first = buffer;
+    else
+    {
+        AUDIO.Mixer.last->mixNext = buffer;
+        buffer->mixPrev = AUDIO.Mixer.last;
+    }
+
+    AUDIO.Mixer.last = buffer;
+
+    // NOTE: New voices do not take mixed voices place unless ranked higher [IsMixerVoiceRankedHigher()]
+    buffer->mixPlaying = true;
+    buffer->mixVirtual = true;
+    ma_atomic_store_32(&buffer->mixing, 1);
+}
+
+// Remove audio buffer from mixer voices list
+// NOTE: Buffer could be unloaded right after, it must not be accessed anymore by mixer
+static void RemoveMixerVoice(AudioBuffer *buffer)
+{
+    if (buffer->mixPrev == NULL) AUDIO.Mixer.first = buffer->mixNext;
+    else buffer->mixPrev->mixNext = buffer->mixNext;
+
+    if (buffer->mixNext == NULL) AUDIO.Mixer.last = buffer->mixPrev;
+    else buffer->mixNext->mixPrev = buffer->mixPrev;
+
+    buffer->mixPrev = NULL;
+    buffer->mixNext = NULL;
+    buffer->mixPlaying = false;
+
+    ma_atomic_store_32(&buffer->mixing, 0);
+}
+
+// Stop mixer voice when playback ends, voice is removed from mixer voices list once mixed
+static void StopMixerVoice(AudioBuffer *buffer)
+{
+    if (buffer->mixPlaying)
+    {
+        buffer->mixPlaying = false;
+        buffer->frameCursorPos = 0;
+        buffer->mixFraction = 0;
+        ma_atomic_fetch_or_32(&buffer->subBufferState, 0x03);
+        ma_atomic_store_32(&buffer->playing, 0);
+    }
+}
+
+// Check if mixer voice is ranked higher than other voice to be mixed
+// NOTE: Ranked by priority, then voices already mixed keep mixing (no voices swapping), then by volume
+static bool IsMixerVoiceRankedHigher(AudioBuffer *buffer, AudioBuffer *other)
+{
+    if (buffer->mixPriority != other->mixPriority) return (buffer->mixPriority > other->mixPriority);
+    if (buffer->mixVirtual != other->mixVirtual) return !buffer->mixVirtual;
+
+    return (buffer->mixVolume > other->mixVolume);
+}
+
+// Advance mixer voice playback without mixing (virtual voice)
+// NOTE: Static buffers cursor is just moved, streams frames are read and discarded so sub-buffers keep being processed
+static void AdvanceMixerVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint64 inputFrameCount = 0;
+
+    if (buffer->mixDirect)
+    {
+        // Frame cursor advanced by pitch, fractional part kept [ReadAudioBufferFramesResampled()]
+        ma_uint64 position = (((ma_uint64)buffer->frameCursorPos << 32) | buffer->mixFraction) + (ma_uint64)((double)buffer->mixPitch*4294967296.0)*frameCount;
+
+        inputFrameCount = (position >> 32) - buffer->frameCursorPos;
+        buffer->mixFraction = (ma_uint32)position;
+    }
+    else ma_data_converter_get_required_input_frame_count(&buffer->converter, frameCount, &inputFrameCount);
+
+    if ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (buffer->callback == NULL))
+    {
+        ma_uint64 frameCursorPos = buffer->frameCursorPos + inputFrameCount;
+
+        if (frameCursorPos < buffer->sizeInFrames) buffer->frameCursorPos = (unsigned int)frameCursorPos;
+        else if (buffer->looping && (buffer->sizeInFrames > 0)) buffer->frameCursorPos = (unsigned int)(frameCursorPos%buffer->sizeInFrames);
+        else StopMixerVoice(buffer);
+    }
+    else
+    {
+        ma_uint8 framesDiscarded[4096];
+        ma_uint32 framesDiscardedCap = sizeof(framesDiscarded)/ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+
+        while ((inputFrameCount > 0) && buffer->mixPlaying)
+        {
+            ma_uint32 framesToRead = (inputFrameCount > framesDiscardedCap)? framesDiscardedCap : (ma_uint32)inputFrameCount;
+
+            ReadAudioBufferFramesInInternalFormat(buffer, framesDiscarded, framesToRead);
+            inputFrameCount -= framesToRead;
+        }
+    }
+}
+
+// Load file view only if file data is mapped into memory, music is streamed from file otherwise (file data not loaded)
+static FileView LoadMappedFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+#if defined(FILE_VIEW_MAPPING)
+    view = LoadFileView(fileName);
+
+    if (!view.mapped)
+    {
+        UnloadFileView(view);
+        view = (FileView){ 0 };
+    }
+#endif
+
+    return view;
+}
+
+// Read music frames from audio context (decoded or generated), decoder is rewound when reaching the end
+static unsigned int ReadMusicContextFrames(Music music, void *frames, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)frames + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)frames + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)frames + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)frames + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)frames, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)frames + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)frames + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)frames, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)frames, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)frames, frameCount);
+            frameCountReadTotal = frameCount;
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)frames, frameCount, 0);
+            frameCountReadTotal = frameCount;
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+
+    return (unsigned int)frameCountReadTotal;
+}
+
+// Seek music audio context to a certain position (in frames), returns position seeked
+// NOTE: Module formats can only be rewound
+static unsigned int SeekMusicContext(Music music, unsigned int positionInFrames)
+{
+    if (positionInFrames == 0)
+    {
+        switch (music.ctxType)
+        {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+            case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+            case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+            default: break;
+        }
+    }
+    else
+    {
+        switch (music.ctxType)
+        {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+            case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+            case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+            case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+            case MUSIC_AUDIO_QOA:
+            {
+                int qoaFrame = positionInFrames/QOA_FRAME_LEN;
+                qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+
+                // We need to compute QOA frame number and update positionInFrames
+                positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
+            } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+            case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
+#endif
+            default: break;
+        }
+    }
+
+    return positionInFrames;
+}
+
+// Read frames from music decoder ring buffer, called by mixer [ReadAudioBufferFramesInInternalFormat()]
+// NOTE: Frames decoded before a pending seek are not played, frames not available are filled with silence
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    MusicDecoder *decoder = audioBuffer->mixDecoder;
+    ma_uint32 framesRead = 0;
+
+    if (ma_atomic_load_32(&decoder->seekRequest) == 0)
+    {
+        // Frames decoded before last seek are skipped
+        ma_uint32 flushPos = (ma_uint32)ma_atomic_load_64(&decoder->flush);
+        ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+
+        if ((int)(flushPos - readPos) > 0) readPos = flushPos;
+
+        // NOTE: Ended state is checked before write position, so all frames decoded until the end are read
+        bool ended = (ma_atomic_load_32(&decoder->ended) != 0);
+        ma_uint32 framesAvailable = ma_atomic_load_32(&decoder->writePos) - readPos;
+
+        framesRead = (framesAvailable < frameCount)? framesAvailable : frameCount;
+
+        // Ring buffer frames could wrap around the end
+        ma_uint32 offset = readPos & (decoder->sizeInFrames - 1);
+        ma_uint32 framesToEnd = decoder->sizeInFrames - offset;
+        if (framesToEnd > framesRead) framesToEnd = framesRead;
+
+        memcpy(framesOut, decoder->data + offset*decoder->frameSize, framesToEnd*decoder->frameSize);
+        memcpy((unsigned char *)framesOut + framesToEnd*decoder->frameSize, decoder->data, (framesRead - framesToEnd)*decoder->frameSize);
+
+        ma_atomic_store_32(&decoder->readPos, readPos + framesRead);
+
+        if (framesRead < frameCount)
+        {
+            if (ended)
+            {
+                // Music is rewound for next playing, unless a seek has been requested meanwhile
+                ma_uint32 noRequest = 0;
+                ma_atomic_compare_exchange_strong_32(&decoder->seekRequest, &noRequest, 1);
+
+                StopMixerVoice(audioBuffer);
+            }
+            else if (readPos != flushPos) ma_atomic_fetch_add_32(&decoder->underruns, 1); // Not counted while starting after a seek
+        }
+    }
+
+    memset((unsigned char *)framesOut + framesRead*decoder->frameSize, 0, (frameCount - framesRead)*decoder->frameSize);
+
+    return frameCount;
+}
+
+// Unload music decoder, mixer reads audio buffer data again
+// NOTE: Audio buffer sub-buffers are marked as processed, they are refilled by UpdateMusicStream()
+static void UnloadMusicDecoder(AudioBuffer *buffer)
+{
+    MusicDecoder *decoder = buffer->decoder;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    buffer->decoder = NULL;
+    WaitAudioCommandInLockedState(PushAudioCommandInLockedState((AudioCommand){ AUDIO_COMMAND_DECODER, buffer, 0.0f, NULL, NULL, NULL }));
+    ma_atomic_fetch_or_32(&buffer->subBufferState, 0x03);
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    // Decoder is removed from decoding thread list, decoding thread is not using it once list is locked
+#if defined(MUSIC_DECODING_THREAD)
+    bool threadRunning = (ma_atomic_load_32(&AUDIO.Decoder.running) != 0);
+    if (threadRunning) ma_mutex_lock(&AUDIO.Decoder.lock);
+#endif
+    MusicDecoder **link = &AUDIO.Decoder.first;
+    while (*link != decoder) link = &(*link)->next;
+    *link = decoder->next;
+#if defined(MUSIC_DECODING_THREAD)
+    if (threadRunning) ma_mutex_unlock(&AUDIO.Decoder.lock);
+#endif
+
+    RL_FREE(decoder->data);
+    RL_FREE(decoder);
+}
+
+#if defined(MUSIC_DECODING_THREAD)
+// Decode music frames into decoder ring buffer, called by decoding thread, returns true if any frame was decoded
+static bool DecodeMusicFrames(MusicDecoder *decoder, ma_timer *timer)
+{
+    ma_uint32 writePos = decoder->writePos;     // Only written by this thread
+
+    // Seek requested by API functions (or mixer when music ends), frames already decoded are skipped by mixer
+    ma_uint32 seekRequest = ma_atomic_load_32(&decoder->seekRequest);
+
+    if (seekRequest != 0)
+    {
+        decoder->position = SeekMusicContext(decoder->music, seekRequest - 1);
+
+        ma_atomic_store_32(&decoder->ended, 0);
+        ma_atomic_store_64(&decoder->flush, ((ma_uint64)decoder->position << 32) | writePos);
+
+        // NOTE: Request is cleared only if not updated meanwhile, a new request is served on next call
+        ma_atomic_compare_exchange_strong_32(&decoder->seekRequest, &seekRequest, 0);
+    }
+
+    if (ma_atomic_load_32(&decoder->ended) != 0) return false;
+
+    // Frames are decoded by chunks, once a chunk fits in ring buffer free space
+    // NOTE: Free space is computed from mixer read position, frames skipped after a seek are not overwritten until mixer skips them
+    ma_uint32 chunkFrames = decoder->sizeInFrames/4;
+    if (chunkFrames > MUSIC_DECODER_CHUNK_FRAMES) chunkFrames = MUSIC_DECODER_CHUNK_FRAMES;
+
+    ma_uint32 framesFree = decoder->sizeInFrames - (writePos - ma_atomic_load_32(&decoder->readPos));
+    if (framesFree < chunkFrames) return false;
+
+    ma_uint32 offset = writePos & (decoder->sizeInFrames - 1);
+    ma_uint32 framesLeft = (decoder->position < decoder->music.frameCount)? (decoder->music.frameCount - decoder->position) : 0;
+    ma_uint32 frameCount = chunkFrames;
+
+    if (frameCount > (decoder->sizeInFrames - offset)) frameCount = decoder->sizeInFrames - offset;
+    if (frameCount > framesLeft) frameCount = framesLeft;
+
+    double startTime = ma_timer_get_time_in_seconds(timer);
+    ma_uint32 framesDecoded = (frameCount > 0)? ReadMusicContextFrames(decoder->music, decoder->data + offset*decoder->frameSize, frameCount) : 0;
+    double decodeTime = ma_timer_get_time_in_seconds(timer) - startTime;
+
+    ma_atomic_fetch_add_32(&decoder->decodeTime, (ma_uint32)(decodeTime*1000000.0));
+    ma_atomic_fetch_add_32(&decoder->decodedFrames, framesDecoded);
+
+    decoder->position += framesDecoded;
+    ma_atomic_store_32(&decoder->writePos, writePos + framesDecoded);
+
+    // Music end reached, decoder is rewound if looping
+    if ((decoder->position >= decoder->music.frameCount) || (framesDecoded < frameCount))
+    {
+        if (ma_atomic_load_32(&decoder->looping) != 0) decoder->position = SeekMusicContext(decoder->music, 0);
+        else ma_atomic_store_32(&decoder->ended, 1);
+    }
+
+    return true;
+}
+
+// Music decoding thread, keeps music decoders ring buffers filled ahead of playback
+static ma_thread_result MA_THREADCALL MusicDecodingThread(void *userData)
+{
+    (void)userData;
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    while (ma_atomic_load_32(&AUDIO.Decoder.running) != 0)
+    {
+        bool decoded = false;
+
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        for (MusicDecoder *decoder = AUDIO.Decoder.first; decoder != NULL; decoder = decoder->next)
+        {
+            if (DecodeMusicFrames(decoder, &timer)) decoded = true;
+        }
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        // Music ring buffers are full, wait for mixer to play some frames
+        if (!decoded) ma_sleep(MUSIC_DECODER_SLEEP_TIME);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Some required functions for audio standalone module version
+#if defined(RAUDIO_STANDALONE)
+// Check file extension
+static bool IsFileExtension(const char *fileName, const char *ext)
+{
+    bool result = false;
+    const char *fileExt;
+
+    if ((fileExt = strrchr(fileName, '.')) != NULL)
+    {
+        if (strcmp(fileExt, ext) == 0) result = true;
+    }
+
+    return result;
+}
+
+// Get pointer to extension for a filename string (includes the dot: .png)
+static const char *GetFileExtension(const char *fileName)
+{
+    const char *dot = strrchr(fileName, '.');
+
+    if (!dot || dot == fileName) return NULL;
+
+    return dot;
+}
+
+// String pointer reverse break: returns right-most occurrence of charset in s
+static const char *strprbrk(const char *s, const char *charset)
+{
+    const char *latestMatch = NULL;
+    for (; s = strpbrk(s, charset), s != NULL; latestMatch = s++) { }
+    return latestMatch;
+}
+
+// Get pointer to filename for a path string
+static const char *GetFileName(const char *filePath)
+{
+    const char *fileName = NULL;
+    if (filePath != NULL) fileName = strprbrk(filePath, "\\/");
+
+    if (!fileName) return filePath;
+
+    return fileName + 1;
+}
+
+// Get filename string without extension (uses static string)
 static const char *GetFileNameWithoutExt(const char *filePath)
 {
     #define MAX_FILENAMEWITHOUTEXT_LENGTH   256
@@ -2807,6 +3922,22 @@ static unsigned char *LoadFileData(const char *fileName, int *dataSize)
     return data;
 }
 
+// Load file view, file data is loaded (no mapping available on standalone module)
+static FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+    view.data = LoadFileData(fileName, &view.dataSize);
+
+    return view;
+}
+
+// Unload file view
+static void UnloadFileView(FileView view)
+{
+    RL_FREE((void *)view.data);
+}
+
 // Save data to file from buffer
 static bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -43,7 +43,7 @@
 *       [rtextures] stb_image_resize2 (Sean Barret) for image resizing algorithms
 *       [rtextures] stb_perlin (Sean Barret) for Perlin Noise image generation
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
-*       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
+*       [rtextures] stb_rect_pack (Sean Barret) for rectangles packing (texture atlas, font atlas)
 *       [rmodels] par_shapes (Philip Rideout) for parametric 3d shapes generation
 *       [rmodels] tinyobj_loader_c (Syoyo Fujita) for models loading (OBJ, MTL)
 *       [rmodels] cgltf (Johannes Kuhlmann) for models loading (glTF)
@@ -303,6 +303,22 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// AtlasSprite, sprite rectangle in a texture atlas page
+typedef struct AtlasSprite {
+    Texture2D texture;      // Atlas page texture (shared by all the page sprites)
+    Rectangle source;       // Sprite rectangle in atlas page texture
+} AtlasSprite;
+
+// TextureLoaderStats, texture loader throughput
+typedef struct TextureLoaderStats {
+    int pending;            // Textures pending: decoding or waiting to be uploaded
+    int loaded;             // Textures loaded: uploaded or failed
+    int uploaded;           // Textures uploaded on last update
+    float uploadTime;       // Textures upload time on last update (ms)
+    float decodeRate;       // Image data decoded per second, since loading started (MB/s)
+    float uploadRate;       // Image data uploaded per second of upload time (MB/s)
+} TextureLoaderStats;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -312,6 +328,14 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// GlyphLookup, font codepoints to glyphs indices lookup (GetGlyphIndex() acceleration)
+typedef struct GlyphLookup {
+    int fallbackIndex;      // Glyph index for codepoints not available in font ('?' glyph)
+    int *latin;             // Direct lookup table, glyph index for codepoints [0..255]
+    int hashSize;           // Hash table size for codepoints out of direct lookup range (power of two)
+    int *hash;              // Hash table slots, 2 per slot: codepoint (-1 for empty slots), glyph index
+} GlyphLookup;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,8 +344,18 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    GlyphLookup *lookup;    // Glyphs lookup table (optional, GenFontGlyphLookup())
 } Font;
 
+// TextRun, text glyphs quads laid out with a font (retained text drawing)
+typedef struct TextRun {
+    Texture2D texture;      // Font texture atlas (shared with font, not unloaded with text run)
+    int glyphCount;         // Number of glyphs quads (spaces and line-breaks not included)
+    float *vertices;        // Glyphs quads positions, relative to text position (XY - 2 components per vertex, 4 vertex per glyph)
+    float *texcoords;       // Glyphs quads texture coordinates (UV - 2 components per vertex, 4 vertex per glyph)
+    Vector2 size;           // Text size, same as MeasureTextEx()
+} TextRun;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -341,6 +375,14 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// MeshBVH, mesh triangles bounding volume hierarchy (ray collision acceleration)
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes
+    Vector3 *bounds;        // Nodes bounds, 2 per node: min and max (mesh space)
+    int *nodes;             // Nodes data, 2 per node: first child node or first leaf triangle, leaf triangles count (0 for inner nodes)
+    int *triangles;         // Mesh triangles indices, sorted by leaf nodes
+} MeshBVH;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -366,6 +408,9 @@ typedef struct Mesh {
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
+
+    // Collision data
+    MeshBVH *bvh;           // Triangles bounding volume hierarchy (optional, GenMeshBVH())
 } Mesh;
 
 // Shader
@@ -415,6 +460,7 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+    Matrix *bindPoseInverse; // Bones inverse bind matrices (precomputed from bindPose on loading)
 } Model;
 
 // ModelAnimation
@@ -426,6 +472,20 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// AnimationClip, compressed keyframe animation (bones local space), sampled at any time
+typedef struct AnimationClip {
+    int boneCount;              // Number of bones
+    int frameCount;             // Number of source animation frames
+    float frameRate;            // Source animation frames per second
+    int keyCount;               // Number of keys (all tracks)
+    int *trackKeys;             // First key per track [boneCount*3 + 1] (tracks per bone: translation, rotation, scale)
+    float *trackRanges;         // Keys quantization range per track [boneCount*3*8] (min and step, 4 components)
+    unsigned short *keyFrames;  // Keys frame index [keyCount]
+    unsigned short *keyValues;  // Keys values quantized to 16 bit [keyCount*4]
+    BoneInfo *bones;            // Bones information (skeleton)
+    char name[32];              // Animation name
+} AnimationClip;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -446,6 +506,20 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rshapes, rtextures, rtext and rmodels modules
+typedef struct SpatialGrid SpatialGrid;
+typedef struct SpatialTree SpatialTree;
+typedef struct TextureAtlas TextureAtlas;
+typedef struct TextureLoader TextureLoader;
+typedef struct DynamicFont DynamicFont;
+
+// BodyPair, broadphase overlapping bodies
+typedef struct BodyPair {
+    int a;                  // First body handle
+    int b;                  // Second body handle (always greater than first)
+} BodyPair;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -486,6 +560,23 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// MusicStreamStats, music decoding thread stats
+typedef struct MusicStreamStats {
+    float decodeTime;           // Decoding time per second of music decoded (in milliseconds)
+    float bufferTime;           // Music decoded ahead of playback (in seconds)
+    float bufferFill;           // Music decoding buffer fill level (0.0f to 1.0f)
+    int underruns;              // Times playback ran out of decoded music
+} MusicStreamStats;
+
+// AudioVoiceStats, mixer voices stats (last device period mixed)
+typedef struct AudioVoiceStats {
+    int playing;                // Voices playing (mixed and virtualized)
+    int mixed;                  // Voices mixed
+    int virtualized;            // Voices virtualized, playback advances without being mixed
+    int stolen;                 // Mixed voices virtualized by higher priority voices (accumulated)
+    float mixTime;              // Mixing time (in milliseconds)
+} AudioVoiceStats;
+
 // VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -518,6 +609,14 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// File view, read-only file data mapped into memory (or loaded, if mapping is not available)
+typedef struct FileView {
+    const unsigned char *data;      // File data (read-only)
+    int dataSize;                   // File data size in bytes
+    bool mapped;                    // File data is mapped (memory-mapped file or Android asset buffer), not loaded
+    void *handle;                   // Platform handle (Android asset), NULL if not required
+} FileView;
+
 // Automation event
 typedef struct AutomationEvent {
     unsigned int frame;             // Event frame
@@ -882,6 +981,13 @@ typedef enum {
     TEXTURE_WRAP_MIRROR_CLAMP               // Mirrors and clamps to border the texture in tiled mode
 } TextureWrap;
 
+// Mipmap filters
+// NOTE: Used on mipmaps generation on CPU [ImageMipmapsEx()]
+typedef enum {
+    MIPMAP_FILTER_BOX = 0,                  // Box filter, level pixel area average (default)
+    MIPMAP_FILTER_KAISER                    // Kaiser windowed sinc filter, sharper levels
+} MipmapFilter;
+
 // Cubemap layouts
 typedef enum {
     CUBEMAP_LAYOUT_AUTO_DETECT = 0,         // Automatically detect layout type
@@ -891,6 +997,13 @@ typedef enum {
     CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE     // Layout is defined by a 4x3 cross with cubemap faces
 } CubemapLayout;
 
+// Texture loader texture state
+typedef enum {
+    TEXTURE_LOAD_PENDING = 0,               // Image being decoded or waiting to be uploaded
+    TEXTURE_LOAD_READY,                     // Texture uploaded, ready to be drawn
+    TEXTURE_LOAD_FAILED                     // Image could not be loaded (or invalid texture handle)
+} TextureLoadState;
+
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
@@ -1119,6 +1232,8 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileView LoadFileView(const char *fileName);                // Load file view, file data mapped read-only (loaded if mapping is not available), data can be passed to *FromMemory() loaders
+RLAPI void UnloadFileView(FileView view);                         // Unload file view (unmap or unload file data)
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1320,6 +1435,17 @@ RLAPI bool CheckCollisionPointPoly(Vector2 point, const Vector2 *points, int poi
 RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
+// Broadphase spatial grid functions (2d bodies)
+// NOTE: Bodies are referenced by handles, returned query counts are limited to provided buffers size
+RLAPI SpatialGrid *LoadSpatialGrid(float cellSize);                                                      // Load spatial grid with defined cell size
+RLAPI void UnloadSpatialGrid(SpatialGrid *grid);                                                         // Unload spatial grid
+RLAPI int AddSpatialGridBody(SpatialGrid *grid, Rectangle bounds);                                       // Add body to spatial grid, returns body handle
+RLAPI void UpdateSpatialGridBody(SpatialGrid *grid, int handle, Rectangle bounds);                       // Update spatial grid body bounds
+RLAPI void RemoveSpatialGridBody(SpatialGrid *grid, int handle);                                         // Remove body from spatial grid
+RLAPI int GetSpatialGridPairs(SpatialGrid *grid, BodyPair *pairs, int maxPairs);                         // Get spatial grid overlapping bodies pairs
+RLAPI int GetSpatialGridBodiesRec(SpatialGrid *grid, Rectangle rec, int *handles, int maxHandles);       // Get spatial grid bodies overlapping rectangle
+RLAPI int GetSpatialGridBodiesRay(SpatialGrid *grid, Vector2 position, Vector2 direction, float distance, int *handles, int maxHandles); // Get spatial grid bodies hit by ray, up to distance
+
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
 //------------------------------------------------------------------------------------
@@ -1333,6 +1459,8 @@ RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *f
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
+RLAPI Image LoadImageCompressed(const char *fileName, int format, bool mipmaps);                         // Load image from file compressed into GPU format (DXT/ETC), cached into KTX file
+RLAPI void SetImageCompressedCachePath(const char *path);                                                // Set compressed images KTX cache directory (NULL: working directory)
 RLAPI bool IsImageValid(Image image);                                                                    // Check if an image is valid (data and parameters)
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
@@ -1369,6 +1497,7 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, int filter, bool srgb);                                          // Compute all mipmap levels for a provided image, filter and gamma-correct filtering selectable
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1439,6 +1568,32 @@ RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// Texture atlas functions
+// NOTE: Images are packed into atlas pages at runtime, sprites from the same page are drawn in the same draw call,
+// sprites are referenced by handles, if max pages is reached the least recently used page is evicted
+RLAPI TextureAtlas *LoadTextureAtlas(int pageSize, int maxPages, int padding);                          // Load texture atlas (empty), pages created on demand (maxPages = 0: unlimited)
+RLAPI void UnloadTextureAtlas(TextureAtlas *atlas);                                                      // Unload texture atlas pages from GPU memory (VRAM)
+RLAPI int AddTextureAtlasImage(TextureAtlas *atlas, Image image);                                        // Add image to texture atlas, returns sprite handle (-1 on failure)
+RLAPI int AddTextureAtlasImages(TextureAtlas *atlas, const Image *images, int count, int *sprites);       // Add images to texture atlas (packed together), sprite handles returned, returns packed count
+RLAPI int AddTextureAtlasFiles(TextureAtlas *atlas, const char **fileNames, int count, int *sprites);    // Add image files to texture atlas (packed together), sprite handles returned, returns packed count
+RLAPI bool IsTextureAtlasSpriteValid(TextureAtlas *atlas, int sprite);                                   // Check if a texture atlas sprite is valid (not evicted)
+RLAPI AtlasSprite GetTextureAtlasSprite(TextureAtlas *atlas, int sprite);                                // Get texture atlas sprite page texture and rectangle (page marked as used)
+RLAPI int GetTextureAtlasPageCount(TextureAtlas *atlas);                                                 // Get texture atlas pages count
+RLAPI Texture2D GetTextureAtlasPage(TextureAtlas *atlas, int page);                                      // Get texture atlas page texture
+RLAPI void DrawTextureAtlasSprite(TextureAtlas *atlas, int sprite, Vector2 position, Color tint);        // Draw a texture atlas sprite
+RLAPI void DrawTextureAtlasSpritePro(TextureAtlas *atlas, int sprite, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a texture atlas sprite with 'pro' parameters
+
+// Texture loader functions
+// NOTE: Image files are decoded (converted, mipmaps generated) on worker threads, textures are uploaded
+// on main thread by UpdateTextureLoader() within a time budget, textures are referenced by handles
+RLAPI TextureLoader *LoadTextureLoader(void);                                                            // Load texture loader (empty)
+RLAPI void UnloadTextureLoader(TextureLoader *loader);                                                   // Unload texture loader and its textures (waits pending decoding)
+RLAPI int AddTextureLoaderFile(TextureLoader *loader, const char *fileName, int format, bool mipmaps);   // Add image file to be loaded as texture (format = 0: keep file format), returns texture handle
+RLAPI void UpdateTextureLoader(TextureLoader *loader, float budget);                                     // Upload decoded textures, up to budget milliseconds per call (at least one texture)
+RLAPI int GetTextureLoadState(TextureLoader *loader, int handle);                                        // Get texture handle load state (TextureLoadState)
+RLAPI Texture2D GetTextureLoaderTexture(TextureLoader *loader, int handle);                              // Get texture handle texture (id = 0 if not ready)
+RLAPI TextureLoaderStats GetTextureLoaderStats(TextureLoader *loader);                                   // Get texture loader throughput stats
+
 // Color/pixel related functions
 RLAPI bool ColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1471,6 +1626,7 @@ RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileDat
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
+RLAPI void GenFontGlyphLookup(Font *font);                                                  // Generate font glyphs lookup table, used by GetGlyphIndex() (regenerate if glyphs change)
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
@@ -1483,6 +1639,24 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text runs functions (retained text layout)
+RLAPI TextRun LoadTextRun(Font font, const char *text, float fontSize, float spacing);        // Load text run, text laid out once (same as DrawTextEx()) to be drawn multiple times
+RLAPI void UnloadTextRun(TextRun run);                                                      // Unload text run data (RAM)
+RLAPI void DrawTextRun(TextRun run, Vector2 position, Color tint);                          // Draw text run, all glyphs submitted at once
+RLAPI void DrawTextCached(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font, text run cached (least recently used text run evicted)
+RLAPI Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing); // Measure string size for font, text run cached (least recently used text run evicted)
+
+// Dynamic font functions (glyphs rasterized on demand)
+// NOTE: Font data is kept resident, glyphs are rasterized on first use into atlas pages,
+// if max pages is reached the least recently used page is evicted (glyphs rasterized again when required)
+RLAPI DynamicFont *LoadDynamicFont(const char *fileName, int fontSize, int pageSize, int maxPages); // Load dynamic font from TTF/OTF file (maxPages = 0: unlimited)
+RLAPI DynamicFont *LoadDynamicFontFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages); // Load dynamic font from TTF/OTF memory data (data copied)
+RLAPI void UnloadDynamicFont(DynamicFont *font);                                            // Unload dynamic font, atlas pages and font data
+RLAPI void DrawTextDynamic(DynamicFont *font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using dynamic font, missing glyphs rasterized
+RLAPI Vector2 MeasureTextDynamic(DynamicFont *font, const char *text, float fontSize, float spacing); // Measure string size for dynamic font (glyphs not rasterized)
+RLAPI TextureAtlas *GetDynamicFontAtlas(DynamicFont *font);                                 // Get dynamic font glyphs atlas
+RLAPI int GetDynamicFontGlyphCount(DynamicFont *font);                                      // Get dynamic font glyphs count resident in atlas pages
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1507,7 +1681,8 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);        // Encod
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
-RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
+RLAPI const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style), valid until frame end
+RLAPI void ResetTextFormatArena(void);                                                      // Reset calling thread formatted strings arena (TextFormat() strings expire)
 RLAPI const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
 RLAPI char *TextReplace(const char *text, const char *replace, const char *by);             // Replace text string (WARNING: memory must be freed!)
 RLAPI char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
@@ -1582,6 +1757,7 @@ RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshBVH(Mesh *mesh);                                                          // Compute mesh triangles BVH, used by ray collision functions (rebuild if vertices change)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1610,9 +1786,14 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
+RLAPI void SetModelGpuSkinning(Model *model, bool enabled);                                 // Set model skinning mode, GPU skinning keeps vertex data static in VRAM (default shader supported)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI AnimationClip LoadAnimationClip(ModelAnimation anim, float frameRate);                // Load compressed animation clip from model animation (redundant keys removed, 16 bit keys)
+RLAPI void UnloadAnimationClip(AnimationClip clip);                                         // Unload animation clip data
+RLAPI void SampleAnimationClip(AnimationClip clip, float time, Transform *pose);            // Sample animation clip bones pose (model space) at a given time (seconds, looped)
+RLAPI void UpdateModelAnimationClips(Model model, const AnimationClip *clips, const float *times, const float *weights, int clipCount); // Update model animation pose blending animation clips with weights
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
@@ -1621,9 +1802,21 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI RayCollision GetRayCollisionModel(Ray ray, Model model);                                      // Get collision info between ray and model (closest hit of all meshes)
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
+// Broadphase spatial tree functions (3d bodies)
+// NOTE: Bodies are referenced by handles, returned query counts are limited to provided buffers size
+RLAPI SpatialTree *LoadSpatialTree(float margin);                                                   // Load spatial tree (dynamic bounding boxes tree), bodies boxes enlarged by margin
+RLAPI void UnloadSpatialTree(SpatialTree *tree);                                                    // Unload spatial tree
+RLAPI int AddSpatialTreeBody(SpatialTree *tree, BoundingBox box);                                   // Add body to spatial tree, returns body handle
+RLAPI void UpdateSpatialTreeBody(SpatialTree *tree, int handle, BoundingBox box);                   // Update spatial tree body box
+RLAPI void RemoveSpatialTreeBody(SpatialTree *tree, int handle);                                    // Remove body from spatial tree
+RLAPI int GetSpatialTreePairs(SpatialTree *tree, BodyPair *pairs, int maxPairs);                    // Get spatial tree overlapping bodies pairs
+RLAPI int GetSpatialTreeBodiesBox(SpatialTree *tree, BoundingBox box, int *handles, int maxHandles); // Get spatial tree bodies overlapping box
+RLAPI int GetSpatialTreeBodiesRay(SpatialTree *tree, Ray ray, float distance, int *handles, int maxHandles); // Get spatial tree bodies hit by ray, up to distance
+
 //------------------------------------------------------------------------------------
 // Audio Loading and Playing Functions (Module: audio)
 //------------------------------------------------------------------------------------
@@ -1635,6 +1828,8 @@ RLAPI void CloseAudioDevice(void);                                    // Close t
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetAudioVoiceLimit(int count);                             // Set maximum number of voices mixed at once, lowest priority voices are virtualized
+RLAPI AudioVoiceStats GetAudioVoiceStats(void);                       // Get mixer voices stats (playing, mixed, virtualized)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1660,6 +1855,7 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound, lowest priority voices are virtualized first (0 is default)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1683,6 +1879,8 @@ RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pit
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI void SetMusicStreamAsync(Music music, float bufferTime);       // Set music decoded on a background thread, bufferTime seconds ahead (0.0f to disable)
+RLAPI MusicStreamStats GetMusicStreamStats(Music music);              // Get music decoding stats (music decoded on a background thread)
 
 // AudioStream management functions
 RLAPI AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
@@ -1698,6 +1896,7 @@ RLAPI void StopAudioStream(AudioStream stream);                       // Stop au
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
 RLAPI void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (0.5 is centered)
+RLAPI void SetAudioStreamPriority(AudioStream stream, int priority);  // Set priority for audio stream (100 is default, above sounds)
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 RLAPI void SetAudioStreamCallback(AudioStream stream, AudioCallback callback); // Audio thread callback to request new data
 
@@ -485,6 +485,10 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadShaderSkinningDefault(void); // [Module: models] Unloads default GPU skinning shader (if loaded)
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -504,10 +508,6 @@ static void RecordAutomationEvent(void); // Record frame events (to internal eve
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
 #endif
 
-#if !defined(SUPPORT_MODULE_RTEXT)
-const char *TextFormat(const char *text, ...);              // Formatting of text with variables to 'embed'
-#endif // !SUPPORT_MODULE_RTEXT
-
 #if defined(PLATFORM_DESKTOP)
     #define PLATFORM_DESKTOP_GLFW
 #endif
@@ -734,8 +734,16 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadShaderSkinningDefault();  // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+    CloseWorkerPool();          // Close worker threads (if initialized)
+
+    ResetTextFormatArena();     // Free formatted strings arena (calling thread)
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -929,6 +937,10 @@ void EndDrawing(void)
     }
 #endif
 
+    rlResetRenderStats();           // Keep frame render stats, rlGetRenderStats()
+
+    RewindTextFormatArena();        // Formatted strings of this frame expire, TextFormat()
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
@@ -1057,6 +1069,7 @@ void BeginMode3D(Camera camera)
     rlMultMatrixf(MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
 
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
+    rlEnableRenderBatchNormals();   // Enable batch normals for 3D, not written on 2D drawing
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
@@ -1073,6 +1086,7 @@ void EndMode3D(void)
     if (rlGetActiveFramebuffer() == 0) rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
 
     rlDisableDepthTest();           // Disable DEPTH_TEST for 2D
+    rlDisableRenderBatchNormals();  // Disable batch normals for 2D
 }
 
 // Initializes render texture for drawing
@@ -4037,43 +4051,3 @@ static void RecordAutomationEvent(void)
 #endif
 }
 #endif
-
-#if !defined(SUPPORT_MODULE_RTEXT)
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
-{
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS      4        // Maximum number of static buffers for text formatting
-#endif
-#ifndef MAX_TEXT_BUFFER_LENGTH
-    #define MAX_TEXT_BUFFER_LENGTH   1024        // Maximum size of static text buffer
-#endif
-
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
-
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
-
-    va_list args;
-    va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-    va_end(args);
-
-    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
-    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
-    {
-        // Inserting "..." at the end of the string to mark as truncated
-        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-        sprintf(truncBuffer, "...");
-    }
-
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
-
-    return currentBuffer;
-}
-
-#endif // !SUPPORT_MODULE_RTEXT
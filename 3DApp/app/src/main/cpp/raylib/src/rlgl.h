@@ -46,11 +46,16 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RL_BATCH_FLOAT_TEXCOORDS
+*           Store render batch texture coordinates as float values, 16-bit normalized by default,
+*           batches with texture coordinates out of [0..1] range (texture repeat) use a float texcoords buffer
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_UPLOAD_MODE          1    // Default batch vertex data upload mode (rlBatchUploadMode): orphaning
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 *
@@ -215,6 +220,11 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_UPLOAD_MODE
+    // NOTE: Persistent mapping requires OpenGL 4.4 (GL_ARB_buffer_storage) or OpenGL ES 3.0 (GL_EXT_buffer_storage),
+    // orphaning is used if not supported, at least 3 batch buffers recommended to avoid waiting on GPU
+    #define RL_DEFAULT_BATCH_UPLOAD_MODE             1      // Default batch vertex data upload mode (rlBatchUploadMode): orphaning
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
@@ -380,14 +390,27 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// Render batch vertex, interleaved position + texcoords + color (20 bytes)
+// NOTE: Texture coordinates are stored as 16-bit normalized values, limited to [0..1] range, batches with
+// coordinates out of range (i.e. texture repeat) also write them into a float texcoords buffer [rlTexCoord2f()],
+// define RL_BATCH_FLOAT_TEXCOORDS to always keep float values
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ - 3 components, float) (shader-location = 0)
+#if defined(RL_BATCH_FLOAT_TEXCOORDS)
+    float texcoord[2];          // Vertex texture coordinates (UV - 2 components, float) (shader-location = 1)
+#else
+    unsigned short texcoord[2]; // Vertex texture coordinates (UV - 2 components, 16-bit normalized) (shader-location = 1)
+#endif
+    unsigned char color[4];     // Vertex color (RGBA - 4 components, 8-bit normalized) (shader-location = 3)
+} rlBatchVertex;
+
+// Dynamic vertex buffers (interleaved vertex data + normals + indices + float texcoords arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
-    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
-    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    rlBatchVertex *vertices;    // Vertex data, interleaved position, texcoords and color (shader-location = 0, 1, 3)
+    signed char *normals;       // Vertex normal (XYZ + padding - 4 components per vertex, 8-bit normalized) (shader-location = 2), only written on batch normals enabled
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex, float) (shader-location = 1), only written on batch texcoords out of [0..1] range, loaded on first use
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -395,19 +418,23 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (vertex data, normals, indices, float texcoords)
+    void *fence;                // OpenGL sync object, buffer still read by GPU (persistent mapping)
 } rlVertexBuffer;
 
 // Draw call type
-// NOTE: Only texture changes register a new draw, other state-change-related elements are not
-// used at this moment (vaoId, shaderId, matrices), raylib just forces a batch draw call if any
-// of those state-change happens (this is done in core module)
+// NOTE: Only texture changes register a new draw, other state-change-related elements (shader, blending,
+// matrices) force a batch draw call, unless render batch sorting is enabled: shader, blending and layer
+// changes register a new draw and draws are sorted and merged by state on batch drawing
 typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
-    //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
+    unsigned int shaderId;      // Shader id to be used on the draw (sorted batch) -> Using RLGL.currentShaderId by default
+    int *shaderLocs;            // Shader locations to be used on the draw (sorted batch)
+    int blendMode;              // Blending mode to be used on the draw (sorted batch)
+    int layer;                  // Draw layer, draws are only reordered inside the same layer (sorted batch)
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
@@ -423,8 +450,19 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+    int uploadMode;             // Vertex data upload mode (rlBatchUploadMode)
 } rlRenderBatch;
 
+// Render stats, accumulated over a frame
+typedef struct rlRenderStats {
+    int batchFlushes;           // Render batch flushes with vertex data
+    int drawCalls;              // Draw calls issued by render batch flushes
+    int drawCallsSubmitted;     // Draw calls submitted to render batches, before sorted batch merging
+    int vertexCount;            // Vertex count drawn by render batch flushes
+    int uploadSize;             // Vertex data size uploaded (or written to mapped buffers) by render batch flushes (bytes)
+    int bufferWaits;            // Render batch buffer reuses that waited for GPU (persistent mapping)
+} rlRenderStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -592,6 +630,13 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Render batch vertex data upload mode
+typedef enum {
+    RL_BATCH_UPLOAD_SUBDATA = 0,            // Buffers updated in place (glBufferSubData()), driver could stall while GPU reads them
+    RL_BATCH_UPLOAD_ORPHAN,                 // Buffers storage orphaned before update, GPU keeps reading previous storage
+    RL_BATCH_UPLOAD_PERSISTENT              // Buffers persistently mapped, vertex data written directly, reuse fenced (GL_ARB_buffer_storage, GL_EXT_buffer_storage)
+} rlBatchUploadMode;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -728,6 +773,14 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI void rlSetRenderBatchUploadMode(int mode);        // Set vertex data upload mode for render batches loaded afterwards (rlBatchUploadMode)
+RLAPI void rlEnableRenderBatchNormals(void);            // Enable render batch normals, written and uploaded with vertex data (3D drawing)
+RLAPI void rlDisableRenderBatchNormals(void);           // Disable render batch normals
+RLAPI void rlEnableRenderBatchSorting(void);            // Enable render batch sorting, draws merged by state (shader, blending, texture) on batch drawing
+RLAPI void rlDisableRenderBatchSorting(void);           // Disable render batch sorting, draws issued in submission order
+RLAPI void rlSetRenderBatchLayer(int layer);            // Set draws layer for sorted render batch, draws are only reordered inside the same layer
+RLAPI rlRenderStats rlGetRenderStats(void);             // Get render stats of last completed frame
+RLAPI void rlResetRenderStats(void);                    // Reset render stats, current frame stats kept as last frame stats
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -865,6 +918,17 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #include <GLES3/gl3.h>              // OpenGL ES 3.0 library
     #define GL_GLEXT_PROTOTYPES
     #include <GLES2/gl2ext.h>           // OpenGL ES 2.0 extensions library
+
+    // Buffers persistent mapping is exposed through extension (GL_EXT_buffer_storage)
+    #ifndef GL_MAP_PERSISTENT_BIT
+        #define GL_MAP_PERSISTENT_BIT   0x0040
+    #endif
+    #ifndef GL_MAP_COHERENT_BIT
+        #define GL_MAP_COHERENT_BIT     0x0080
+    #endif
+    #ifndef GL_DYNAMIC_STORAGE_BIT
+        #define GL_DYNAMIC_STORAGE_BIT  0x0100
+    #endif
 #elif defined(GRAPHICS_API_OPENGL_ES2)
     // NOTE: OpenGL ES 2.0 can be enabled on Desktop platforms,
     // in that case, functions are loaded from a custom glad for OpenGL ES 2.0
@@ -888,7 +952,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <stddef.h>                     // Required for: offsetof() [Used in render batch vertex attributes]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -1046,9 +1111,17 @@ typedef struct rlglData {
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
-        float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
-        float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
-        unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+        rlBatchVertex vertex;               // Current active texture coordinate and color (added on glVertex*())
+        signed char normal[4];              // Current active normal (added on glVertex*(), if batch normals enabled)
+        float texcoord[2];                  // Current active texture coordinate, float (added on glVertex*(), if batch float texcoords)
+        bool batchNormals;                  // Batch normals enabled, normals written and uploaded (3D drawing)
+        bool batchFloatTexcoords;           // Batch float texcoords, written and uploaded on texcoords out of [0..1] range, reset on batch drawing
+        bool batchSorting;                  // Batch sorting enabled, draws sorted and merged by state on batch drawing
+        int batchLayer;                     // Current draws layer (sorted batch)
+        rlBatchVertex *sortVertices;        // Sorted batch vertex data scratch buffer
+        signed char *sortNormals;           // Sorted batch normals scratch buffer
+        float *sortTexcoords;               // Sorted batch float texcoords scratch buffer
+        int sortCapacity;                   // Sorted batch scratch buffers capacity (vertex count)
 
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -1088,6 +1161,10 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        int batchUploadMode;                // Vertex data upload mode for render batches loaded
+        rlRenderStats stats;                // Render stats, current frame
+        rlRenderStats lastStats;            // Render stats, last completed frame
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1106,6 +1183,7 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Buffers persistent mapping support (GL_ARB_buffer_storage, GL_EXT_buffer_storage)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -1139,12 +1217,28 @@ static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #endif
 
+#if defined(GRAPHICS_API_OPENGL_ES3)
+// NOTE: Buffer storage functionality is exposed through extension (EXT)
+static PFNGLBUFFERSTORAGEEXTPROC glBufferStorage = NULL;
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadRenderBatchBuffer(int size, const void *data, int uploadMode); // Load render batch vertex buffer storage (bound buffer)
+static void rlSetRenderBatchAttribs(const int *locs);   // Set render batch interleaved vertex attributes (bound buffer)
+static void rlSetRenderBatchShader(rlRenderBatch *batch, unsigned int id, int *locs); // Set render batch drawing shader, matrices and default values
+#if !defined(RL_BATCH_FLOAT_TEXCOORDS)
+static void rlSetRenderBatchFloatTexcoords(void);       // Set current render batch float texcoords, texcoords out of [0..1] range
+#endif
+static void rlSetDrawCallState(rlDrawCall *draw);       // Set draw call state from current state (shader, blending, layer)
+static void rlAddRenderBatchDraw(void);                 // Add a new draw to current render batch, keeping draw mode and texture (sorted batch)
+static void rlSortRenderBatch(rlRenderBatch *batch);    // Sort render batch draws by state and merge draws sharing state
+static unsigned long long rlGetDrawCallSortKey(const rlDrawCall *draw); // Get draw call sort key
+static void rlApplyBlendMode(int mode);                 // Apply blending mode to OpenGL state
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1481,6 +1575,7 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        rlSetDrawCallState(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
     }
 }
 
@@ -1534,25 +1629,36 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
-    // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
-
-    // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
-
-    // Add current normal
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
+    // Add vertex position, current texcoord and color
+    // NOTE: Vertex data written in order, batch buffers could be persistently mapped (write-combined memory)
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[RLGL.State.vertexCounter];
+    vertex->position[0] = tx;
+    vertex->position[1] = ty;
+    vertex->position[2] = tz;
+    vertex->texcoord[0] = RLGL.State.vertex.texcoord[0];
+    vertex->texcoord[1] = RLGL.State.vertex.texcoord[1];
+    vertex->color[0] = RLGL.State.vertex.color[0];
+    vertex->color[1] = RLGL.State.vertex.color[1];
+    vertex->color[2] = RLGL.State.vertex.color[2];
+    vertex->color[3] = RLGL.State.vertex.color[3];
+
+    // Add current normal, only required for 3D drawing
+    if (RLGL.State.batchNormals)
+    {
+        signed char *normal = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[4*RLGL.State.vertexCounter];
+        normal[0] = RLGL.State.normal[0];
+        normal[1] = RLGL.State.normal[1];
+        normal[2] = RLGL.State.normal[2];
+        normal[3] = 0;
+    }
 
-    // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    // Add current float texcoord, only required for texcoords out of [0..1] range
+    if (RLGL.State.batchFloatTexcoords)
+    {
+        float *texcoord = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter];
+        texcoord[0] = RLGL.State.texcoord[0];
+        texcoord[1] = RLGL.State.texcoord[1];
+    }
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1574,8 +1680,26 @@ void rlVertex2i(int x, int y)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
-    RLGL.State.texcoordx = x;
-    RLGL.State.texcoordy = y;
+#if defined(RL_BATCH_FLOAT_TEXCOORDS)
+    RLGL.State.vertex.texcoord[0] = x;
+    RLGL.State.vertex.texcoord[1] = y;
+#else
+    // Values out of [0..1] range switch current batch to float texcoords (i.e. texture repeat)
+    // NOTE: Batch is not drawn, previous vertex texcoords are kept, switch is reset on batch drawing
+    RLGL.State.texcoord[0] = x;
+    RLGL.State.texcoord[1] = y;
+    if (!RLGL.State.batchFloatTexcoords && ((x < 0.0f) || (x > 1.0f) || (y < 0.0f) || (y > 1.0f))) rlSetRenderBatchFloatTexcoords();
+
+    // Texture coordinates packed to 16-bit normalized values
+    // NOTE: Values out of [0..1] range are clamped, float texcoords used for drawing
+    if (x < 0.0f) x = 0.0f;
+    else if (x > 1.0f) x = 1.0f;
+    if (y < 0.0f) y = 0.0f;
+    else if (y > 1.0f) y = 1.0f;
+
+    RLGL.State.vertex.texcoord[0] = (unsigned short)(x*65535.0f + 0.5f);
+    RLGL.State.vertex.texcoord[1] = (unsigned short)(y*65535.0f + 0.5f);
+#endif
 }
 
 // Define one vertex (normal)
@@ -1599,18 +1723,20 @@ void rlNormal3f(float x, float y, float z)
         normaly *= ilength;
         normalz *= ilength;
     }
-    RLGL.State.normalx = normalx;
-    RLGL.State.normaly = normaly;
-    RLGL.State.normalz = normalz;
+
+    // Normal packed to 8-bit normalized values
+    RLGL.State.normal[0] = (signed char)((normalx < 0.0f)? (normalx*127.0f - 0.5f) : (normalx*127.0f + 0.5f));
+    RLGL.State.normal[1] = (signed char)((normaly < 0.0f)? (normaly*127.0f - 0.5f) : (normaly*127.0f + 0.5f));
+    RLGL.State.normal[2] = (signed char)((normalz < 0.0f)? (normalz*127.0f - 0.5f) : (normalz*127.0f + 0.5f));
 }
 
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
-    RLGL.State.colorr = x;
-    RLGL.State.colorg = y;
-    RLGL.State.colorb = z;
-    RLGL.State.colora = w;
+    RLGL.State.vertex.color[0] = x;
+    RLGL.State.vertex.color[1] = y;
+    RLGL.State.vertex.color[2] = z;
+    RLGL.State.vertex.color[3] = w;
 }
 
 // Define one vertex (color)
@@ -1677,6 +1803,7 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            rlSetDrawCallState(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
         }
 #endif
     }
@@ -2103,34 +2230,17 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: Sorted batch records blending mode per draw but custom blending factors are not recorded,
+        // batch is drawn when changing to a custom blending mode
+        if (!RLGL.State.batchSorting || (mode == RL_BLEND_CUSTOM) || (mode == RL_BLEND_CUSTOM_SEPARATE)) rlDrawRenderBatch(RLGL.currentBatch);
 
-        switch (mode)
-        {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-
-            } break;
-            case RL_BLEND_CUSTOM_SEPARATE:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
-                glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
-                glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
-
-            } break;
-            default: break;
-        }
+        // NOTE: Blending mode is applied immediately, also used by drawing not going through the batch
+        rlApplyBlendMode(mode);
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
+
+        if (RLGL.State.batchSorting) rlAddRenderBatchDraw();
     }
 #endif
 }
@@ -2274,6 +2384,7 @@ void rlglInit(int width, int height)
     // Init default vertex arrays buffers
     // Simulate that the default shader has the location RL_SHADER_LOC_VERTEX_NORMAL to bind the normal buffer for the default render batch
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
+    RLGL.State.batchUploadMode = RL_DEFAULT_BATCH_UPLOAD_MODE;
     RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
     RLGL.currentBatch = &RLGL.defaultBatch;
@@ -2336,6 +2447,15 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload sorted batch scratch buffers
+    RL_FREE(RLGL.State.sortVertices);
+    RL_FREE(RLGL.State.sortNormals);
+    RL_FREE(RLGL.State.sortTexcoords);
+    RLGL.State.sortVertices = NULL;
+    RLGL.State.sortNormals = NULL;
+    RLGL.State.sortTexcoords = NULL;
+    RLGL.State.sortCapacity = 0;
+
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
@@ -2394,6 +2514,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glFenceSync != NULL);  // Buffers persistent mapping (OpenGL 4.4)
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2424,6 +2545,20 @@ void rlLoadExtensions(void *loader)
     //RLGL.ExtSupported.computeShader = true;
     //RLGL.ExtSupported.ssbo = true;
 
+    // Check buffers persistent mapping support (GL_EXT_buffer_storage)
+    GLint numExt = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+
+    for (int i = 0; i < numExt; i++)
+    {
+        if (strcmp((const char *)glGetStringi(GL_EXTENSIONS, i), (const char *)"GL_EXT_buffer_storage") == 0)
+        {
+            glBufferStorage = (PFNGLBUFFERSTORAGEEXTPROC)((rlglLoadProc)loader)("glBufferStorageEXT");
+            if (glBufferStorage != NULL) RLGL.ExtSupported.bufferStorage = true;
+            break;
+        }
+    }
+
 #elif defined(GRAPHICS_API_OPENGL_ES2)
 
     #if defined(PLATFORM_DESKTOP_GLFW) || defined(PLATFORM_DESKTOP_SDL)
@@ -2629,6 +2764,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Buffers persistent mapping supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2732,7 +2868,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    // Initialize CPU (RAM) vertex buffers (interleaved vertex data, normals and indexes)
     //--------------------------------------------------------------------------------------------
     batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
 
@@ -2740,21 +2876,17 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        batch.vertexBuffer[i].vertices = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+        batch.vertexBuffer[i].normals = (signed char *)RL_CALLOC(bufferElements*4*4, sizeof(signed char));      // 4 components by normal, 4 vertex by quad
+        batch.vertexBuffer[i].texcoords = NULL;     // Float texcoords loaded on first use [rlSetRenderBatchFloatTexcoords()]
+        batch.vertexBuffer[i].vboId[3] = 0;
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
-
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        batch.vertexBuffer[i].fence = NULL;
 
         int k = 0;
 
@@ -2779,6 +2911,19 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
     //--------------------------------------------------------------------------------------------
+    batch.uploadMode = RLGL.State.batchUploadMode;
+
+    if ((batch.uploadMode == RL_BATCH_UPLOAD_PERSISTENT) && !RLGL.ExtSupported.bufferStorage)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Buffers persistent mapping not supported, render batch buffers orphaning used");
+        batch.uploadMode = RL_BATCH_UPLOAD_ORPHAN;
+    }
+
+    if ((batch.uploadMode == RL_BATCH_UPLOAD_PERSISTENT) && (numBuffers < 2))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Render batch persistent mapping with a single buffer, every flush waits for GPU");
+    }
+
     for (int i = 0; i < numBuffers; i++)
     {
         if (RLGL.ExtSupported.vao)
@@ -2789,37 +2934,22 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         }
 
         // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
+        // Vertex data buffer, interleaved: position, texcoord and color (shader-location = 0, 1, 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        rlLoadRenderBatchBuffer(bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].vertices, batch.uploadMode);
+        rlSetRenderBatchAttribs(RLGL.State.currentShaderLocs);
 
-        // Vertex texcoord buffer (shader-location = 1)
+        // Vertex normal buffer (shader-location = 2)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+        rlLoadRenderBatchBuffer(bufferElements*4*4*sizeof(signed char), batch.vertexBuffer[i].normals, batch.uploadMode);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_BYTE, GL_TRUE, 4*sizeof(signed char), 0);
 
         // Fill index buffer
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
 #if defined(GRAPHICS_API_OPENGL_33)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
@@ -2828,6 +2958,62 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #endif
     }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (batch.uploadMode == RL_BATCH_UPLOAD_PERSISTENT)
+    {
+        // Map vertex buffers once, CPU vertex arrays are replaced by mapped buffers memory
+        // NOTE: Buffers storage is immutable, if mapping fails buffers are updated in place
+        GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const int bufferSizes[2] = { bufferElements*4*sizeof(rlBatchVertex), bufferElements*4*4*sizeof(signed char) };
+        void *mapped[2] = { 0 };
+
+        for (int i = 0; (i < numBuffers) && (batch.uploadMode == RL_BATCH_UPLOAD_PERSISTENT); i++)
+        {
+            for (int k = 0; k < 2; k++)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[k]);
+                mapped[k] = glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSizes[k], mapFlags);
+            }
+
+            if ((mapped[0] != NULL) && (mapped[1] != NULL))
+            {
+                RL_FREE(batch.vertexBuffer[i].vertices);
+                RL_FREE(batch.vertexBuffer[i].normals);
+
+                batch.vertexBuffer[i].vertices = (rlBatchVertex *)mapped[0];
+                batch.vertexBuffer[i].normals = (signed char *)mapped[1];
+            }
+            else
+            {
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, buffers updated in place");
+
+                // Unmap previously mapped buffers, CPU vertex arrays are kept
+                for (int j = 0; j <= i; j++)
+                {
+                    for (int k = 0; k < 2; k++)
+                    {
+                        if ((j == i) && (mapped[k] == NULL)) continue;
+
+                        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[j].vboId[k]);
+                        glUnmapBuffer(GL_ARRAY_BUFFER);
+                    }
+
+                    if (j < i)
+                    {
+                        // Previously mapped buffers get new RAM vertex arrays
+                        batch.vertexBuffer[j].vertices = (rlBatchVertex *)RL_CALLOC(bufferSizes[0], 1);
+                        batch.vertexBuffer[j].normals = (signed char *)RL_CALLOC(bufferSizes[1], 1);
+                    }
+                }
+
+                batch.uploadMode = RL_BATCH_UPLOAD_SUBDATA;
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+#endif
+
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
@@ -2844,8 +3030,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.draws[i].vertexCount = 0;
         batch.draws[i].vertexAlignment = 0;
         //batch.draws[i].vaoId = 0;
-        //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        rlSetDrawCallState(&batch.draws[i]);
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2885,18 +3071,25 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        if (batch.vertexBuffer[i].vboId[3] != 0) glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+        // Delete pending sync object, buffers are unmapped on deletion
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
+
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        // NOTE: Persistently mapped vertex arrays point to deleted buffers memory
+        if (batch.uploadMode != RL_BATCH_UPLOAD_PERSISTENT)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+            RL_FREE(batch.vertexBuffer[i].normals);
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
+        RL_FREE(batch.vertexBuffer[i].texcoords);
     }
 
     // Unload arrays
@@ -2916,43 +3109,49 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
+        RLGL.State.stats.drawCallsSubmitted += batch->drawCounter;
+
+        // Sort draws by state, vertex data reordered to merge draws sharing state
+        if (RLGL.State.batchSorting && (batch->drawCounter > 1)) rlSortRenderBatch(batch);
+
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        // NOTE: Persistently mapped buffers already contain vertex data, written on rlVertex3f()
+        if (batch->uploadMode != RL_BATCH_UPLOAD_PERSISTENT)
+        {
+            // NOTE: Orphaning re-specifies buffer storage with no data before the update, driver provides
+            // a new storage immediately while GPU keeps reading the previous one, avoiding a sync stall
+            bool orphan = (batch->uploadMode == RL_BATCH_UPLOAD_ORPHAN);
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer()
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
+            // Vertex data buffer (interleaved)
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            if (orphan) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlBatchVertex), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].vertices);
+
+            // Normals buffer, only updated if normals are written (3D drawing)
+            if (RLGL.State.batchNormals)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+                if (orphan) glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*4*sizeof(signed char), NULL, GL_DYNAMIC_DRAW);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(signed char), batch->vertexBuffer[batch->currentBuffer].normals);
+            }
+        }
+
+        // Float texcoords buffer, only updated if texcoords out of [0..1] range are written
+        // NOTE: Buffer is not persistently mapped, always orphaned before the update
+        if (RLGL.State.batchFloatTexcoords)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*2*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+        }
+
+        RLGL.State.stats.batchFlushes++;
+        RLGL.State.stats.vertexCount += RLGL.State.vertexCounter;
+        RLGL.State.stats.uploadSize += RLGL.State.vertexCounter*sizeof(rlBatchVertex);
+        if (RLGL.State.batchNormals) RLGL.State.stats.uploadSize += RLGL.State.vertexCounter*4*sizeof(signed char);
+        if (RLGL.State.batchFloatTexcoords) RLGL.State.stats.uploadSize += RLGL.State.vertexCounter*2*sizeof(float);
 
         // Unbind the current VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2983,65 +3182,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Draw buffers
         if (RLGL.State.vertexCounter > 0)
         {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
-
-            // Create modelview-projection matrix and upload to shader
-            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
-            }
-
-            // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
-            // transformations and rendering occur between rlPushMatrix() and rlPopMatrix()
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
-            }
-
-            if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
-            {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
-            }
+            // NOTE: Sorted batch draws set their own shader and blending mode
+            bool sorted = RLGL.State.batchSorting;
+            unsigned int shaderId = sorted? batch->draws[0].shaderId : RLGL.State.currentShaderId;
+            int blendMode = RLGL.State.currentBlendMode;
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
 
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
-            }
-
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            // Set current shader and upload current MVP matrix
+            rlSetRenderBatchShader(batch, shaderId, sorted? batch->draws[0].shaderLocs : RLGL.State.currentShaderLocs);
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -3060,6 +3209,21 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                if (sorted)
+                {
+                    if (batch->draws[i].shaderId != shaderId)
+                    {
+                        shaderId = batch->draws[i].shaderId;
+                        rlSetRenderBatchShader(batch, shaderId, batch->draws[i].shaderLocs);
+                    }
+
+                    if (batch->draws[i].blendMode != blendMode)
+                    {
+                        blendMode = batch->draws[i].blendMode;
+                        rlApplyBlendMode(blendMode);
+                    }
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
@@ -3078,6 +3242,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 }
 
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+                RLGL.State.stats.drawCalls++;
             }
 
             if (!RLGL.ExtSupported.vao)
@@ -3087,6 +3252,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+
+            // Restore current blending mode
+            if (blendMode != RLGL.State.currentBlendMode) rlApplyBlendMode(RLGL.State.currentBlendMode);
         }
 
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
@@ -3096,6 +3264,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Fence persistently mapped buffer, vertex data can not be written again until GPU is done reading it
+    if ((batch->uploadMode == RL_BATCH_UPLOAD_PERSISTENT) && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3103,6 +3279,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
 
+    // Reset float texcoords, next batch texcoords packed while in [0..1] range
+    RLGL.State.batchFloatTexcoords = false;
+
     // Reset depth for next draw
     batch->currentDepth = -1.0f;
 
@@ -3116,6 +3295,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        rlSetDrawCallState(&batch->draws[i]);
     }
 
     // Reset active texture units for next batch
@@ -3128,6 +3308,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Wait for GPU to finish reading next buffer before writing into it (persistent mapping)
+    // NOTE: With enough buffers in the ring, the fence is usually signaled already
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            RLGL.State.stats.bufferWaits++;
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);  // Timeout: 1 second
+        }
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3171,12 +3370,114 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+
+#if !defined(RL_BATCH_FLOAT_TEXCOORDS)
+        // Restore float texcoords if current texcoord is out of [0..1] range
+        if ((RLGL.State.texcoord[0] < 0.0f) || (RLGL.State.texcoord[0] > 1.0f) ||
+            (RLGL.State.texcoord[1] < 0.0f) || (RLGL.State.texcoord[1] > 1.0f)) rlSetRenderBatchFloatTexcoords();
+#endif
     }
 #endif
 
     return overflow;
 }
 
+// Set vertex data upload mode for render batches loaded afterwards
+// NOTE: Persistent mapping is set on batch loading, default internal batch uses RL_DEFAULT_BATCH_UPLOAD_MODE
+void rlSetRenderBatchUploadMode(int mode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.batchUploadMode = mode;
+#endif
+}
+
+// Enable render batch normals, written and uploaded with vertex data (3D drawing)
+// NOTE: Batch is drawn on state change, normals data is kept for the whole batch
+void rlEnableRenderBatchNormals(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.batchNormals)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchNormals = true;
+    }
+#endif
+}
+
+// Disable render batch normals
+// NOTE: Normals attribute is set to default normal (0, 0, 1) on batch drawing
+void rlDisableRenderBatchNormals(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchNormals)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchNormals = false;
+    }
+#endif
+}
+
+// Enable render batch sorting
+// NOTE: Shader, blending and layer changes register a new draw instead of drawing the batch,
+// draws are sorted by state inside every layer and draws sharing state merged on batch drawing,
+// draws order is only kept between layers, overlapping translucent drawing must use layers
+void rlEnableRenderBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.batchSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchSorting = true;
+        rlSetDrawCallState(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
+    }
+#endif
+}
+
+// Disable render batch sorting
+void rlDisableRenderBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchSorting = false;
+    }
+#endif
+}
+
+// Set draws layer for sorted render batch
+// NOTE: Draws are sorted by layer first, lower layers are drawn first, valid range: [-32768..32767]
+void rlSetRenderBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchLayer != layer)
+    {
+        RLGL.State.batchLayer = layer;
+        if (RLGL.State.batchSorting) rlAddRenderBatchDraw();
+    }
+#endif
+}
+
+// Get render stats of last completed frame
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.lastStats;
+#endif
+    return stats;
+}
+
+// Reset render stats, current frame stats kept as last frame stats
+// NOTE: Called on frame end, EndDrawing()
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.lastStats = RLGL.State.stats;
+    RLGL.State.stats = (rlRenderStats){ 0 };
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -4409,9 +4710,13 @@ void rlSetShader(unsigned int id, int *locs)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        // NOTE: Sorted batch records shader per draw, shader values are shared by all the draws of the batch
+        if (!RLGL.State.batchSorting) rlDrawRenderBatch(RLGL.currentBatch);
+
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
+
+        if (RLGL.State.batchSorting) rlAddRenderBatchDraw();
     }
 #endif
 }
@@ -5000,6 +5305,322 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load render batch vertex buffer storage (bound GL_ARRAY_BUFFER)
+// NOTE: Persistent mapping requires immutable buffer storage, mapped once on batch loading
+static void rlLoadRenderBatchBuffer(int size, const void *data, int uploadMode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (uploadMode == RL_BATCH_UPLOAD_PERSISTENT)
+    {
+        // NOTE: Dynamic storage allows in place updates if buffers mapping fails
+        glBufferStorage(GL_ARRAY_BUFFER, size, data, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_DYNAMIC_STORAGE_BIT);
+        return;
+    }
+#endif
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+}
+
+// Set render batch interleaved vertex attributes (bound GL_ARRAY_BUFFER): position, texcoord, color
+static void rlSetRenderBatchAttribs(const int *locs)
+{
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+#if defined(RL_BATCH_FLOAT_TEXCOORDS)
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+#else
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+#endif
+
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+}
+
+// Set render batch drawing shader: shader program, matrices and default shader values
+// NOTE: Vertex attributes are set for shader locations if VAO is not supported
+static void rlSetRenderBatchShader(rlRenderBatch *batch, unsigned int id, int *locs)
+{
+    glUseProgram(id);
+
+    // Create modelview-projection matrix and upload to shader
+    Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+    glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+
+    if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+    }
+
+    // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
+    // transformations and rendering occur between rlPushMatrix() and rlPopMatrix()
+
+    if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+    }
+
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
+    {
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+    }
+
+    if (!RLGL.ExtSupported.vao)
+    {
+        // Bind vertex attribs: position, texcoord, color (shader-location = 0, 1, 3)
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        rlSetRenderBatchAttribs(locs);
+
+        // Bind vertex attrib: normal (shader-location = 2)
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_BYTE, GL_TRUE, 4*sizeof(signed char), 0);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+    }
+
+    // Normals attribute, default normal (0, 0, 1) if batch normals are not written (2D drawing)
+    // NOTE: VAO attributes are set on default shader locations, shaders attributes are bound to them on loading
+    int normalLoc = RLGL.ExtSupported.vao? RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL : locs[RL_SHADER_LOC_VERTEX_NORMAL];
+    if (normalLoc != -1)
+    {
+        if (RLGL.State.batchNormals) glEnableVertexAttribArray(normalLoc);
+        else
+        {
+            glDisableVertexAttribArray(normalLoc);
+            glVertexAttrib3f(normalLoc, 0.0f, 0.0f, 1.0f);
+        }
+    }
+
+#if !defined(RL_BATCH_FLOAT_TEXCOORDS)
+    // Texcoords attribute from float texcoords buffer, if batch texcoords out of [0..1] range
+    // NOTE: Once float texcoords buffer is loaded, VAO attribute is restored to interleaved vertex data for packed texcoords
+    int texcoordLoc = RLGL.ExtSupported.vao? RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD : locs[RL_SHADER_LOC_VERTEX_TEXCOORD01];
+
+    if (texcoordLoc != -1)
+    {
+        if (RLGL.State.batchFloatTexcoords)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glVertexAttribPointer(texcoordLoc, 2, GL_FLOAT, GL_FALSE, 2*sizeof(float), 0);
+        }
+        else if (batch->vertexBuffer[batch->currentBuffer].vboId[3] != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glVertexAttribPointer(texcoordLoc, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+        }
+    }
+#endif
+
+    // Setup some default shader values
+    glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+}
+
+#if !defined(RL_BATCH_FLOAT_TEXCOORDS)
+// Set current render batch float texcoords, required by texcoords out of [0..1] range (texture repeat)
+// NOTE: Float texcoords buffer is loaded on first use, previous vertex texcoords are converted from packed values
+static void rlSetRenderBatchFloatTexcoords(void)
+{
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+    if (buffer->texcoords == NULL)
+    {
+        buffer->texcoords = (float *)RL_CALLOC(buffer->elementCount*4*2, sizeof(float));     // 2 components by texcoord, 4 vertex by quad
+
+        glGenBuffers(1, &buffer->vboId[3]);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[3]);
+        glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*2*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // NOTE: Persistently mapped vertex data is slow to read (write-combined memory), only read once per batch
+    for (int i = 0; i < RLGL.State.vertexCounter; i++)
+    {
+        buffer->texcoords[2*i] = (float)buffer->vertices[i].texcoord[0]/65535.0f;
+        buffer->texcoords[2*i + 1] = (float)buffer->vertices[i].texcoord[1]/65535.0f;
+    }
+
+    RLGL.State.batchFloatTexcoords = true;
+}
+#endif
+
+// Set draw call state from current state: shader, blending mode and layer
+static void rlSetDrawCallState(rlDrawCall *draw)
+{
+    draw->shaderId = RLGL.State.currentShaderId;
+    draw->shaderLocs = RLGL.State.currentShaderLocs;
+    draw->blendMode = RLGL.State.currentBlendMode;
+    draw->layer = RLGL.State.batchLayer;
+}
+
+// Add a new draw to current render batch, keeping current draw mode and texture
+// NOTE: Used by sorted batch on state changes (shader, blending, layer), new state is recorded on the draw
+static void rlAddRenderBatchDraw(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        // Make sure current draw vertexCount is aligned a multiple of 4 (QUADS index processing)
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+        draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        draw->mode = mode;
+        draw->vertexCount = 0;
+        draw->textureId = textureId;
+    }
+
+    rlSetDrawCallState(draw);
+}
+
+// Sort render batch draws by state and merge consecutive draws sharing state
+// NOTE: Vertex data is reordered in place (read back from persistently mapped buffers, slower),
+// merged draws are aligned to 4 vertex, batch is drawn unsorted if reordered data does not fit
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int capacity = buffer->elementCount*4;
+    int drawCount = batch->drawCounter;
+
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    unsigned long long keys[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    rlDrawCall merged[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int mergedCount = 0;
+
+    // Get draws vertex offsets and sort keys
+    for (int i = 0, offset = 0; i < drawCount; i++)
+    {
+        offsets[i] = offset;
+        offset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+        keys[i] = rlGetDrawCallSortKey(&batch->draws[i]);
+    }
+
+    // Sort draws by key, insertion sort keeps submission order for draws with same key
+    for (int i = 0; i < drawCount; i++)
+    {
+        int j = i;
+        while ((j > 0) && (keys[order[j - 1]] > keys[i])) { order[j] = order[j - 1]; j--; }
+        order[j] = i;
+    }
+
+    if (RLGL.State.sortCapacity < capacity)
+    {
+        RLGL.State.sortVertices = (rlBatchVertex *)RL_REALLOC(RLGL.State.sortVertices, capacity*sizeof(rlBatchVertex));
+        RLGL.State.sortNormals = (signed char *)RL_REALLOC(RLGL.State.sortNormals, capacity*4*sizeof(signed char));
+        RLGL.State.sortTexcoords = (float *)RL_REALLOC(RLGL.State.sortTexcoords, capacity*2*sizeof(float));
+        RLGL.State.sortCapacity = capacity;
+    }
+
+    // Copy draws vertex data in sorted order, merging draws sharing state
+    int vertexCount = 0;
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[order[i]];
+        if (draw->vertexCount == 0) continue;
+
+        rlDrawCall *last = (mergedCount > 0)? &merged[mergedCount - 1] : NULL;
+
+        if ((last != NULL) && (last->layer == draw->layer) && (last->shaderId == draw->shaderId) &&
+            (last->blendMode == draw->blendMode) && (last->textureId == draw->textureId) && (last->mode == draw->mode))
+        {
+            last->vertexCount += draw->vertexCount;
+        }
+        else
+        {
+            if (last != NULL)
+            {
+                last->vertexAlignment = (4 - last->vertexCount%4)%4;
+                vertexCount += last->vertexAlignment;
+            }
+
+            merged[mergedCount] = *draw;
+            merged[mergedCount].vertexAlignment = 0;
+            mergedCount++;
+        }
+
+        if ((vertexCount + draw->vertexCount) > capacity) return;
+
+        memcpy(RLGL.State.sortVertices + vertexCount, buffer->vertices + offsets[order[i]], draw->vertexCount*sizeof(rlBatchVertex));
+        if (RLGL.State.batchNormals) memcpy(RLGL.State.sortNormals + vertexCount*4, buffer->normals + offsets[order[i]]*4, draw->vertexCount*4*sizeof(signed char));
+        if (RLGL.State.batchFloatTexcoords) memcpy(RLGL.State.sortTexcoords + vertexCount*2, buffer->texcoords + offsets[order[i]]*2, draw->vertexCount*2*sizeof(float));
+
+        vertexCount += draw->vertexCount;
+    }
+
+    // Replace batch vertex data and draws
+    memcpy(buffer->vertices, RLGL.State.sortVertices, vertexCount*sizeof(rlBatchVertex));
+    if (RLGL.State.batchNormals) memcpy(buffer->normals, RLGL.State.sortNormals, vertexCount*4*sizeof(signed char));
+    if (RLGL.State.batchFloatTexcoords) memcpy(buffer->texcoords, RLGL.State.sortTexcoords, vertexCount*2*sizeof(float));
+
+    for (int i = 0; i < mergedCount; i++) batch->draws[i] = merged[i];
+
+    batch->drawCounter = mergedCount;
+    RLGL.State.vertexCounter = vertexCount;
+}
+
+// Get draw call sort key: layer, shader, blending mode, texture and drawing mode (from most to least significant bits)
+// NOTE: Key only defines draws order, draws are merged if they share the whole state
+static unsigned long long rlGetDrawCallSortKey(const rlDrawCall *draw)
+{
+    unsigned long long key = 0;
+
+    key |= (unsigned long long)((draw->layer + 32768) & 0xffff) << 48;
+    key |= (unsigned long long)(draw->shaderId & 0xffff) << 32;
+    key |= (unsigned long long)(draw->blendMode & 0xff) << 24;
+    key |= (unsigned long long)(draw->textureId & 0xfffff) << 4;
+    key |= (unsigned long long)(draw->mode & 0xf);
+
+    return key;
+}
+
+// Apply blending mode to OpenGL state
+static void rlApplyBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
+            glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
+            glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+
+        } break;
+        default: break;
+    }
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -5117,13 +5738,12 @@ static int rlGetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    // Most compressed formats works on 4x4 blocks (ASTC 8x8 on 8x8 blocks),
+    // data size is rounded up to full blocks (PVRT minimum data size is 16)
+    if (((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
+    else if ((format >= RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) dataSize = 16;
 
     return dataSize;
 }
@@ -57,6 +57,7 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -115,6 +116,18 @@
     #endif
 #endif
 
+// SIMD instructions set used on CPU skinning [UpdateModelAnimation()]
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: float32x4_t, vmlaq_n_f32(), vld1q_f32()...
+    #define SKINNING_SIMD_NEON
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #if defined(__FMA__)
+        #include <immintrin.h>  // Required for: _mm_fmadd_ps()
+    #endif
+    #include <xmmintrin.h>      // Required for: __m128, _mm_mul_ps(), _mm_add_ps(), _mm_loadu_ps()...
+    #define SKINNING_SIMD_SSE
+#endif
+
 #if defined(_WIN32)
     #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
     #define CHDIR _chdir
@@ -132,16 +145,69 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef SKINNING_VERTEX_RANGE
+    #define SKINNING_VERTEX_RANGE 2048    // Minimum vertices per range on multi-threaded CPU skinning
+#endif
+#ifndef MAX_GPU_SKINNING_BONES
+    #define MAX_GPU_SKINNING_BONES  64    // Maximum bones per mesh supported by default GPU skinning shader
+#endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  4    // Maximum triangles per mesh BVH leaf node
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      64    // Maximum mesh BVH depth, deeper nodes are kept as leaf nodes
+#endif
+#ifndef ANIMATION_KEY_TOLERANCE
+    #define ANIMATION_KEY_TOLERANCE 0.0005f // Maximum error of animation clip keys interpolation, on keys removal
+#endif
+
+#define SKINNING_STRINGIFY(x) #x
+#define SKINNING_TOSTRING(x) SKINNING_STRINGIFY(x)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// CPU skinning job data, shared by all vertex ranges of a mesh
+typedef struct SkinningJob {
+    const float *palette;           // Bones matrices palette, 4 columns (xyz0) per bone
+    const float *vertices;          // Base vertex positions
+    const float *normals;           // Base vertex normals (optional)
+    const unsigned char *boneIds;   // Vertex bone ids, 4 per vertex
+    const float *boneWeights;       // Vertex bone weights, 4 per vertex
+    float *animVertices;            // Skinned vertex positions
+    float *animNormals;             // Skinned vertex normals (optional)
+} SkinningJob;
+
+// Spatial tree node, leaf nodes are bodies
+typedef struct SpatialTreeNode {
+    BoundingBox box;                // Node box, enlarged by tree margin on leaf nodes
+    int parent;                     // Parent node (next free node for free nodes)
+    int child1;                     // First child node (-1 for leaf nodes)
+    int child2;                     // Second child node (-1 for leaf nodes)
+    int height;                     // Node height, 0 for leaf nodes, -1 for free nodes
+} SpatialTreeNode;
+
+// Spatial tree, dynamic bounding boxes tree for 3d broadphase
+// NOTE: Leaf nodes index are used as bodies handles, tree is kept balanced with
+// rotations and bodies are only reinserted when moving out of their enlarged box
+struct SpatialTree {
+    float margin;                   // Bodies boxes margin
+    int root;                       // Root node (-1 if empty)
+
+    SpatialTreeNode *nodes;         // Tree nodes
+    BoundingBox *boxes;             // Bodies boxes (leaf nodes only), required for exact checks
+    int nodeCount;                  // Nodes slots in use (including free ones)
+    int nodeCapacity;               // Nodes slots allocated
+    int freeNode;                   // First free node (-1 if none)
+
+    int *stack;                     // Nodes stack for tree traversal
+    int stackCapacity;              // Nodes stack size, at least nodeCapacity
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static Shader skinningShader = { 0 };   // Default GPU skinning shader, loaded on first SetModelGpuSkinning()
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -167,6 +233,29 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void SkinMeshVertices(void *userData, int start, int end);   // Skin a range of mesh vertices (CPU skinning)
+static bool IsMeshGpuSkinned(Mesh mesh);                            // Check if mesh is skinned by vertex shader (GPU skinning)
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static void LoadShaderSkinningDefault(void);                        // Load default GPU skinning shader
+#endif
+static Matrix GetTransformMatrix(Transform transform);              // Get transform matrix (scale -> rotation -> translation)
+static Matrix *LoadBindPoseInverse(const Transform *bindPose, int boneCount); // Load bones inverse bind matrices
+static void UpdateModelBoneMatrices(Model model, const Transform *pose, int boneCount); // Update model meshes bones matrices for a pose
+static void SkinModelMeshes(Model model);                           // Skin model meshes vertex data with current bones matrices (CPU skinning)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms); // Build pose from parent joints
+static bool IsAnimationKeySpanValid(const float *values, int first, int last, bool rotation); // Check keys span interpolation error
+static void GetMeshTriangle(const Mesh *mesh, int triangle, Vector3 *p1, Vector3 *p2, Vector3 *p3); // Get mesh triangle vertices
+static float GetRayTriangleDistance(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3); // Get ray distance to triangle (-1.0f if no hit)
+static float GetRayNodeDistance(Vector3 position, Vector3 invDirection, const Vector3 *bounds, float maxDistance); // Get ray entry distance to BVH node bounds
+static RayCollision GetRayCollisionMeshBVH(Ray ray, const Mesh *mesh); // Get collision info between ray and mesh using mesh BVH (mesh space)
+static int AllocateSpatialTreeNode(SpatialTree *tree);               // Allocate spatial tree node
+static void InsertSpatialTreeLeaf(SpatialTree *tree, int leaf);      // Insert leaf node into spatial tree
+static void RemoveSpatialTreeLeaf(SpatialTree *tree, int leaf);      // Remove leaf node from spatial tree (node not freed)
+static int BalanceSpatialTreeNode(SpatialTree *tree, int index);     // Balance spatial tree node with a rotation, returns new subtree root
+static float GetAnimationClipFrame(AnimationClip clip, float time);  // Get animation clip frame (fractional) for a given time
+static void SampleAnimationTrack(const AnimationClip *clip, int track, float frame, float *value); // Sample animation clip track at frame
+
+extern void UnloadShaderSkinningDefault(void);                      // Unload default GPU skinning shader (if loaded)
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1209,6 +1298,7 @@ void UnloadModel(Model model)
     // Unload animation data
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
+    RL_FREE(model.bindPoseInverse);
 
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
@@ -1933,6 +2023,14 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
     RL_FREE(mesh.boneMatrices);
+
+    if (mesh.bvh != NULL)
+    {
+        RL_FREE(mesh.bvh->bounds);
+        RL_FREE(mesh.bvh->nodes);
+        RL_FREE(mesh.bvh->triangles);
+        RL_FREE(mesh.bvh);
+    }
 }
 
 // Export mesh data to file
@@ -2264,111 +2362,89 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
 // Update model animated bones transform matrices for a given frame
 // NOTE: Updated data is not uploaded to GPU but kept at model.meshes[i].boneMatrices[boneId],
 // to be uploaded to shader at drawing, in case GPU skinning is enabled
+// NOTE: Bones matrices are computed once per skeleton and copied to all meshes sharing it
 void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int i = 0; i < model.meshCount; i++)
-        {
-            if (model.meshes[i].boneMatrices)
-            {
-                assert(model.meshes[i].boneCount == anim.boneCount);
-
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    Vector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    Vector3 inScale = model.bindPose[boneId].scale;
-
-                    Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    Vector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
-                    Quaternion invRotation = QuaternionInvert(inRotation);
-                    Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    Vector3 boneTranslation = Vector3Add(
-                        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-                    Vector3 boneScale = Vector3Multiply(outScale, invScale);
-
-                    Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                        QuaternionToMatrix(boneRotation),
-                        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
-            }
-        }
+        UpdateModelBoneMatrices(model, anim.framePoses[frame], anim.boneCount);
     }
 }
 
-// at least 2x speed up vs the old method
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Bones matrices are blended once per vertex (SIMD if available), vertex ranges
+// of big meshes are split over worker threads, updated data is uploaded to GPU
+// NOTE: Meshes on GPU skinning mode [SetModelGpuSkinning()] only get bone matrices updated
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    UpdateModelAnimationBones(model,anim,frame);
-    for (int m = 0; m < model.meshCount; m++)
+    UpdateModelAnimationBones(model, anim, frame);
+    SkinModelMeshes(model);
+}
+
+// Set model skinning mode: GPU skinning (vertex shader) or CPU skinning (UpdateModelAnimation())
+// NOTE: On GPU skinning, base vertex data and bone ids/weights are kept static in VRAM,
+// only bone matrices are uploaded per draw and animVertices/animNormals are released
+void SetModelGpuSkinning(Model *model, bool enabled)
+{
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (enabled && (skinningShader.id == 0)) LoadShaderSkinningDefault();
+
+    if (enabled && (skinningShader.id == 0))
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        TRACELOG(LOG_WARNING, "MODEL: GPU skinning shader not available, using CPU skinning");
+        return;
+    }
+
+    for (int i = 0; i < model->meshCount; i++)
+    {
+        Mesh *mesh = &model->meshes[i];
+
+        if ((mesh->boneMatrices == NULL) || (mesh->boneIds == NULL) || (mesh->boneWeights == NULL) || (mesh->vboId == NULL)) continue;
+
+        if (enabled && (mesh->animVertices != NULL))
         {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
+            if ((mesh->boneCount > MAX_GPU_SKINNING_BONES) ||
+                (mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS] == 0) ||
+                (mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS] == 0))
             {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y*boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z*boneWeight;
-                updated = true;
-
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
+                TRACELOG(LOG_WARNING, "MESH: [ID %i] GPU skinning not supported (%i bones), using CPU skinning", mesh->vaoId, mesh->boneCount);
+                continue;
             }
-        }
 
-        if (updated)
+            // Restore bind pose vertex data, vertex shader applies bone matrices on drawing
+            rlUpdateVertexBuffer(mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION], mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+            if ((mesh->normals != NULL) && (mesh->animNormals != NULL)) rlUpdateVertexBuffer(mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL], mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
+
+            RL_FREE(mesh->animVertices);
+            RL_FREE(mesh->animNormals);
+            mesh->animVertices = NULL;
+            mesh->animNormals = NULL;
+        }
+        else if (!enabled && (mesh->animVertices == NULL))
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+            // Restore CPU skinning buffers, initialized with bind pose
+            mesh->animVertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            memcpy(mesh->animVertices, mesh->vertices, mesh->vertexCount*3*sizeof(float));
+
+            if (mesh->normals != NULL)
+            {
+                mesh->animNormals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+                memcpy(mesh->animNormals, mesh->normals, mesh->vertexCount*3*sizeof(float));
+            }
         }
     }
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "MODEL: GPU skinning not supported by current graphics API, using CPU skinning");
+#endif
+}
+
+// Unload default GPU skinning shader (if loaded)
+extern void UnloadShaderSkinningDefault(void)
+{
+    if (skinningShader.id > 0) UnloadShader(skinningShader);
+    skinningShader = (Shader){ 0 };
 }
 
 // Unload animation array data
@@ -2405,6 +2481,238 @@ bool IsModelAnimationValid(Model model, ModelAnimation anim)
     return result;
 }
 
+// Load animation clip from model animation: keys stored in bones local space,
+// redundant keys removed and key values quantized to 16 bit
+// NOTE: Clip does not reference animation data, animation can be unloaded after loading clip
+AnimationClip LoadAnimationClip(ModelAnimation anim, float frameRate)
+{
+    AnimationClip clip = { 0 };
+
+    if ((anim.frameCount <= 0) || (anim.frameCount > 65535) || (anim.boneCount <= 0) ||
+        (anim.bones == NULL) || (anim.framePoses == NULL) || (frameRate <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "ANIMATION: [%s] Failed to load animation clip, invalid animation data", anim.name);
+        return clip;
+    }
+
+    int frameCount = anim.frameCount;
+    int trackCount = anim.boneCount*3;      // Tracks per bone: translation, rotation, scale
+
+    // Bones local transforms, by track and frame, 4 components per value
+    float *values = (float *)RL_MALLOC(trackCount*frameCount*4*sizeof(float));
+
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        const Transform *pose = anim.framePoses[frame];
+
+        for (int bone = 0; bone < anim.boneCount; bone++)
+        {
+            Transform local = pose[bone];
+            int parent = anim.bones[bone].parent;
+
+            // Animation poses are defined in model space, converted to parent bone space
+            if ((parent >= 0) && (parent < anim.boneCount))
+            {
+                Quaternion invRotation = QuaternionInvert(pose[parent].rotation);
+
+                local.translation = Vector3RotateByQuaternion(Vector3Subtract(pose[bone].translation, pose[parent].translation), invRotation);
+                local.rotation = QuaternionMultiply(invRotation, pose[bone].rotation);
+                local.scale = Vector3Divide(pose[bone].scale, pose[parent].scale);
+            }
+
+            local.rotation = QuaternionNormalize(local.rotation);
+
+            float *translation = values + ((bone*3)*frameCount + frame)*4;
+            float *rotation = values + ((bone*3 + 1)*frameCount + frame)*4;
+            float *scale = values + ((bone*3 + 2)*frameCount + frame)*4;
+
+            translation[0] = local.translation.x; translation[1] = local.translation.y; translation[2] = local.translation.z; translation[3] = 0.0f;
+            rotation[0] = local.rotation.x; rotation[1] = local.rotation.y; rotation[2] = local.rotation.z; rotation[3] = local.rotation.w;
+            scale[0] = local.scale.x; scale[1] = local.scale.y; scale[2] = local.scale.z; scale[3] = 0.0f;
+
+            // Keep rotations on the same hemisphere than previous frame, required for keys interpolation
+            if ((frame > 0) && ((rotation[0]*rotation[-4] + rotation[1]*rotation[-3] + rotation[2]*rotation[-2] + rotation[3]*rotation[-1]) < 0.0f))
+            {
+                for (int c = 0; c < 4; c++) rotation[c] = -rotation[c];
+            }
+        }
+    }
+
+    // Remove keys that can be reproduced by linear interpolation of their neighbour keys
+    unsigned short *keyFrames = (unsigned short *)RL_MALLOC(trackCount*frameCount*sizeof(unsigned short));
+    int keyCount = 0;
+
+    clip.trackKeys = (int *)RL_MALLOC((trackCount + 1)*sizeof(int));
+
+    for (int track = 0; track < trackCount; track++)
+    {
+        const float *trackValues = values + track*frameCount*4;
+        bool rotation = ((track%3) == 1);
+        bool constant = true;
+
+        for (int i = 1; (i < frameCount) && constant; i++)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                if (fabsf(trackValues[i*4 + c] - trackValues[c]) > ANIMATION_KEY_TOLERANCE) { constant = false; break; }
+            }
+        }
+
+        clip.trackKeys[track] = keyCount;
+        keyFrames[keyCount++] = 0;
+
+        // NOTE: Constant tracks keep only first key
+        for (int key = 0; !constant && (key < (frameCount - 1));)
+        {
+            int next = key + 1;
+            while ((next < (frameCount - 1)) && IsAnimationKeySpanValid(trackValues, key, next + 1, rotation)) next++;
+
+            keyFrames[keyCount++] = (unsigned short)next;
+            key = next;
+        }
+    }
+
+    clip.trackKeys[trackCount] = keyCount;
+
+    // Quantize keys values to 16 bit, per track component range
+    clip.trackRanges = (float *)RL_MALLOC(trackCount*8*sizeof(float));
+    clip.keyFrames = (unsigned short *)RL_MALLOC(keyCount*sizeof(unsigned short));
+    clip.keyValues = (unsigned short *)RL_MALLOC(keyCount*4*sizeof(unsigned short));
+    memcpy(clip.keyFrames, keyFrames, keyCount*sizeof(unsigned short));
+
+    for (int track = 0; track < trackCount; track++)
+    {
+        const float *trackValues = values + track*frameCount*4;
+        float *range = clip.trackRanges + track*8;     // Min value and quantization step per component
+
+        for (int c = 0; c < 4; c++)
+        {
+            float min = trackValues[clip.keyFrames[clip.trackKeys[track]]*4 + c];
+            float max = min;
+
+            for (int k = clip.trackKeys[track]; k < clip.trackKeys[track + 1]; k++)
+            {
+                float value = trackValues[clip.keyFrames[k]*4 + c];
+                if (value < min) min = value;
+                if (value > max) max = value;
+            }
+
+            range[c] = min;
+            range[4 + c] = (max - min)/65535.0f;
+
+            for (int k = clip.trackKeys[track]; k < clip.trackKeys[track + 1]; k++)
+            {
+                float value = trackValues[clip.keyFrames[k]*4 + c];
+                clip.keyValues[k*4 + c] = (range[4 + c] > 0.0f)? (unsigned short)((value - min)/range[4 + c] + 0.5f) : 0;
+            }
+        }
+    }
+
+    RL_FREE(keyFrames);
+    RL_FREE(values);
+
+    clip.boneCount = anim.boneCount;
+    clip.frameCount = frameCount;
+    clip.frameRate = frameRate;
+    clip.keyCount = keyCount;
+    clip.bones = (BoneInfo *)RL_MALLOC(anim.boneCount*sizeof(BoneInfo));
+    memcpy(clip.bones, anim.bones, anim.boneCount*sizeof(BoneInfo));
+    memcpy(clip.name, anim.name, sizeof(clip.name));
+
+    TRACELOG(LOG_INFO, "ANIMATION: [%s] Animation clip loaded successfully (%i keys of %i frames)", clip.name, keyCount, trackCount*frameCount);
+
+    return clip;
+}
+
+// Unload animation clip data
+void UnloadAnimationClip(AnimationClip clip)
+{
+    RL_FREE(clip.trackKeys);
+    RL_FREE(clip.trackRanges);
+    RL_FREE(clip.keyFrames);
+    RL_FREE(clip.keyValues);
+    RL_FREE(clip.bones);
+}
+
+// Sample animation clip bones pose at a given time (in seconds, clip is looped)
+// NOTE: Pose is returned in model space, same as ModelAnimation.framePoses[frame]
+void SampleAnimationClip(AnimationClip clip, float time, Transform *pose)
+{
+    if ((clip.boneCount <= 0) || (clip.keyValues == NULL) || (pose == NULL)) return;
+
+    float frame = GetAnimationClipFrame(clip, time);
+
+    for (int bone = 0; bone < clip.boneCount; bone++)
+    {
+        float translation[4] = { 0 };
+        float rotation[4] = { 0 };
+        float scale[4] = { 0 };
+
+        SampleAnimationTrack(&clip, bone*3, frame, translation);
+        SampleAnimationTrack(&clip, bone*3 + 1, frame, rotation);
+        SampleAnimationTrack(&clip, bone*3 + 2, frame, scale);
+
+        pose[bone].translation = (Vector3){ translation[0], translation[1], translation[2] };
+        pose[bone].rotation = QuaternionNormalize((Quaternion){ rotation[0], rotation[1], rotation[2], rotation[3] });
+        pose[bone].scale = (Vector3){ scale[0], scale[1], scale[2] };
+    }
+
+    BuildPoseFromParentJoints(clip.bones, clip.boneCount, pose);
+}
+
+// Update model animation pose blending several animation clips, sampled at given times with given weights
+// NOTE: Clips are blended per bone in bones local space, no intermediate pose is generated per clip,
+// bones matrices are updated and meshes not on GPU skinning mode are skinned on CPU
+void UpdateModelAnimationClips(Model model, const AnimationClip *clips, const float *times, const float *weights, int clipCount)
+{
+    // Bones local pose, blended from clips
+    // NOTE: Max 256 bones supported, boneIds are stored as unsigned char
+    Transform pose[256] = { 0 };
+
+    if ((model.boneCount <= 0) || (model.boneCount > 256) || (model.bones == NULL)) return;
+
+    float totalWeight = 0.0f;
+    for (int i = 0; i < clipCount; i++) if ((clips[i].boneCount == model.boneCount) && (weights[i] > 0.0f)) totalWeight += weights[i];
+
+    if (totalWeight <= 0.0f) return;
+
+    for (int bone = 0; bone < model.boneCount; bone++)
+    {
+        float translation[4] = { 0 };
+        float rotation[4] = { 0 };
+        float scale[4] = { 0 };
+
+        for (int i = 0; i < clipCount; i++)
+        {
+            if ((clips[i].boneCount != model.boneCount) || (weights[i] <= 0.0f)) continue;
+
+            float frame = GetAnimationClipFrame(clips[i], times[i]);
+            float weight = weights[i]/totalWeight;
+            float value[4] = { 0 };
+
+            SampleAnimationTrack(&clips[i], bone*3, frame, value);
+            for (int c = 0; c < 3; c++) translation[c] += value[c]*weight;
+
+            SampleAnimationTrack(&clips[i], bone*3 + 2, frame, value);
+            for (int c = 0; c < 3; c++) scale[c] += value[c]*weight;
+
+            // Rotations are accumulated on the same hemisphere and normalized after blending
+            SampleAnimationTrack(&clips[i], bone*3 + 1, frame, value);
+            if ((rotation[0]*value[0] + rotation[1]*value[1] + rotation[2]*value[2] + rotation[3]*value[3]) < 0.0f) weight = -weight;
+            for (int c = 0; c < 4; c++) rotation[c] += value[c]*weight;
+        }
+
+        pose[bone].translation = (Vector3){ translation[0], translation[1], translation[2] };
+        pose[bone].rotation = QuaternionNormalize((Quaternion){ rotation[0], rotation[1], rotation[2], rotation[3] });
+        pose[bone].scale = (Vector3){ scale[0], scale[1], scale[2] };
+    }
+
+    BuildPoseFromParentJoints(model.bones, model.boneCount, pose);
+
+    UpdateModelBoneMatrices(model, pose, model.boneCount);
+    SkinModelMeshes(model);
+}
+
 #if defined(SUPPORT_MESH_GENERATION)
 // Generate polygonal mesh
 Mesh GenMeshPoly(int sides, float radius)
@@ -3691,6 +3999,141 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Compute mesh triangles BVH (bounding volume hierarchy), used by ray collision functions
+// NOTE: Nodes are split at centroids bounds middle of largest axis, BVH must be
+// computed again if mesh vertex data is modified
+void GenMeshBVH(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Vertex data not available, BVH not computed");
+        return;
+    }
+
+    if (mesh->bvh != NULL)
+    {
+        RL_FREE(mesh->bvh->bounds);
+        RL_FREE(mesh->bvh->nodes);
+        RL_FREE(mesh->bvh->triangles);
+        RL_FREE(mesh->bvh);
+    }
+
+    int triangleCount = mesh->triangleCount;
+    int maxNodes = 2*triangleCount - 1;
+
+    MeshBVH *bvh = (MeshBVH *)RL_CALLOC(1, sizeof(MeshBVH));
+    bvh->bounds = (Vector3 *)RL_MALLOC(maxNodes*2*sizeof(Vector3));
+    bvh->nodes = (int *)RL_MALLOC(maxNodes*2*sizeof(int));
+    bvh->triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+
+    // Triangles bounds and centroids, required for nodes splitting
+    Vector3 *triangleBounds = (Vector3 *)RL_MALLOC(triangleCount*2*sizeof(Vector3));
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, i, &a, &b, &c);
+
+        triangleBounds[i*2] = Vector3Min(Vector3Min(a, b), c);
+        triangleBounds[i*2 + 1] = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(Vector3Add(a, b), c), 1.0f/3.0f);
+        bvh->triangles[i] = i;
+    }
+
+    // Nodes pending to be processed, with their depth
+    int *stack = (int *)RL_MALLOC(maxNodes*2*sizeof(int));
+    int stackCount = 0;
+
+    bvh->nodes[0] = 0;
+    bvh->nodes[1] = triangleCount;
+    bvh->nodeCount = 1;
+
+    stack[stackCount++] = 0;
+    stack[stackCount++] = 0;
+
+    while (stackCount > 0)
+    {
+        int depth = stack[--stackCount];
+        int node = stack[--stackCount];
+        int first = bvh->nodes[node*2];
+        int count = bvh->nodes[node*2 + 1];
+
+        // Get node bounds and triangles centroids bounds
+        Vector3 min = triangleBounds[bvh->triangles[first]*2];
+        Vector3 max = triangleBounds[bvh->triangles[first]*2 + 1];
+        Vector3 centroidMin = centroids[bvh->triangles[first]];
+        Vector3 centroidMax = centroidMin;
+
+        for (int i = first + 1; i < (first + count); i++)
+        {
+            int triangle = bvh->triangles[i];
+
+            min = Vector3Min(min, triangleBounds[triangle*2]);
+            max = Vector3Max(max, triangleBounds[triangle*2 + 1]);
+            centroidMin = Vector3Min(centroidMin, centroids[triangle]);
+            centroidMax = Vector3Max(centroidMax, centroids[triangle]);
+        }
+
+        bvh->bounds[node*2] = min;
+        bvh->bounds[node*2 + 1] = max;
+
+        if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
+
+        // Split node at centroids bounds middle of largest axis
+        Vector3 extent = Vector3Subtract(centroidMax, centroidMin);
+        int axis = 0;
+        if (extent.y > extent.x) axis = 1;
+        if (extent.z > ((axis == 0)? extent.x : extent.y)) axis = 2;
+
+        float split = (axis == 0)? (centroidMin.x + centroidMax.x)*0.5f : (axis == 1)? (centroidMin.y + centroidMax.y)*0.5f : (centroidMin.z + centroidMax.z)*0.5f;
+
+        int leftCount = 0;
+        for (int i = first; i < (first + count); i++)
+        {
+            int triangle = bvh->triangles[i];
+            float centroid = (axis == 0)? centroids[triangle].x : (axis == 1)? centroids[triangle].y : centroids[triangle].z;
+
+            if (centroid < split)
+            {
+                bvh->triangles[i] = bvh->triangles[first + leftCount];
+                bvh->triangles[first + leftCount] = triangle;
+                leftCount++;
+            }
+        }
+
+        // NOTE: Triangles with same centroid can not be split spatially, they are split by half
+        if ((leftCount == 0) || (leftCount == count)) leftCount = count/2;
+
+        int left = bvh->nodeCount;
+        bvh->nodeCount += 2;
+
+        bvh->nodes[left*2] = first;
+        bvh->nodes[left*2 + 1] = leftCount;
+        bvh->nodes[(left + 1)*2] = first + leftCount;
+        bvh->nodes[(left + 1)*2 + 1] = count - leftCount;
+
+        bvh->nodes[node*2] = left;
+        bvh->nodes[node*2 + 1] = 0;
+
+        stack[stackCount++] = left;
+        stack[stackCount++] = depth + 1;
+        stack[stackCount++] = left + 1;
+        stack[stackCount++] = depth + 1;
+    }
+
+    RL_FREE(stack);
+    RL_FREE(centroids);
+    RL_FREE(triangleBounds);
+
+    bvh->bounds = (Vector3 *)RL_REALLOC(bvh->bounds, bvh->nodeCount*2*sizeof(Vector3));
+    bvh->nodes = (int *)RL_REALLOC(bvh->nodes, bvh->nodeCount*2*sizeof(int));
+
+    mesh->bvh = bvh;
+
+    TRACELOG(LOG_INFO, "MESH: BVH computed successfully (%i triangles, %i nodes)", triangleCount, bvh->nodeCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -3724,8 +4167,12 @@ void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rota
         colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
         colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
 
+        // GPU skinned meshes drawn with default shader use default skinning shader
+        Material material = model.materials[model.meshMaterial[i]];
+        if ((material.shader.id == rlGetShaderIdDefault()) && IsMeshGpuSkinned(model.meshes[i])) material.shader = skinningShader;
+
         model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
-        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
+        DrawMesh(model.meshes[i], material, model.transform);
         model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
     }
 }
@@ -4039,6 +4486,8 @@ RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and mesh
+// NOTE: Ray is transformed into mesh space instead of transforming mesh triangles,
+// mesh BVH is used if available [GenMeshBVH()], all triangles are tested otherwise
 RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
 {
     RayCollision collision = { 0 };
@@ -4046,39 +4495,70 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     // Check if mesh vertex data on CPU for testing
     if (mesh.vertices != NULL)
     {
-        int triangleCount = mesh.triangleCount;
-
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        // NOTE: Ray direction is not normalized in mesh space, so ray parameter is
+        // the same in both spaces and hit distance is returned in world space units
+        Matrix invTransform = MatrixInvert(transform);
+        Ray meshRay = { 0 };
+        meshRay.position = Vector3Transform(ray.position, invTransform);
+        meshRay.direction = Vector3Subtract(Vector3Transform(Vector3Add(ray.position, ray.direction), invTransform), meshRay.position);
+
+        if (mesh.bvh != NULL) collision = GetRayCollisionMeshBVH(meshRay, &mesh);
+        else
         {
-            Vector3 a, b, c;
-            Vector3 *vertdata = (Vector3 *)mesh.vertices;
+            // Test against all triangles in mesh
+            int hitTriangle = -1;
+            float hitDistance = FLT_MAX;
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
+            for (int i = 0; i < mesh.triangleCount; i++)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+                Vector3 a, b, c;
+                GetMeshTriangle(&mesh, i, &a, &b, &c);
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+                float distance = GetRayTriangleDistance(meshRay, a, b, c);
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+                // Save the closest hit triangle
+                if ((distance > 0.0f) && (distance < hitDistance)) { hitDistance = distance; hitTriangle = i; }
+            }
 
-            if (triHitInfo.hit)
+            if (hitTriangle >= 0)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                Vector3 a, b, c;
+                GetMeshTriangle(&mesh, hitTriangle, &a, &b, &c);
+
+                collision.hit = true;
+                collision.distance = hitDistance;
+                collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
             }
         }
+
+        if (collision.hit)
+        {
+            // Hit point and normal back to world space, normal transformed by inverse transpose matrix
+            Vector3 normal = collision.normal;
+
+            collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+            collision.normal.x = invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z;
+            collision.normal.y = invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z;
+            collision.normal.z = invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z;
+            collision.normal = Vector3Normalize(collision.normal);
+        }
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and model (closest hit of all meshes)
+// NOTE: Meshes BVH are used if available [GenMeshBVH()]
+RayCollision GetRayCollisionModel(Ray ray, Model model)
+{
+    RayCollision collision = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        RayCollision meshCollision = GetRayCollisionMesh(ray, model.meshes[i], model.transform);
+
+        // Save the closest hit mesh
+        if (meshCollision.hit && (!collision.hit || (meshCollision.distance < collision.distance))) collision = meshCollision;
     }
 
     return collision;
@@ -4157,62 +4637,1065 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
     return collision;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Load spatial tree (dynamic bounding boxes tree)
+// NOTE: Bodies boxes are enlarged by margin, moving bodies only reinserted when leaving enlarged box
+SpatialTree *LoadSpatialTree(float margin)
 {
-    for (int i = 0; i < boneCount; i++)
-    {
-        if (bones[i].parent >= 0)
-        {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
-        }
-    }
+    SpatialTree *tree = (SpatialTree *)RL_CALLOC(1, sizeof(SpatialTree));
+
+    tree->margin = (margin > 0.0f)? margin : 0.0f;
+    tree->root = -1;
+    tree->freeNode = -1;
+
+    return tree;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-//
-// Keep the following information in mind when reading this
-//  - A mesh is created for every material present in the obj file
-//  - the model.meshCount is therefore the materialCount returned from tinyobj
-//  - the mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
+// Unload spatial tree
+void UnloadSpatialTree(SpatialTree *tree)
 {
-    tinyobj_attrib_t objAttributes = { 0 };
-    tinyobj_shape_t *objShapes = NULL;
-    unsigned int objShapeCount = 0;
+    if (tree == NULL) return;
 
-    tinyobj_material_t *objMaterials = NULL;
-    unsigned int objMaterialCount = 0;
+    RL_FREE(tree->nodes);
+    RL_FREE(tree->boxes);
+    RL_FREE(tree->stack);
+    RL_FREE(tree);
+}
 
-    Model model = { 0 };
-    model.transform = MatrixIdentity();
+// Add body to spatial tree, returns body handle
+int AddSpatialTreeBody(SpatialTree *tree, BoundingBox box)
+{
+    int leaf = AllocateSpatialTreeNode(tree);
 
-    char *fileText = LoadFileText(fileName);
+    tree->boxes[leaf] = box;
+    tree->nodes[leaf].box.min = Vector3SubtractValue(box.min, tree->margin);
+    tree->nodes[leaf].box.max = Vector3AddValue(box.max, tree->margin);
 
-    if (fileText == NULL)
-    {
-        TRACELOG(LOG_ERROR, "MODEL: [%s] Unable to read obj file", fileName);
-        return model;
-    }
+    InsertSpatialTreeLeaf(tree, leaf);
 
-    char currentDir[1024] = { 0 };
-    strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
-    const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
+    return leaf;
+}
+
+// Update spatial tree body box
+void UpdateSpatialTreeBody(SpatialTree *tree, int handle, BoundingBox box)
+{
+    if ((handle < 0) || (handle >= tree->nodeCount) || (tree->nodes[handle].height != 0)) return;
+
+    tree->boxes[handle] = box;
+
+    // Body still contained in its enlarged box, tree not modified
+    BoundingBox fatBox = tree->nodes[handle].box;
+
+    if ((fatBox.min.x <= box.min.x) && (fatBox.min.y <= box.min.y) && (fatBox.min.z <= box.min.z) &&
+        (box.max.x <= fatBox.max.x) && (box.max.y <= fatBox.max.y) && (box.max.z <= fatBox.max.z)) return;
+
+    RemoveSpatialTreeLeaf(tree, handle);
+
+    tree->nodes[handle].box.min = Vector3SubtractValue(box.min, tree->margin);
+    tree->nodes[handle].box.max = Vector3AddValue(box.max, tree->margin);
+
+    InsertSpatialTreeLeaf(tree, handle);
+}
+
+// Remove body from spatial tree
+// NOTE: Body handle can be returned again by AddSpatialTreeBody()
+void RemoveSpatialTreeBody(SpatialTree *tree, int handle)
+{
+    if ((handle < 0) || (handle >= tree->nodeCount) || (tree->nodes[handle].height != 0)) return;
+
+    RemoveSpatialTreeLeaf(tree, handle);
+
+    tree->nodes[handle].height = -1;
+    tree->nodes[handle].parent = tree->freeNode;
+    tree->freeNode = handle;
+}
+
+// Get spatial tree overlapping bodies pairs, returns pairs count (up to maxPairs)
+// NOTE: Tree is traversed against itself, subtrees pairs are only descended if their
+// boxes overlap, bodies pairs are checked with CheckCollisionBoxes()
+int GetSpatialTreePairs(SpatialTree *tree, BodyPair *pairs, int maxPairs)
+{
+    #define BOX_AREA(b) (((b).max.x - (b).min.x)*((b).max.y - (b).min.y) + ((b).max.y - (b).min.y)*((b).max.z - (b).min.z) + ((b).max.z - (b).min.z)*((b).max.x - (b).min.x))
+
+    int pairCount = 0;
+
+    if (tree->root == -1) return pairCount;
+
+    // Nodes pairs stack, same node twice means node subtree against itself
+    int stackCount = 0;
+    tree->stack[stackCount++] = tree->root;
+    tree->stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int indexB = tree->stack[--stackCount];
+        int indexA = tree->stack[--stackCount];
+        const SpatialTreeNode *a = &tree->nodes[indexA];
+        const SpatialTreeNode *b = &tree->nodes[indexB];
+
+        // NOTE: Up to 3 nodes pairs pushed per iteration
+        if ((stackCount + 6) > tree->stackCapacity)
+        {
+            tree->stackCapacity *= 2;
+            tree->stack = (int *)RL_REALLOC(tree->stack, tree->stackCapacity*sizeof(int));
+        }
+
+        if (indexA == indexB)
+        {
+            if (a->height == 0) continue;
+
+            tree->stack[stackCount++] = a->child1;
+            tree->stack[stackCount++] = a->child1;
+            tree->stack[stackCount++] = a->child2;
+            tree->stack[stackCount++] = a->child2;
+            tree->stack[stackCount++] = a->child1;
+            tree->stack[stackCount++] = a->child2;
+        }
+        else if (CheckCollisionBoxes(a->box, b->box))
+        {
+            if ((a->height == 0) && (b->height == 0))
+            {
+                if (CheckCollisionBoxes(tree->boxes[indexA], tree->boxes[indexB]))
+                {
+                    if (pairCount == maxPairs) break;
+
+                    pairs[pairCount].a = (indexA < indexB)? indexA : indexB;
+                    pairs[pairCount].b = (indexA < indexB)? indexB : indexA;
+                    pairCount++;
+                }
+            }
+            else if ((b->height == 0) || ((a->height > 0) && (BOX_AREA(a->box) >= BOX_AREA(b->box))))
+            {
+                // Descend larger node
+                tree->stack[stackCount++] = a->child1;
+                tree->stack[stackCount++] = indexB;
+                tree->stack[stackCount++] = a->child2;
+                tree->stack[stackCount++] = indexB;
+            }
+            else
+            {
+                tree->stack[stackCount++] = indexA;
+                tree->stack[stackCount++] = b->child1;
+                tree->stack[stackCount++] = indexA;
+                tree->stack[stackCount++] = b->child2;
+            }
+        }
+    }
+
+    #undef BOX_AREA
+
+    return pairCount;
+}
+
+// Get spatial tree bodies overlapping box, returns bodies count (up to maxHandles)
+int GetSpatialTreeBodiesBox(SpatialTree *tree, BoundingBox box, int *handles, int maxHandles)
+{
+    int count = 0;
+
+    if (tree->root == -1) return count;
+
+    int stackCount = 0;
+    tree->stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = tree->stack[--stackCount];
+        const SpatialTreeNode *node = &tree->nodes[index];
+
+        if (!CheckCollisionBoxes(node->box, box)) continue;
+
+        if (node->height == 0)
+        {
+            if (CheckCollisionBoxes(tree->boxes[index], box))
+            {
+                if (count == maxHandles) return count;
+                handles[count++] = index;
+            }
+        }
+        else
+        {
+            tree->stack[stackCount++] = node->child1;
+            tree->stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get spatial tree bodies hit by ray, up to distance, returns bodies count (up to maxHandles)
+// NOTE: Bodies are not sorted by distance
+int GetSpatialTreeBodiesRay(SpatialTree *tree, Ray ray, float distance, int *handles, int maxHandles)
+{
+    int count = 0;
+
+    if ((tree->root == -1) || (distance <= 0.0f)) return count;
+
+    ray.direction = Vector3Normalize(ray.direction);
+    Vector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+
+    int stackCount = 0;
+    tree->stack[stackCount++] = tree->root;
+
+    while (stackCount > 0)
+    {
+        int index = tree->stack[--stackCount];
+        const SpatialTreeNode *node = &tree->nodes[index];
+
+        if (GetRayNodeDistance(ray.position, invDirection, &node->box.min, distance) < 0.0f) continue;
+
+        if (node->height == 0)
+        {
+            if (GetRayNodeDistance(ray.position, invDirection, &tree->boxes[index].min, distance) >= 0.0f)
+            {
+                if (count == maxHandles) return count;
+                handles[count++] = index;
+            }
+        }
+        else
+        {
+            tree->stack[stackCount++] = node->child1;
+            tree->stack[stackCount++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Skin a range of mesh vertices, the (up to) 4 bones matrices are blended by weight
+// and the resulting matrix is applied to vertex position and normal (no translation)
+static void SkinMeshVertices(void *userData, int start, int end)
+{
+    const SkinningJob *job = (const SkinningJob *)userData;
+
+    for (int v = start; v < end; v++)
+    {
+        const unsigned char *ids = job->boneIds + v*4;
+        const float *weights = job->boneWeights + v*4;
+        const float *vertex = job->vertices + v*3;
+        float *animVertex = job->animVertices + v*3;
+
+#if defined(SKINNING_SIMD_SSE)
+    #if defined(__FMA__)
+        #define MM_MADD(a, b, c) _mm_fmadd_ps(a, b, c)
+    #else
+        #define MM_MADD(a, b, c) _mm_add_ps(_mm_mul_ps(a, b), c)
+    #endif
+        __m128 col0 = _mm_setzero_ps();
+        __m128 col1 = _mm_setzero_ps();
+        __m128 col2 = _mm_setzero_ps();
+        __m128 col3 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;   // Early skip when no transformation will be applied
+
+            const float *mat = job->palette + ids[j]*16;
+            __m128 weight = _mm_set1_ps(weights[j]);
+            col0 = MM_MADD(_mm_loadu_ps(mat), weight, col0);
+            col1 = MM_MADD(_mm_loadu_ps(mat + 4), weight, col1);
+            col2 = MM_MADD(_mm_loadu_ps(mat + 8), weight, col2);
+            col3 = MM_MADD(_mm_loadu_ps(mat + 12), weight, col3);
+        }
+
+        __m128 result = MM_MADD(col0, _mm_set1_ps(vertex[0]), col3);
+        result = MM_MADD(col1, _mm_set1_ps(vertex[1]), result);
+        result = MM_MADD(col2, _mm_set1_ps(vertex[2]), result);
+        _mm_storel_pi((__m64 *)animVertex, result);
+        _mm_store_ss(animVertex + 2, _mm_movehl_ps(result, result));
+
+        if (job->animNormals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            result = _mm_mul_ps(col0, _mm_set1_ps(normal[0]));
+            result = MM_MADD(col1, _mm_set1_ps(normal[1]), result);
+            result = MM_MADD(col2, _mm_set1_ps(normal[2]), result);
+            _mm_storel_pi((__m64 *)animNormal, result);
+            _mm_store_ss(animNormal + 2, _mm_movehl_ps(result, result));
+        }
+    #undef MM_MADD
+#elif defined(SKINNING_SIMD_NEON)
+        float32x4_t col0 = vdupq_n_f32(0.0f);
+        float32x4_t col1 = vdupq_n_f32(0.0f);
+        float32x4_t col2 = vdupq_n_f32(0.0f);
+        float32x4_t col3 = vdupq_n_f32(0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;   // Early skip when no transformation will be applied
+
+            const float *mat = job->palette + ids[j]*16;
+            col0 = vmlaq_n_f32(col0, vld1q_f32(mat), weights[j]);
+            col1 = vmlaq_n_f32(col1, vld1q_f32(mat + 4), weights[j]);
+            col2 = vmlaq_n_f32(col2, vld1q_f32(mat + 8), weights[j]);
+            col3 = vmlaq_n_f32(col3, vld1q_f32(mat + 12), weights[j]);
+        }
+
+        float32x4_t result = vmlaq_n_f32(col3, col0, vertex[0]);
+        result = vmlaq_n_f32(result, col1, vertex[1]);
+        result = vmlaq_n_f32(result, col2, vertex[2]);
+        vst1_f32(animVertex, vget_low_f32(result));
+        vst1q_lane_f32(animVertex + 2, result, 2);
+
+        if (job->animNormals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            result = vmulq_n_f32(col0, normal[0]);
+            result = vmlaq_n_f32(result, col1, normal[1]);
+            result = vmlaq_n_f32(result, col2, normal[2]);
+            vst1_f32(animNormal, vget_low_f32(result));
+            vst1q_lane_f32(animNormal + 2, result, 2);
+        }
+#else
+        float mat[12] = { 0 };      // Blended matrix, 3 first rows of the 4 columns
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;   // Early skip when no transformation will be applied
+
+            const float *bone = job->palette + ids[j]*16;
+            for (int k = 0; k < 4; k++)
+            {
+                mat[k*3 + 0] += bone[k*4 + 0]*weights[j];
+                mat[k*3 + 1] += bone[k*4 + 1]*weights[j];
+                mat[k*3 + 2] += bone[k*4 + 2]*weights[j];
+            }
+        }
+
+        animVertex[0] = mat[0]*vertex[0] + mat[3]*vertex[1] + mat[6]*vertex[2] + mat[9];
+        animVertex[1] = mat[1]*vertex[0] + mat[4]*vertex[1] + mat[7]*vertex[2] + mat[10];
+        animVertex[2] = mat[2]*vertex[0] + mat[5]*vertex[1] + mat[8]*vertex[2] + mat[11];
+
+        if (job->animNormals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            animNormal[0] = mat[0]*normal[0] + mat[3]*normal[1] + mat[6]*normal[2];
+            animNormal[1] = mat[1]*normal[0] + mat[4]*normal[1] + mat[7]*normal[2];
+            animNormal[2] = mat[2]*normal[0] + mat[5]*normal[1] + mat[8]*normal[2];
+        }
+#endif
+    }
+}
+
+// Check if mesh is skinned by vertex shader (GPU skinning)
+// NOTE: GPU skinned meshes keep bone matrices and bone ids/weights in VRAM but no animVertices
+static bool IsMeshGpuSkinned(Mesh mesh)
+{
+    bool result = false;
+
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    result = (skinningShader.id > 0) && (mesh.boneMatrices != NULL) && (mesh.animVertices == NULL) &&
+             (mesh.vboId != NULL) && (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS] > 0);
+#endif
+
+    return result;
+}
+
+// Update model meshes bones matrices for a pose (bones transforms in model space)
+// NOTE: Bones matrices are computed once for first skinned mesh and copied to all meshes sharing skeleton
+static void UpdateModelBoneMatrices(Model model, const Transform *pose, int boneCount)
+{
+    Matrix *palette = NULL;     // Bones matrices of first skinned mesh, shared by all meshes
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices == NULL) continue;
+
+        assert(model.meshes[i].boneCount == boneCount);
+
+        if (palette == NULL)
+        {
+            palette = model.meshes[i].boneMatrices;
+
+            for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
+            {
+                // NOTE: Inverse bind matrices are precomputed on model loading, just in case
+                // they are not available (i.e. user generated model), they are computed here
+                Matrix bindPoseInverse = (model.bindPoseInverse != NULL)? model.bindPoseInverse[boneId] :
+                    MatrixInvert(GetTransformMatrix(model.bindPose[boneId]));
+
+                palette[boneId] = MatrixMultiply(bindPoseInverse, GetTransformMatrix(pose[boneId]));
+            }
+        }
+        else if (model.meshes[i].boneMatrices != palette) memcpy(model.meshes[i].boneMatrices, palette, model.meshes[i].boneCount*sizeof(Matrix));
+    }
+}
+
+// Skin model meshes vertex data (positions and normals) with current bones matrices (CPU skinning)
+// NOTE: Meshes on GPU skinning mode (no animVertices) are skipped
+static void SkinModelMeshes(Model model)
+{
+    // Bones matrices palette, stored as columns to be blended with SIMD instructions
+    // NOTE: Max 256 bones supported, boneIds are stored as unsigned char
+    float palette[256*16] = { 0 };
+    int paletteBoneCount = 0;       // Bones filled in palette, meshes share the same skeleton
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+
+        if ((mesh.boneMatrices == NULL) || (mesh.animVertices == NULL) ||
+            (mesh.boneIds == NULL) || (mesh.boneWeights == NULL)) continue;
+
+        int boneCount = (mesh.boneCount < 256)? mesh.boneCount : 256;
+
+        for (int boneId = paletteBoneCount; boneId < boneCount; boneId++)
+        {
+            Matrix mat = mesh.boneMatrices[boneId];
+            float *col = palette + boneId*16;
+
+            col[0] = mat.m0; col[1] = mat.m1; col[2] = mat.m2; col[3] = 0.0f;
+            col[4] = mat.m4; col[5] = mat.m5; col[6] = mat.m6; col[7] = 0.0f;
+            col[8] = mat.m8; col[9] = mat.m9; col[10] = mat.m10; col[11] = 0.0f;
+            col[12] = mat.m12; col[13] = mat.m13; col[14] = mat.m14; col[15] = 0.0f;
+        }
+
+        if (boneCount > paletteBoneCount) paletteBoneCount = boneCount;
+
+        SkinningJob job = { 0 };
+        job.palette = palette;
+        job.vertices = mesh.vertices;
+        job.normals = (mesh.animNormals != NULL)? mesh.normals : NULL;
+        job.boneIds = mesh.boneIds;
+        job.boneWeights = mesh.boneWeights;
+        job.animVertices = mesh.animVertices;
+        job.animNormals = (mesh.normals != NULL)? mesh.animNormals : NULL;
+
+        RunWorkerJobs(SkinMeshVertices, &job, mesh.vertexCount, SKINNING_VERTEX_RANGE);
+
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+        if (job.animNormals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0); // Update vertex normals
+    }
+}
+
+// Get mesh triangle vertices (indexed or not)
+static void GetMeshTriangle(const Mesh *mesh, int triangle, Vector3 *p1, Vector3 *p2, Vector3 *p3)
+{
+    const Vector3 *vertices = (const Vector3 *)mesh->vertices;
+
+    if (mesh->indices != NULL)
+    {
+        *p1 = vertices[mesh->indices[triangle*3]];
+        *p2 = vertices[mesh->indices[triangle*3 + 1]];
+        *p3 = vertices[mesh->indices[triangle*3 + 2]];
+    }
+    else
+    {
+        *p1 = vertices[triangle*3];
+        *p2 = vertices[triangle*3 + 1];
+        *p3 = vertices[triangle*3 + 2];
+    }
+}
+
+// Get ray distance to triangle, -1.0f if no hit
+// NOTE: Same test as GetRayCollisionTriangle(), hit point and normal not computed
+static float GetRayTriangleDistance(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    Vector3 edge1 = Vector3Subtract(p2, p1);
+    Vector3 edge2 = Vector3Subtract(p3, p1);
+    Vector3 p = Vector3CrossProduct(ray.direction, edge2);
+    float det = Vector3DotProduct(edge1, p);
+
+    if ((det > -EPSILON) && (det < EPSILON)) return -1.0f;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = Vector3Subtract(ray.position, p1);
+    float u = Vector3DotProduct(tv, p)*invDet;
+
+    if ((u < 0.0f) || (u > 1.0f)) return -1.0f;
+
+    Vector3 q = Vector3CrossProduct(tv, edge1);
+    float v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return -1.0f;
+
+    float t = Vector3DotProduct(edge2, q)*invDet;
+
+    return (t > EPSILON)? t : -1.0f;
+}
+
+// Get ray entry distance to BVH node bounds, -1.0f if no hit (or hit further than maxDistance)
+static float GetRayNodeDistance(Vector3 position, Vector3 invDirection, const Vector3 *bounds, float maxDistance)
+{
+    float tx1 = (bounds[0].x - position.x)*invDirection.x;
+    float tx2 = (bounds[1].x - position.x)*invDirection.x;
+    float tmin = fminf(tx1, tx2);
+    float tmax = fmaxf(tx1, tx2);
+
+    float ty1 = (bounds[0].y - position.y)*invDirection.y;
+    float ty2 = (bounds[1].y - position.y)*invDirection.y;
+    tmin = fmaxf(tmin, fminf(ty1, ty2));
+    tmax = fminf(tmax, fmaxf(ty1, ty2));
+
+    float tz1 = (bounds[0].z - position.z)*invDirection.z;
+    float tz2 = (bounds[1].z - position.z)*invDirection.z;
+    tmin = fmaxf(tmin, fminf(tz1, tz2));
+    tmax = fminf(tmax, fmaxf(tz1, tz2));
+
+    if ((tmax < 0.0f) || (tmin > tmax) || (tmin > maxDistance)) return -1.0f;
+
+    return (tmin > 0.0f)? tmin : 0.0f;
+}
+
+// Get collision info between ray and mesh using mesh BVH
+// NOTE: Ray is expected in mesh space, closest child nodes are visited first
+static RayCollision GetRayCollisionMeshBVH(Ray ray, const Mesh *mesh)
+{
+    RayCollision collision = { 0 };
+    const MeshBVH *bvh = mesh->bvh;
+
+    Vector3 invDirection = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+    int hitTriangle = -1;
+    float hitDistance = FLT_MAX;
+
+    // NOTE: Nodes stack size is enough for MESH_BVH_MAX_DEPTH, one sibling node pending per level
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackCount = 0;
+
+    if (GetRayNodeDistance(ray.position, invDirection, bvh->bounds, hitDistance) >= 0.0f) stack[stackCount++] = 0;
+
+    while (stackCount > 0)
+    {
+        int node = stack[--stackCount];
+
+        if (bvh->nodes[node*2 + 1] > 0)
+        {
+            // Leaf node, test its triangles
+            int first = bvh->nodes[node*2];
+            int count = bvh->nodes[node*2 + 1];
+
+            for (int i = first; i < (first + count); i++)
+            {
+                Vector3 a, b, c;
+                GetMeshTriangle(mesh, bvh->triangles[i], &a, &b, &c);
+
+                float distance = GetRayTriangleDistance(ray, a, b, c);
+
+                if ((distance > 0.0f) && (distance < hitDistance)) { hitDistance = distance; hitTriangle = bvh->triangles[i]; }
+            }
+        }
+        else
+        {
+            // Inner node, push hit children, closest one last to be visited first
+            int left = bvh->nodes[node*2];
+            float leftDistance = GetRayNodeDistance(ray.position, invDirection, &bvh->bounds[left*2], hitDistance);
+            float rightDistance = GetRayNodeDistance(ray.position, invDirection, &bvh->bounds[(left + 1)*2], hitDistance);
+
+            if ((leftDistance >= 0.0f) && (rightDistance >= 0.0f))
+            {
+                if (leftDistance < rightDistance) { stack[stackCount++] = left + 1; stack[stackCount++] = left; }
+                else { stack[stackCount++] = left; stack[stackCount++] = left + 1; }
+            }
+            else if (leftDistance >= 0.0f) stack[stackCount++] = left;
+            else if (rightDistance >= 0.0f) stack[stackCount++] = left + 1;
+        }
+    }
+
+    if (hitTriangle >= 0)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(mesh, hitTriangle, &a, &b, &c);
+
+        collision.hit = true;
+        collision.distance = hitDistance;
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, hitDistance));
+        collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+    }
+
+    return collision;
+}
+
+// Allocate spatial tree node
+// NOTE: Nodes array growth can move nodes, node pointers must not be kept
+static int AllocateSpatialTreeNode(SpatialTree *tree)
+{
+    int index = tree->freeNode;
+
+    if (index != -1) tree->freeNode = tree->nodes[index].parent;
+    else
+    {
+        if (tree->nodeCount == tree->nodeCapacity)
+        {
+            tree->nodeCapacity = (tree->nodeCapacity > 0)? tree->nodeCapacity*2 : 64;
+            tree->nodes = (SpatialTreeNode *)RL_REALLOC(tree->nodes, tree->nodeCapacity*sizeof(SpatialTreeNode));
+            tree->boxes = (BoundingBox *)RL_REALLOC(tree->boxes, tree->nodeCapacity*sizeof(BoundingBox));
+
+            if (tree->stackCapacity < tree->nodeCapacity)
+            {
+                tree->stackCapacity = tree->nodeCapacity;
+                tree->stack = (int *)RL_REALLOC(tree->stack, tree->stackCapacity*sizeof(int));
+            }
+        }
+
+        index = tree->nodeCount++;
+    }
+
+    tree->nodes[index].parent = -1;
+    tree->nodes[index].child1 = -1;
+    tree->nodes[index].child2 = -1;
+    tree->nodes[index].height = 0;
+
+    return index;
+}
+
+// Insert leaf node into spatial tree
+// NOTE: Sibling is chosen descending the tree by lowest surface area cost, ancestors
+// boxes and heights are refit after insertion, balancing the tree on the way up
+static void InsertSpatialTreeLeaf(SpatialTree *tree, int leaf)
+{
+    #define BOX_AREA(b) (((b).max.x - (b).min.x)*((b).max.y - (b).min.y) + ((b).max.y - (b).min.y)*((b).max.z - (b).min.z) + ((b).max.z - (b).min.z)*((b).max.x - (b).min.x))
+    #define BOX_MERGE(b1, b2) (BoundingBox){ Vector3Min((b1).min, (b2).min), Vector3Max((b1).max, (b2).max) }
+
+    if (tree->root == -1)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
+
+    BoundingBox leafBox = tree->nodes[leaf].box;
+    int index = tree->root;
+
+    while (tree->nodes[index].height > 0)
+    {
+        int child1 = tree->nodes[index].child1;
+        int child2 = tree->nodes[index].child2;
+
+        BoundingBox combined = BOX_MERGE(tree->nodes[index].box, leafBox);
+        float combinedArea = BOX_AREA(combined);
+
+        // Cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f*combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f*(combinedArea - BOX_AREA(tree->nodes[index].box));
+
+        BoundingBox box1 = BOX_MERGE(tree->nodes[child1].box, leafBox);
+        BoundingBox box2 = BOX_MERGE(tree->nodes[child2].box, leafBox);
+        float cost1 = BOX_AREA(box1) + inheritanceCost;
+        float cost2 = BOX_AREA(box2) + inheritanceCost;
+
+        if (tree->nodes[child1].height > 0) cost1 -= BOX_AREA(tree->nodes[child1].box);
+        if (tree->nodes[child2].height > 0) cost2 -= BOX_AREA(tree->nodes[child2].box);
+
+        if ((cost < cost1) && (cost < cost2)) break;
+
+        index = (cost1 < cost2)? child1 : child2;
+    }
+
+    // Create new parent for sibling and leaf
+    int sibling = index;
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateSpatialTreeNode(tree);
+
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].box = BOX_MERGE(leafBox, tree->nodes[sibling].box);
+    tree->nodes[newParent].height = tree->nodes[sibling].height + 1;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    if (oldParent != -1)
+    {
+        if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+        else tree->nodes[oldParent].child2 = newParent;
+    }
+    else tree->root = newParent;
+
+    // Refit ancestors
+    index = tree->nodes[leaf].parent;
+
+    while (index != -1)
+    {
+        index = BalanceSpatialTreeNode(tree, index);
+
+        int child1 = tree->nodes[index].child1;
+        int child2 = tree->nodes[index].child2;
+
+        tree->nodes[index].height = 1 + ((tree->nodes[child1].height > tree->nodes[child2].height)? tree->nodes[child1].height : tree->nodes[child2].height);
+        tree->nodes[index].box = BOX_MERGE(tree->nodes[child1].box, tree->nodes[child2].box);
+
+        index = tree->nodes[index].parent;
+    }
+
+    #undef BOX_AREA
+    #undef BOX_MERGE
+}
+
+// Remove leaf node from spatial tree (node not freed)
+static void RemoveSpatialTreeLeaf(SpatialTree *tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = -1;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    // Parent node replaced by sibling
+    tree->nodes[parent].height = -1;
+    tree->nodes[parent].parent = tree->freeNode;
+    tree->freeNode = parent;
+
+    tree->nodes[sibling].parent = grandParent;
+
+    if (grandParent == -1)
+    {
+        tree->root = sibling;
+        return;
+    }
+
+    if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+    else tree->nodes[grandParent].child2 = sibling;
+
+    // Refit ancestors
+    int index = grandParent;
+
+    while (index != -1)
+    {
+        index = BalanceSpatialTreeNode(tree, index);
+
+        int child1 = tree->nodes[index].child1;
+        int child2 = tree->nodes[index].child2;
+
+        tree->nodes[index].height = 1 + ((tree->nodes[child1].height > tree->nodes[child2].height)? tree->nodes[child1].height : tree->nodes[child2].height);
+        tree->nodes[index].box.min = Vector3Min(tree->nodes[child1].box.min, tree->nodes[child2].box.min);
+        tree->nodes[index].box.max = Vector3Max(tree->nodes[child1].box.max, tree->nodes[child2].box.max);
+
+        index = tree->nodes[index].parent;
+    }
+}
+
+// Balance spatial tree node with a rotation if its children heights differ more than 1
+// NOTE: Returns new root of the node subtree
+static int BalanceSpatialTreeNode(SpatialTree *tree, int index)
+{
+    SpatialTreeNode *nodes = tree->nodes;
+    SpatialTreeNode *a = &nodes[index];
+
+    if ((a->height < 2) || (a->child1 == -1)) return index;
+
+    int indexB = a->child1;
+    int indexC = a->child2;
+    SpatialTreeNode *b = &nodes[indexB];
+    SpatialTreeNode *c = &nodes[indexC];
+
+    int balance = c->height - b->height;
+
+    if ((balance >= -1) && (balance <= 1)) return index;
+
+    // Rotate higher child up: child takes node place and node takes one of its children place,
+    // higher grandchild is kept under the raised child
+    int indexUp = (balance > 1)? indexC : indexB;
+    int indexKept = (balance > 1)? indexB : indexC;
+    SpatialTreeNode *up = &nodes[indexUp];
+    SpatialTreeNode *kept = &nodes[indexKept];
+
+    int indexF = up->child1;
+    int indexG = up->child2;
+    SpatialTreeNode *f = &nodes[indexF];
+    SpatialTreeNode *g = &nodes[indexG];
+
+    up->child1 = index;
+    up->parent = a->parent;
+    a->parent = indexUp;
+
+    if (up->parent != -1)
+    {
+        if (nodes[up->parent].child1 == index) nodes[up->parent].child1 = indexUp;
+        else nodes[up->parent].child2 = indexUp;
+    }
+    else tree->root = indexUp;
+
+    int indexHigh = (f->height > g->height)? indexF : indexG;
+    int indexLow = (f->height > g->height)? indexG : indexF;
+    SpatialTreeNode *high = &nodes[indexHigh];
+    SpatialTreeNode *low = &nodes[indexLow];
+
+    up->child2 = indexHigh;
+    if (balance > 1) a->child2 = indexLow;
+    else a->child1 = indexLow;
+    low->parent = index;
+
+    a->box.min = Vector3Min(kept->box.min, low->box.min);
+    a->box.max = Vector3Max(kept->box.max, low->box.max);
+    a->height = 1 + ((kept->height > low->height)? kept->height : low->height);
+
+    up->box.min = Vector3Min(a->box.min, high->box.min);
+    up->box.max = Vector3Max(a->box.max, high->box.max);
+    up->height = 1 + ((a->height > high->height)? a->height : high->height);
+
+    return indexUp;
+}
+
+// Get transform matrix (scale -> rotation -> translation)
+static Matrix GetTransformMatrix(Transform transform)
+{
+    Matrix result = QuaternionToMatrix(transform.rotation);
+
+    // Scale rotation matrix columns, translation set directly
+    result.m0 *= transform.scale.x; result.m1 *= transform.scale.x; result.m2 *= transform.scale.x;
+    result.m4 *= transform.scale.y; result.m5 *= transform.scale.y; result.m6 *= transform.scale.y;
+    result.m8 *= transform.scale.z; result.m9 *= transform.scale.z; result.m10 *= transform.scale.z;
+    result.m12 = transform.translation.x;
+    result.m13 = transform.translation.y;
+    result.m14 = transform.translation.z;
+
+    return result;
+}
+
+// Load bones inverse bind matrices, used to compute bones matrices on animation update
+static Matrix *LoadBindPoseInverse(const Transform *bindPose, int boneCount)
+{
+    Matrix *bindPoseInverse = NULL;
+
+    if ((bindPose != NULL) && (boneCount > 0))
+    {
+        bindPoseInverse = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+
+        for (int i = 0; i < boneCount; i++) bindPoseInverse[i] = MatrixInvert(GetTransformMatrix(bindPose[i]));
+    }
+
+    return bindPoseInverse;
+}
+
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Load default GPU skinning shader
+// NOTE: Same as rlgl default shader with vertex position blended by 4 bone matrices,
+// default fragment shader is reused
+static void LoadShaderSkinningDefault(void)
+{
+    const char *skinningVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 boneMatrices[" SKINNING_TOSTRING(MAX_GPU_SKINNING_BONES) "]; \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    mat4 skinMatrix = vertexBoneWeights.x*boneMatrices[int(vertexBoneIds.x)] + \n"
+    "        vertexBoneWeights.y*boneMatrices[int(vertexBoneIds.y)] + \n"
+    "        vertexBoneWeights.z*boneMatrices[int(vertexBoneIds.z)] + \n"
+    "        vertexBoneWeights.w*boneMatrices[int(vertexBoneIds.w)]; \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // WARNING: OpenGL ES does not support matrix transpose on upload, bone matrices are received transposed
+    "    gl_Position = mvp*(vec4(vertexPosition, 1.0)*skinMatrix); \n"
+#else
+    "    gl_Position = mvp*(skinMatrix*vec4(vertexPosition, 1.0)); \n"
+#endif
+    "}                                  \n";
+
+    // NOTE: Default fragment shader is used if not provided
+    Shader shader = LoadShaderFromMemory(skinningVShaderCode, NULL);
+
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()) &&
+        (shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        skinningShader = shader;
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Default skinning shader loaded successfully (max %i bones)", shader.id, MAX_GPU_SKINNING_BONES);
+    }
+    else
+    {
+        UnloadShader(shader);
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load default skinning shader");
+    }
+}
+#endif
+
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF) and animation clips sampling
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+
+// Check if keys span interpolation reproduces all skipped frames values (within tolerance)
+// NOTE: Rotations are interpolated with normalized lerp, same as on clip sampling
+static bool IsAnimationKeySpanValid(const float *values, int first, int last, bool rotation)
+{
+    const float *v0 = values + first*4;
+    const float *v1 = values + last*4;
+
+    for (int i = first + 1; i < last; i++)
+    {
+        float t = (float)(i - first)/(float)(last - first);
+        float value[4] = { 0 };
+        float length = 0.0f;
+
+        for (int c = 0; c < 4; c++)
+        {
+            value[c] = v0[c] + (v1[c] - v0[c])*t;
+            length += value[c]*value[c];
+        }
+
+        if (rotation && (length > 0.0f))
+        {
+            float ilength = 1.0f/sqrtf(length);
+            for (int c = 0; c < 4; c++) value[c] *= ilength;
+        }
+
+        for (int c = 0; c < 4; c++) if (fabsf(value[c] - values[i*4 + c]) > ANIMATION_KEY_TOLERANCE) return false;
+    }
+
+    return true;
+}
+
+// Get animation clip frame (fractional) for a given time, clip is looped
+static float GetAnimationClipFrame(AnimationClip clip, float time)
+{
+    float frame = 0.0f;
+
+    if (clip.frameCount > 1)
+    {
+        float lastFrame = (float)(clip.frameCount - 1);
+
+        frame = fmodf(time*clip.frameRate, lastFrame);
+        if (frame < 0.0f) frame += lastFrame;
+    }
+
+    return frame;
+}
+
+// Sample animation clip track at a given frame (fractional)
+// NOTE: Track keys are found by binary search on key frames, values are dequantized and interpolated
+static void SampleAnimationTrack(const AnimationClip *clip, int track, float frame, float *value)
+{
+    int first = clip->trackKeys[track];
+    int last = clip->trackKeys[track + 1] - 1;
+    const float *range = clip->trackRanges + track*8;
+
+    int key = first;
+    float blend = 0.0f;
+
+    if ((last > first) && (frame > clip->keyFrames[first]))
+    {
+        if (frame >= clip->keyFrames[last]) key = last;
+        else
+        {
+            int low = first;
+            int high = last;
+
+            while ((high - low) > 1)
+            {
+                int mid = (low + high)/2;
+
+                if (clip->keyFrames[mid] <= frame) low = mid;
+                else high = mid;
+            }
+
+            key = low;
+            blend = (frame - clip->keyFrames[low])/(float)(clip->keyFrames[high] - clip->keyFrames[low]);
+        }
+    }
+
+    const unsigned short *key0 = clip->keyValues + key*4;
+    const unsigned short *key1 = (blend > 0.0f)? key0 + 4 : key0;
+
+    for (int c = 0; c < 4; c++)
+    {
+        float value0 = range[c] + key0[c]*range[4 + c];
+        float value1 = range[c] + key1[c]*range[4 + c];
+
+        value[c] = value0 + (value1 - value0)*blend;
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+//
+// Keep the following information in mind when reading this
+//  - A mesh is created for every material present in the obj file
+//  - the model.meshCount is therefore the materialCount returned from tinyobj
+//  - the mesh is automatically triangulated by tinyobj
+static Model LoadOBJ(const char *fileName)
+{
+    tinyobj_attrib_t objAttributes = { 0 };
+    tinyobj_shape_t *objShapes = NULL;
+    unsigned int objShapeCount = 0;
+
+    tinyobj_material_t *objMaterials = NULL;
+    unsigned int objMaterialCount = 0;
+
+    Model model = { 0 };
+    model.transform = MatrixIdentity();
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText == NULL)
+    {
+        TRACELOG(LOG_ERROR, "MODEL: [%s] Unable to read obj file", fileName);
+        return model;
+    }
+
+    char currentDir[1024] = { 0 };
+    strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
+    const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
     if (CHDIR(workingDir) != 0) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
 
     unsigned int dataSize = (unsigned int)strlen(fileText);
@@ -4779,6 +6262,7 @@ static Model LoadIQM(const char *fileName)
     }
 
     BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+    model.bindPoseInverse = LoadBindPoseInverse(model.bindPose, model.boneCount);
 
     for (int i = 0; i < model.meshCount; i++)
     {
@@ -5219,18 +6703,17 @@ static Model LoadGLTF(const char *fileName)
 
     Model model = { 0 };
 
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // glTF file loading, file data mapped into memory if available (not copied)
+    FileView view = LoadFileView(fileName);
 
-    if (fileData == NULL) return model;
+    if (view.data == NULL) return model;
 
     // glTF data loading
     cgltf_options options = { 0 };
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, view.data, view.dataSize, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5743,6 +7226,8 @@ static Model LoadGLTF(const char *fileName)
                 };
                 MatrixDecompose(worldMatrix, &(model.bindPose[i].translation), &(model.bindPose[i].rotation), &(model.bindPose[i].scale));
             }
+
+            model.bindPoseInverse = LoadBindPoseInverse(model.bindPose, model.boneCount);
         }
         if (data->skins_count > 1)
         {
@@ -5898,7 +7383,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileView(view);
 
     return model;
 }
@@ -6648,6 +8133,8 @@ static Model LoadM3D(const char *fileName)
             model.bindPose[i].rotation.z = 0.0f;
             model.bindPose[i].rotation.w = 1.0f;
             model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+
+            model.bindPoseInverse = LoadBindPoseInverse(model.bindPose, model.boneCount);
         }
 
         // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
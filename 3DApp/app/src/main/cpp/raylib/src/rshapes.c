@@ -56,8 +56,8 @@
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
-#include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <float.h>      // Required for: FLT_EPSILON, FLT_MAX
+#include <stdlib.h>     // Required for: RL_FREE, abs()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -71,10 +71,41 @@
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
 
+// Spatial grid cell coordinate and cell hash, used by broadphase functions
+#define SPATIAL_GRID_CELL(grid, value) ((int)floorf((value)/(grid)->cellSize))
+#define SPATIAL_GRID_HASH(grid, x, y) ((((unsigned int)(x)*73856093u)^((unsigned int)(y)*19349663u))&((grid)->bucketCount - 1))
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Spatial grid entry, one per grid cell covered by a body
+typedef struct SpatialGridEntry {
+    int cellX;                  // Cell coordinate x
+    int cellY;                  // Cell coordinate y
+    int body;                   // Body handle
+} SpatialGridEntry;
+
+// Spatial grid, uniform grid for 2d broadphase
+// NOTE: Cells are stored in a hash table, entries sorted by bucket, cells are
+// rebuilt on next query only if any body changed its covered cells
+struct SpatialGrid {
+    float cellSize;             // Grid cell size
+
+    int bodyCount;              // Bodies slots in use (including removed ones)
+    int bodyCapacity;           // Bodies slots allocated
+    Rectangle *bounds;          // Bodies bounds (width < 0.0f for removed bodies)
+    int *freeBodies;            // Removed bodies handles, to be reused
+    int freeCount;              // Removed bodies handles count
+    unsigned int *queryMarks;   // Bodies query marks, to avoid duplicates on queries
+    unsigned int queryMark;     // Current query mark
+
+    bool dirty;                 // Cells require rebuild
+    int bucketCount;            // Hash table buckets count (power of two)
+    int *buckets;               // Hash table buckets first entry (bucketCount + 1)
+    SpatialGridEntry *entries;  // Cells entries, sorted by bucket
+    int entryCount;             // Cells entries count
+    int entryCapacity;          // Cells entries allocated
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -86,6 +117,8 @@ static Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void BuildSpatialGridCells(SpatialGrid *grid);               // Build spatial grid cells from bodies bounds
+static unsigned int GetSpatialGridQueryMark(SpatialGrid *grid);     // Get new spatial grid query mark
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -2391,6 +2424,253 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
     return overlap;
 }
 
+// Load spatial grid with defined cell size
+// NOTE: Cell size should be similar to the usual bodies size
+SpatialGrid *LoadSpatialGrid(float cellSize)
+{
+    SpatialGrid *grid = (SpatialGrid *)RL_CALLOC(1, sizeof(SpatialGrid));
+
+    grid->cellSize = (cellSize > 0.0f)? cellSize : 1.0f;
+    grid->dirty = true;         // Cells built on first query, even without bodies (buckets allocated)
+
+    return grid;
+}
+
+// Unload spatial grid
+void UnloadSpatialGrid(SpatialGrid *grid)
+{
+    if (grid == NULL) return;
+
+    RL_FREE(grid->bounds);
+    RL_FREE(grid->freeBodies);
+    RL_FREE(grid->queryMarks);
+    RL_FREE(grid->buckets);
+    RL_FREE(grid->entries);
+    RL_FREE(grid);
+}
+
+// Add body to spatial grid, returns body handle
+int AddSpatialGridBody(SpatialGrid *grid, Rectangle bounds)
+{
+    int handle = 0;
+
+    if (grid->freeCount > 0) handle = grid->freeBodies[--grid->freeCount];
+    else
+    {
+        if (grid->bodyCount == grid->bodyCapacity)
+        {
+            grid->bodyCapacity = (grid->bodyCapacity > 0)? grid->bodyCapacity*2 : 64;
+            grid->bounds = (Rectangle *)RL_REALLOC(grid->bounds, grid->bodyCapacity*sizeof(Rectangle));
+            grid->freeBodies = (int *)RL_REALLOC(grid->freeBodies, grid->bodyCapacity*sizeof(int));
+            grid->queryMarks = (unsigned int *)RL_REALLOC(grid->queryMarks, grid->bodyCapacity*sizeof(unsigned int));
+        }
+
+        handle = grid->bodyCount++;
+    }
+
+    if (bounds.width < 0.0f) bounds.width = 0.0f;
+    if (bounds.height < 0.0f) bounds.height = 0.0f;
+
+    grid->bounds[handle] = bounds;
+    grid->queryMarks[handle] = 0;
+    grid->dirty = true;
+
+    return handle;
+}
+
+// Update spatial grid body bounds
+// NOTE: Cells are only rebuilt if body covered cells changed
+void UpdateSpatialGridBody(SpatialGrid *grid, int handle, Rectangle bounds)
+{
+    if ((handle < 0) || (handle >= grid->bodyCount) || (grid->bounds[handle].width < 0.0f)) return;
+
+    if (bounds.width < 0.0f) bounds.width = 0.0f;
+    if (bounds.height < 0.0f) bounds.height = 0.0f;
+
+    Rectangle prev = grid->bounds[handle];
+
+    if (!grid->dirty &&
+        ((SPATIAL_GRID_CELL(grid, prev.x) != SPATIAL_GRID_CELL(grid, bounds.x)) ||
+         (SPATIAL_GRID_CELL(grid, prev.y) != SPATIAL_GRID_CELL(grid, bounds.y)) ||
+         (SPATIAL_GRID_CELL(grid, prev.x + prev.width) != SPATIAL_GRID_CELL(grid, bounds.x + bounds.width)) ||
+         (SPATIAL_GRID_CELL(grid, prev.y + prev.height) != SPATIAL_GRID_CELL(grid, bounds.y + bounds.height)))) grid->dirty = true;
+
+    grid->bounds[handle] = bounds;
+}
+
+// Remove body from spatial grid
+// NOTE: Body handle can be returned again by AddSpatialGridBody()
+void RemoveSpatialGridBody(SpatialGrid *grid, int handle)
+{
+    if ((handle < 0) || (handle >= grid->bodyCount) || (grid->bounds[handle].width < 0.0f)) return;
+
+    grid->bounds[handle].width = -1.0f;
+    grid->freeBodies[grid->freeCount++] = handle;
+    grid->dirty = true;
+}
+
+// Get spatial grid overlapping bodies pairs, returns pairs count (up to maxPairs)
+// NOTE: Pairs are checked with CheckCollisionRecs(), every pair is only reported once,
+// by the cell containing the overlap rectangle top-left corner
+int GetSpatialGridPairs(SpatialGrid *grid, BodyPair *pairs, int maxPairs)
+{
+    int pairCount = 0;
+
+    if (grid->dirty) BuildSpatialGridCells(grid);
+
+    for (int b = 0; b < grid->bucketCount; b++)
+    {
+        int end = grid->buckets[b + 1];
+
+        for (int i = grid->buckets[b]; i < end; i++)
+        {
+            SpatialGridEntry entry = grid->entries[i];
+            Rectangle rec1 = grid->bounds[entry.body];
+
+            for (int j = i + 1; j < end; j++)
+            {
+                SpatialGridEntry other = grid->entries[j];
+
+                // NOTE: Different cells can share the same bucket
+                if ((other.cellX != entry.cellX) || (other.cellY != entry.cellY)) continue;
+
+                Rectangle rec2 = grid->bounds[other.body];
+
+                if (!CheckCollisionRecs(rec1, rec2)) continue;
+                if ((SPATIAL_GRID_CELL(grid, fmaxf(rec1.x, rec2.x)) != entry.cellX) ||
+                    (SPATIAL_GRID_CELL(grid, fmaxf(rec1.y, rec2.y)) != entry.cellY)) continue;
+
+                if (pairCount == maxPairs) return pairCount;
+
+                pairs[pairCount].a = (entry.body < other.body)? entry.body : other.body;
+                pairs[pairCount].b = (entry.body < other.body)? other.body : entry.body;
+                pairCount++;
+            }
+        }
+    }
+
+    return pairCount;
+}
+
+// Get spatial grid bodies overlapping rectangle, returns bodies count (up to maxHandles)
+int GetSpatialGridBodiesRec(SpatialGrid *grid, Rectangle rec, int *handles, int maxHandles)
+{
+    int count = 0;
+
+    if (grid->dirty) BuildSpatialGridCells(grid);
+
+    int minX = SPATIAL_GRID_CELL(grid, rec.x);
+    int minY = SPATIAL_GRID_CELL(grid, rec.y);
+    int maxX = SPATIAL_GRID_CELL(grid, rec.x + rec.width);
+    int maxY = SPATIAL_GRID_CELL(grid, rec.y + rec.height);
+
+    // Rectangles covering more cells than entries are checked against all bodies
+    if (((float)(maxX - minX + 1)*(float)(maxY - minY + 1)) > (float)grid->entryCount)
+    {
+        for (int i = 0; (i < grid->bodyCount) && (count < maxHandles); i++)
+        {
+            if ((grid->bounds[i].width >= 0.0f) && CheckCollisionRecs(grid->bounds[i], rec)) handles[count++] = i;
+        }
+
+        return count;
+    }
+
+    unsigned int mark = GetSpatialGridQueryMark(grid);
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        for (int x = minX; x <= maxX; x++)
+        {
+            unsigned int bucket = SPATIAL_GRID_HASH(grid, x, y);
+
+            for (int i = grid->buckets[bucket]; i < grid->buckets[bucket + 1]; i++)
+            {
+                SpatialGridEntry entry = grid->entries[i];
+
+                if ((entry.cellX != x) || (entry.cellY != y) || (grid->queryMarks[entry.body] == mark)) continue;
+
+                grid->queryMarks[entry.body] = mark;
+
+                if (CheckCollisionRecs(grid->bounds[entry.body], rec))
+                {
+                    if (count == maxHandles) return count;
+                    handles[count++] = entry.body;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Get spatial grid bodies hit by ray, up to distance, returns bodies count (up to maxHandles)
+// NOTE: Cells are traversed along the ray, bodies are returned roughly sorted by distance
+int GetSpatialGridBodiesRay(SpatialGrid *grid, Vector2 position, Vector2 direction, float distance, int *handles, int maxHandles)
+{
+    int count = 0;
+
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+    if ((length == 0.0f) || (distance <= 0.0f)) return count;
+
+    if (grid->dirty) BuildSpatialGridCells(grid);
+
+    direction.x /= length;
+    direction.y /= length;
+
+    Vector2 invDirection = { 1.0f/direction.x, 1.0f/direction.y };
+
+    // Cells traversal setup, step and distance to next cell boundary on every axis
+    int x = SPATIAL_GRID_CELL(grid, position.x);
+    int y = SPATIAL_GRID_CELL(grid, position.y);
+    int endX = SPATIAL_GRID_CELL(grid, position.x + direction.x*distance);
+    int endY = SPATIAL_GRID_CELL(grid, position.y + direction.y*distance);
+    int stepX = (direction.x > 0.0f)? 1 : -1;
+    int stepY = (direction.y > 0.0f)? 1 : -1;
+
+    float deltaX = fabsf(grid->cellSize*invDirection.x);
+    float deltaY = fabsf(grid->cellSize*invDirection.y);
+    float nextX = (direction.x == 0.0f)? FLT_MAX : ((x + ((stepX > 0)? 1 : 0))*grid->cellSize - position.x)*invDirection.x;
+    float nextY = (direction.y == 0.0f)? FLT_MAX : ((y + ((stepY > 0)? 1 : 0))*grid->cellSize - position.y)*invDirection.y;
+
+    int cellCount = abs(endX - x) + abs(endY - y) + 1;
+    unsigned int mark = GetSpatialGridQueryMark(grid);
+
+    for (int c = 0; c < cellCount; c++)
+    {
+        unsigned int bucket = SPATIAL_GRID_HASH(grid, x, y);
+
+        for (int i = grid->buckets[bucket]; i < grid->buckets[bucket + 1]; i++)
+        {
+            SpatialGridEntry entry = grid->entries[i];
+
+            if ((entry.cellX != x) || (entry.cellY != y) || (grid->queryMarks[entry.body] == mark)) continue;
+
+            grid->queryMarks[entry.body] = mark;
+
+            // Check ray against body bounds (slabs test)
+            Rectangle rec = grid->bounds[entry.body];
+            float tx1 = (rec.x - position.x)*invDirection.x;
+            float tx2 = (rec.x + rec.width - position.x)*invDirection.x;
+            float ty1 = (rec.y - position.y)*invDirection.y;
+            float ty2 = (rec.y + rec.height - position.y)*invDirection.y;
+            float tmin = fmaxf(fminf(tx1, tx2), fminf(ty1, ty2));
+            float tmax = fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2));
+
+            if ((tmax >= 0.0f) && (tmin <= tmax) && (tmin <= distance))
+            {
+                if (count == maxHandles) return count;
+                handles[count++] = entry.body;
+            }
+        }
+
+        // Move to next cell along the ray
+        if (nextX < nextY) { x += stepX; nextX += deltaX; }
+        else { y += stepY; nextY += deltaY; }
+    }
+
+    return count;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -2411,4 +2691,93 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return result;
 }
 
+// Build spatial grid cells from bodies bounds
+// NOTE: Entries are sorted by hash bucket with a counting sort, covered cells are computed twice
+// (count and fill) to avoid an intermediate buffer
+static void BuildSpatialGridCells(SpatialGrid *grid)
+{
+    int entryCount = 0;
+
+    for (int i = 0; i < grid->bodyCount; i++)
+    {
+        Rectangle rec = grid->bounds[i];
+        if (rec.width < 0.0f) continue;
+
+        entryCount += (SPATIAL_GRID_CELL(grid, rec.x + rec.width) - SPATIAL_GRID_CELL(grid, rec.x) + 1)*
+                      (SPATIAL_GRID_CELL(grid, rec.y + rec.height) - SPATIAL_GRID_CELL(grid, rec.y) + 1);
+    }
+
+    if (entryCount > grid->entryCapacity)
+    {
+        grid->entryCapacity = entryCount + entryCount/2;
+        grid->entries = (SpatialGridEntry *)RL_REALLOC(grid->entries, grid->entryCapacity*sizeof(SpatialGridEntry));
+    }
+
+    // Hash table sized to the entries count, kept if large enough
+    int bucketCount = 64;
+    while (bucketCount < entryCount) bucketCount *= 2;
+
+    if ((bucketCount > grid->bucketCount) || (bucketCount < grid->bucketCount/4))
+    {
+        grid->bucketCount = bucketCount;
+        grid->buckets = (int *)RL_REALLOC(grid->buckets, (bucketCount + 1)*sizeof(int));
+    }
+
+    for (int b = 0; b <= grid->bucketCount; b++) grid->buckets[b] = 0;
+
+    // Count bucket entries, buckets end offsets computed after
+    for (int i = 0; i < grid->bodyCount; i++)
+    {
+        Rectangle rec = grid->bounds[i];
+        if (rec.width < 0.0f) continue;
+
+        int maxX = SPATIAL_GRID_CELL(grid, rec.x + rec.width);
+        int maxY = SPATIAL_GRID_CELL(grid, rec.y + rec.height);
+
+        for (int y = SPATIAL_GRID_CELL(grid, rec.y); y <= maxY; y++)
+        {
+            for (int x = SPATIAL_GRID_CELL(grid, rec.x); x <= maxX; x++) grid->buckets[SPATIAL_GRID_HASH(grid, x, y)]++;
+        }
+    }
+
+    for (int b = 1; b <= grid->bucketCount; b++) grid->buckets[b] += grid->buckets[b - 1];
+
+    // Fill entries backwards from buckets end, buckets end up pointing to their first entry
+    for (int i = grid->bodyCount - 1; i >= 0; i--)
+    {
+        Rectangle rec = grid->bounds[i];
+        if (rec.width < 0.0f) continue;
+
+        int maxX = SPATIAL_GRID_CELL(grid, rec.x + rec.width);
+        int maxY = SPATIAL_GRID_CELL(grid, rec.y + rec.height);
+
+        for (int y = SPATIAL_GRID_CELL(grid, rec.y); y <= maxY; y++)
+        {
+            for (int x = SPATIAL_GRID_CELL(grid, rec.x); x <= maxX; x++)
+            {
+                int index = --grid->buckets[SPATIAL_GRID_HASH(grid, x, y)];
+                grid->entries[index] = (SpatialGridEntry){ x, y, i };
+            }
+        }
+    }
+
+    grid->entryCount = entryCount;
+    grid->dirty = false;
+}
+
+// Get new spatial grid query mark
+static unsigned int GetSpatialGridQueryMark(SpatialGrid *grid)
+{
+    grid->queryMark++;
+
+    // Marks reset on overflow
+    if (grid->queryMark == 0)
+    {
+        for (int i = 0; i < grid->bodyCount; i++) grid->queryMarks[i] = 0;
+        grid->queryMark = 1;
+    }
+
+    return grid->queryMark;
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
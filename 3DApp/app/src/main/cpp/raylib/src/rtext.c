@@ -29,7 +29,7 @@
 *
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
-*       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
+*       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation (implemented in rtextures)
 *
 *
 *   LICENSE: zlib/libpng
@@ -63,7 +63,7 @@
 #if defined(SUPPORT_MODULE_RTEXT)
 
 #include "utils.h"          // Required for: LoadFile*()
-#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
+#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro(), DrawTextRun()
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
@@ -77,7 +77,7 @@
         #pragma GCC diagnostic ignored "-Wunused-function"
     #endif
 
-    #define STB_RECT_PACK_IMPLEMENTATION
+    // NOTE: stb_rect_pack implementation is included by rtextures module
     #include "external/stb_rect_pack.h"     // Required for: ttf/bdf font rectangles packaging
 
     #include <math.h>   // Required for: ttf/bdf font rectangles packaging
@@ -115,11 +115,72 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_RUN_CACHE
+    #define MAX_TEXT_RUN_CACHE                    64        // Maximum number of cached text runs: DrawTextCached(), MeasureTextCached()
+#endif
+#ifndef FONT_GLYPHS_RANGE
+    #define FONT_GLYPHS_RANGE                     32        // Minimum glyphs per range on multi-threaded font glyphs loading: LoadFontData()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Text run cache entry, text runs cached by font, text and layout parameters
+typedef struct TextRunCacheEntry {
+    unsigned int hash;          // Text hash (FNV-1a)
+    char *text;                 // Text copy, compared on hash match (NULL for free entries)
+    const GlyphInfo *glyphs;    // Font glyphs (font identification)
+    unsigned int textureId;     // Font texture id
+    float fontSize;             // Text font size
+    float spacing;              // Text spacing
+    int lineSpacing;            // Text line spacing, SetTextLineSpacing()
+    unsigned int lastUse;       // Entry last use mark, for least recently used entry eviction
+    TextRun run;                // Cached text run
+} TextRunCacheEntry;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs loading job data, shared by all glyphs ranges
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info for data reading (read-only)
+    const int *codepoints;      // Codepoints to load
+    GlyphInfo *glyphs;          // Loaded glyphs, one per codepoint
+    int fontSize;               // Font size (glyphs rasterization height)
+    int type;                   // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF
+    float scaleFactor;          // Font scale factor for font size
+    int ascent;                 // Font ascent (unscaled)
+} FontGlyphsJob;
+
+// Dynamic font glyph, metrics are kept when glyph is evicted from atlas
+typedef struct DynamicGlyph {
+    int value;                  // Glyph codepoint
+    int glyphIndex;             // Glyph index in font data
+    int offsetX;                // Glyph offset X
+    int offsetY;                // Glyph offset Y (from top)
+    int advanceX;               // Glyph advance X
+    int width;                  // Glyph bitmap width
+    int height;                 // Glyph bitmap height
+    int sprite;                 // Glyph sprite in atlas (-1 if not rasterized)
+} DynamicGlyph;
+
+// Dynamic font, glyphs rasterized on demand into atlas pages
+struct DynamicFont {
+    FileView view;              // Font file view (mapped or loaded), kept resident for glyphs rasterization
+    stbtt_fontinfo fontInfo;    // Font info for data reading
+    int baseSize;               // Base size (glyphs rasterization height)
+    float scaleFactor;          // Font scale factor for base size
+    int ascent;                 // Font ascent scaled to base size (baseline)
+
+    TextureAtlas *atlas;        // Glyphs atlas pages, least recently used page evicted if full
+
+    DynamicGlyph *glyphs;       // Glyphs requested (metrics loaded)
+    int glyphCount;             // Glyphs count
+    int glyphCapacity;          // Glyphs allocated
+    int fallbackIndex;          // Fallback glyph '?' index (-1 if not available)
+
+    int hashSize;               // Glyphs hash table size (power of two)
+    int *hash;                  // Glyphs hash table slots, 2 per slot: codepoint (-1 for empty slots), glyph index
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -131,6 +192,9 @@ extern bool isGpuReady;
 static Font defaultFont = { 0 };
 #endif
 
+static TextRunCacheEntry textRunCache[MAX_TEXT_RUN_CACHE] = { 0 };  // Text runs cache: DrawTextCached(), MeasureTextCached()
+static unsigned int textRunCacheUseMark = 0;                        // Text runs cache current use mark
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -145,6 +209,17 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static void UnloadGlyphLookup(GlyphLookup *lookup);  // Unload glyphs lookup table
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint);  // Draw one glyph by index, glyph lookup already done
+static TextRun *GetTextRunCached(Font font, const char *text, float fontSize, float spacing);  // Get text run from cache (laid out if not found)
+static void UnloadTextRunCache(const GlyphInfo *glyphs);      // Unload cached text runs for a font (glyphs), all if NULL
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static int GetDynamicGlyphIndex(DynamicFont *font, int codepoint);            // Get dynamic font glyph index (metrics loaded on first request)
+static void RasterizeDynamicGlyph(DynamicFont *font, DynamicGlyph *glyph);    // Rasterize dynamic font glyph into atlas pages
+static DynamicFont *LoadDynamicFontFromView(FileView view, int fontSize, int pageSize, int maxPages); // Load dynamic font from file view (view owned by font)
+static void LoadFontGlyphs(void *userData, int start, int end);               // Load a range of font glyphs (metrics and image)
+#endif
+
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -302,6 +377,8 @@ extern void LoadFontDefault(void)
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
 
+    GenFontGlyphLookup(&defaultFont);
+
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
 
@@ -312,6 +389,10 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphLookup(defaultFont.lookup);
+
+    // NOTE: Default font is unloaded on CloseWindow(), all cached text runs are unloaded
+    UnloadTextRunCache(NULL);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -383,16 +464,15 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file view, file data mapped into memory if available (not copied)
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
         // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        font = LoadFontFromMemory(GetFileExtension(fileName), view.data, view.dataSize, fontSize, codepoints, codepointCount);
 
-        UnloadFileData(fileData);
+        UnloadFileView(view);
     }
 
     return font;
@@ -520,6 +600,10 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
     font.baseSize = (int)font.recs[0].height;
 
+    // NOTE: Font was initialized from default font, its glyphs lookup must not be replaced
+    font.lookup = NULL;
+    GenFontGlyphLookup(&font);
+
     return font;
 }
 
@@ -571,6 +655,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        GenFontGlyphLookup(&font);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -646,82 +732,18 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
-
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
-            }
+            // Rasterize glyphs by ranges, in parallel if worker threads available
+            // NOTE: Every glyph is written to its own slot, output order is the same as serial loading
+            FontGlyphsJob job = { 0 };
+            job.fontInfo = &fontInfo;
+            job.codepoints = codepoints;
+            job.glyphs = chars;
+            job.fontSize = fontSize;
+            job.type = type;
+            job.scaleFactor = scaleFactor;
+            job.ascent = ascent;
+
+            RunWorkerJobs(LoadFontGlyphs, &job, codepointCount, FONT_GLYPHS_RANGE);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -933,6 +955,62 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 }
 #endif
 
+// Generate font glyphs lookup table, used by GetGlyphIndex()
+// NOTE: Codepoints in [0..255] range are resolved by a direct table, other codepoints by a hash table,
+// codepoints not available in font resolve to '?' glyph (same results than unordered charset scan)
+void GenFontGlyphLookup(Font *font)
+{
+    if (font->lookup != NULL)
+    {
+        UnloadGlyphLookup(font->lookup);
+        font->lookup = NULL;
+    }
+
+    if ((font->glyphs == NULL) || (font->glyphCount <= 0)) return;
+
+    GlyphLookup *lookup = (GlyphLookup *)RL_CALLOC(1, sizeof(GlyphLookup));
+    lookup->latin = (int *)RL_MALLOC(256*sizeof(int));
+
+    // Get fallback glyph '?', last one if duplicated (same as unordered charset scan)
+    int hashCount = 0;
+    for (int i = 0; i < font->glyphCount; i++)
+    {
+        if (font->glyphs[i].value == 63) lookup->fallbackIndex = i;
+        if ((font->glyphs[i].value < 0) || (font->glyphs[i].value > 255)) hashCount++;
+    }
+
+    for (int i = 0; i < 256; i++) lookup->latin[i] = lookup->fallbackIndex;
+
+    // Hash table sized to keep load factor under 0.5, using linear probing
+    if (hashCount > 0)
+    {
+        lookup->hashSize = 16;
+        while (lookup->hashSize < hashCount*2) lookup->hashSize *= 2;
+
+        lookup->hash = (int *)RL_MALLOC(lookup->hashSize*2*sizeof(int));
+        for (int i = 0; i < lookup->hashSize; i++) lookup->hash[i*2] = -1;
+    }
+
+    // NOTE: Glyphs added in reverse order, first glyph is kept for duplicated codepoints
+    for (int i = font->glyphCount - 1; i >= 0; i--)
+    {
+        int codepoint = font->glyphs[i].value;
+
+        if ((codepoint >= 0) && (codepoint <= 255)) lookup->latin[codepoint] = i;
+        else if (codepoint > 255)
+        {
+            // NOTE: Codepoints come mostly in contiguous unicode blocks, mapped to hash slots without collisions
+            int slot = codepoint & (lookup->hashSize - 1);
+            while ((lookup->hash[slot*2] != -1) && (lookup->hash[slot*2] != codepoint)) slot = (slot + 1) & (lookup->hashSize - 1);
+
+            lookup->hash[slot*2] = codepoint;
+            lookup->hash[slot*2 + 1] = i;
+        }
+    }
+
+    font->lookup = lookup;
+}
+
 // Unload font glyphs info data (RAM)
 void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 {
@@ -953,6 +1031,8 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphLookup(font.lookup);
+        UnloadTextRunCache(font.glyphs);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1173,7 +1253,7 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1204,22 +1284,8 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTextGlyph(font, index, position, fontSize, tint);
 }
 
 // Draw multiple character (codepoints)
@@ -1244,7 +1310,7 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawTextGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1334,6 +1400,137 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
     return textSize;
 }
 
+//----------------------------------------------------------------------------------
+// Text runs functions (retained text layout)
+//----------------------------------------------------------------------------------
+// Load text run, text glyphs quads laid out once to be drawn multiple times
+// NOTE: Layout is the same as DrawTextEx(), font texture is referenced (not copied),
+// text run must be reloaded if font is unloaded
+TextRun LoadTextRun(Font font, const char *text, float fontSize, float spacing)
+{
+    TextRun run = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((text == NULL) || (text[0] == '\0') || !IsFontValid(font)) return run;
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    // NOTE: Allocated for all codepoints, spaces and line-breaks quads are skipped
+    int codepointCount = 0;
+    for (int i = 0; i < size; i++) if ((text[i] & 0xc0) != 0x80) codepointCount++;
+
+    run.texture = font.texture;
+    run.vertices = (float *)RL_MALLOC(codepointCount*4*2*sizeof(float));
+    run.texcoords = (float *)RL_MALLOC(codepointCount*4*2*sizeof(float));
+
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t') && (run.glyphCount < codepointCount))
+            {
+                // Glyph quad, same as DrawTextCodepoint(), vertices order: top-left, bottom-left, bottom-right, top-right
+                Rectangle rec = font.recs[index];
+                float x = textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+                float y = textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+                float width = (rec.width + 2.0f*padding)*scaleFactor;
+                float height = (rec.height + 2.0f*padding)*scaleFactor;
+
+                float u0 = (rec.x - padding)/font.texture.width;
+                float v0 = (rec.y - padding)/font.texture.height;
+                float u1 = (rec.x + rec.width + padding)/font.texture.width;
+                float v1 = (rec.y + rec.height + padding)/font.texture.height;
+
+                float *vertices = run.vertices + run.glyphCount*8;
+                float *texcoords = run.texcoords + run.glyphCount*8;
+
+                vertices[0] = x; vertices[1] = y; texcoords[0] = u0; texcoords[1] = v0;
+                vertices[2] = x; vertices[3] = y + height; texcoords[2] = u0; texcoords[3] = v1;
+                vertices[4] = x + width; vertices[5] = y + height; texcoords[4] = u1; texcoords[5] = v1;
+                vertices[6] = x + width; vertices[7] = y; texcoords[6] = u1; texcoords[7] = v0;
+
+                run.glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    run.size = MeasureTextEx(font, text, fontSize, spacing);
+
+    return run;
+}
+
+// Unload text run data (RAM)
+void UnloadTextRun(TextRun run)
+{
+    RL_FREE(run.vertices);
+    RL_FREE(run.texcoords);
+}
+
+// Draw text run, all glyphs quads submitted at once with the font texture
+void DrawTextRun(TextRun run, Vector2 position, Color tint)
+{
+    if ((run.glyphCount == 0) || (run.texture.id == 0)) return;
+
+    rlSetTexture(run.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);           // Normal vector pointing towards viewer
+
+        // NOTE: Batch limits are checked by rlVertex2f(), quads are never split
+        for (int i = 0; i < run.glyphCount*4; i++)
+        {
+            rlTexCoord2f(run.texcoords[i*2], run.texcoords[i*2 + 1]);
+            rlVertex2f(position.x + run.vertices[i*2], position.y + run.vertices[i*2 + 1]);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Draw text using font, text run cached (laid out once)
+// NOTE: Text runs cache is shared by all fonts, least recently used text run is evicted when cache is full
+void DrawTextCached(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    TextRun *run = GetTextRunCached(font, text, fontSize, spacing);
+
+    if (run != NULL) DrawTextRun(*run, position, tint);
+}
+
+// Measure string size for font, text run cached (laid out once)
+Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing)
+{
+    Vector2 textSize = { 0 };
+
+    TextRun *run = GetTextRunCached(font, text, fontSize, spacing);
+
+    if (run != NULL) textSize = run->size;
+
+    return textSize;
+}
+
 // Get index position for a unicode character on font
 // NOTE: If codepoint is not found in the font it fallbacks to '?'
 int GetGlyphIndex(Font font, int codepoint)
@@ -1341,6 +1538,34 @@ int GetGlyphIndex(Font font, int codepoint)
     int index = 0;
     if (!IsFontValid(font)) return index;
 
+    // Use glyphs lookup table if available, direct table for [0..255] codepoints, hash table for others
+    if (font.lookup != NULL)
+    {
+        if ((codepoint >= 0) && (codepoint <= 255)) index = font.lookup->latin[codepoint];
+        else
+        {
+            index = font.lookup->fallbackIndex;
+
+            if ((codepoint > 255) && (font.lookup->hashSize > 0))
+            {
+                int slot = codepoint & (font.lookup->hashSize - 1);
+
+                while (font.lookup->hash[slot*2] != -1)
+                {
+                    if (font.lookup->hash[slot*2] == codepoint)
+                    {
+                        index = font.lookup->hash[slot*2 + 1];
+                        break;
+                    }
+
+                    slot = (slot + 1) & (font.lookup->hashSize - 1);
+                }
+            }
+        }
+
+        return index;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -1388,55 +1613,268 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
 }
 
 //----------------------------------------------------------------------------------
-// Text strings management functions
+// Dynamic font functions (glyphs rasterized on demand)
 //----------------------------------------------------------------------------------
-// Get text length in bytes, check for \0 character
-unsigned int TextLength(const char *text)
+// Load dynamic font from TTF/OTF file, glyphs are rasterized on first use into atlas pages
+// NOTE: If maxPages is reached, least recently used atlas page is evicted (its glyphs rasterized again when required)
+// NOTE: Font file view is kept by font (mapped if available, not copied into memory)
+DynamicFont *LoadDynamicFont(const char *fileName, int fontSize, int pageSize, int maxPages)
 {
-    unsigned int length = 0;
+    DynamicFont *font = NULL;
 
-    if (text != NULL)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((fontSize <= 0) || (pageSize < fontSize)) return NULL;
+
+    FileView view = LoadFileView(fileName);
+
+    if (view.data != NULL)
     {
-        // NOTE: Alternative: use strlen(text)
+        font = LoadDynamicFontFromView(view, fontSize, pageSize, maxPages);
 
-        while (*text++) length++;
+        if (font != NULL) TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (%i pixel size | %ix%i atlas pages)", fileName, fontSize, pageSize, pageSize);
     }
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts require TTF fileformat support");
+#endif
 
-    return length;
+    return font;
+}
+
+// Load dynamic font from TTF/OTF memory data, data is copied and kept resident for glyphs rasterization
+DynamicFont *LoadDynamicFontFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int pageSize, int maxPages)
+{
+    DynamicFont *font = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((fileData == NULL) || (dataSize <= 0) || (fontSize <= 0) || (pageSize < fontSize)) return NULL;
+
+    // Memory data is copied into a loaded (not mapped) file view, owned by font
+    FileView view = { 0 };
+    view.data = RL_MALLOC(dataSize);
+    view.dataSize = dataSize;
+    memcpy((void *)view.data, fileData, dataSize);
+
+    font = LoadDynamicFontFromView(view, fontSize, pageSize, maxPages);
+#else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts require TTF fileformat support");
+#endif
+
+    return font;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load dynamic font from file view, view is owned by font (unloaded on failure)
+static DynamicFont *LoadDynamicFontFromView(FileView view, int fontSize, int pageSize, int maxPages)
+{
+    DynamicFont *font = (DynamicFont *)RL_CALLOC(1, sizeof(DynamicFont));
+    font->view = view;
+
+    // NOTE: stb_truetype only reads font data, mapped read-only views are valid
+    if (!stbtt_InitFont(&font->fontInfo, (unsigned char *)view.data, 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+        UnloadFileView(view);
+        RL_FREE(font);
+        return NULL;
+    }
+
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&font->fontInfo, &ascent, &descent, &lineGap);
+
+    font->baseSize = fontSize;
+    font->scaleFactor = stbtt_ScaleForPixelHeight(&font->fontInfo, (float)fontSize);
+    font->ascent = (int)((float)ascent*font->scaleFactor);
+    font->atlas = LoadTextureAtlas(pageSize, maxPages, 1);
+    font->fallbackIndex = -1;
+
+    // NOTE: Fallback glyph '?' is used for codepoints not available in font, same as static fonts
+    font->fallbackIndex = GetDynamicGlyphIndex(font, '?');
+
+    return font;
+}
+#endif
+
+// Unload dynamic font, atlas pages and font data
+void UnloadDynamicFont(DynamicFont *font)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font == NULL) return;
+
+    UnloadTextureAtlas(font->atlas);
+    UnloadFileView(font->view);
+    RL_FREE(font->glyphs);
+    RL_FREE(font->hash);
+    RL_FREE(font);
+#endif
+}
+
+// Draw text using dynamic font, missing glyphs are rasterized
+// NOTE: Render batch is drawn before a glyph is uploaded, glyphs already submitted could be evicted
+void DrawTextDynamic(DynamicFont *font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font == NULL) || (text == NULL)) return;
+
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font->baseSize;        // Character quad scaling factor
+
+    for (int i = 0; i < size;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            int index = GetDynamicGlyphIndex(font, codepoint);
+
+            if (index != -1)
+            {
+                DynamicGlyph *glyph = &font->glyphs[index];
+
+                if ((codepoint != ' ') && (codepoint != '\t') && (glyph->width > 0) && (glyph->height > 0))
+                {
+                    AtlasSprite sprite = GetTextureAtlasSprite(font->atlas, glyph->sprite);
+
+                    // NOTE: New glyphs are uploaded to atlas pages free space, glyphs already batched are not modified,
+                    // batch is only drawn by atlas if a page is evicted (page texture overwritten)
+                    if (sprite.texture.id == 0)
+                    {
+                        RasterizeDynamicGlyph(font, glyph);
+                        sprite = GetTextureAtlasSprite(font->atlas, glyph->sprite);
+                    }
+
+                    if (sprite.texture.id > 0)
+                    {
+                        Rectangle dest = { position.x + textOffsetX + glyph->offsetX*scaleFactor, position.y + textOffsetY + glyph->offsetY*scaleFactor,
+                                           glyph->width*scaleFactor, glyph->height*scaleFactor };
+
+                        DrawTexturePro(sprite.texture, sprite.source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+                    }
+                }
+
+                if (glyph->advanceX == 0) textOffsetX += ((float)glyph->width*scaleFactor + spacing);
+                else textOffsetX += ((float)glyph->advanceX*scaleFactor + spacing);
+            }
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+#endif
 }
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
+// Measure string size for dynamic font, glyphs are not rasterized (only metrics required)
+Vector2 MeasureTextDynamic(DynamicFont *font, const char *text, float fontSize, float spacing)
 {
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
+    Vector2 textSize = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if ((font == NULL) || (text == NULL) || (text[0] == '\0')) return textSize; // Security check
+
+    int size = TextLength(text);    // Get size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = fontSize;
+    float scaleFactor = fontSize/(float)font->baseSize;
+
+    // NOTE: Measured same as MeasureTextEx()
+    for (int i = 0; i < size;)
+    {
+        byteCounter++;
+
+        int codepointByteCount = 0;
+        int letter = GetCodepointNext(&text[i], &codepointByteCount);
+
+        i += codepointByteCount;
+
+        if (letter != '\n')
+        {
+            int index = GetDynamicGlyphIndex(font, letter);
+
+            if (index != -1)
+            {
+                if (font->glyphs[index].advanceX > 0) textWidth += font->glyphs[index].advanceX;
+                else textWidth += (font->glyphs[index].width + font->glyphs[index].offsetX);
+            }
+        }
+        else
+        {
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            byteCounter = 0;
+            textWidth = 0;
+
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textHeight += (fontSize + textLineSpacing);
+        }
+
+        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    textSize.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
+    textSize.y = textHeight;
 #endif
 
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    return textSize;
+}
+
+// Get dynamic font glyphs atlas, useful to check atlas pages
+TextureAtlas *GetDynamicFontAtlas(DynamicFont *font)
+{
+    TextureAtlas *atlas = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font != NULL) atlas = font->atlas;
+#endif
 
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
+    return atlas;
+}
 
-    va_list args;
-    va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-    va_end(args);
+// Get dynamic font glyphs count, resident in atlas pages (rasterized and not evicted)
+int GetDynamicFontGlyphCount(DynamicFont *font)
+{
+    int count = 0;
 
-    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
-    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font != NULL)
     {
-        // Inserting "..." at the end of the string to mark as truncated
-        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-        sprintf(truncBuffer, "...");
+        for (int i = 0; i < font->glyphCount; i++) if (IsTextureAtlasSpriteValid(font->atlas, font->glyphs[i].sprite)) count++;
     }
+#endif
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Get text length in bytes, check for \0 character
+unsigned int TextLength(const char *text)
+{
+    unsigned int length = 0;
+
+    if (text != NULL)
+    {
+        // NOTE: Alternative: use strlen(text)
 
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+        while (*text++) length++;
+    }
 
-    return currentBuffer;
+    return length;
 }
 
 // Get integer value from text
@@ -2136,6 +2574,286 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Unload glyphs lookup table
+static void UnloadGlyphLookup(GlyphLookup *lookup)
+{
+    if (lookup != NULL)
+    {
+        RL_FREE(lookup->latin);
+        RL_FREE(lookup->hash);
+        RL_FREE(lookup);
+    }
+}
+
+// Draw one glyph (font glyph index)
+static void DrawTextGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // Character destination rectangle on screen
+    // NOTE: We consider glyphPadding on drawing
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    // Draw the character texture on the screen
+    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+// Get text run from cache, text run is laid out and cached if not found
+// NOTE: Returned text run is owned by cache, valid until next cache access
+static TextRun *GetTextRunCached(Font font, const char *text, float fontSize, float spacing)
+{
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if ((text == NULL) || (text[0] == '\0') || !IsFontValid(font)) return NULL;
+
+    // Get text hash (FNV-1a), compared before full text comparison
+    unsigned int hash = 2166136261u;
+    int length = 0;
+    for (; text[length] != '\0'; length++) hash = (hash ^ (unsigned char)text[length])*16777619u;
+
+    // Look for cached text run, free entry or least recently used entry is selected for replacement
+    int slot = 0;
+
+    for (int i = 0; i < MAX_TEXT_RUN_CACHE; i++)
+    {
+        TextRunCacheEntry *entry = &textRunCache[i];
+
+        if ((entry->text != NULL) && (entry->hash == hash) && (entry->glyphs == font.glyphs) && (entry->textureId == font.texture.id) &&
+            (entry->fontSize == fontSize) && (entry->spacing == spacing) && (entry->lineSpacing == textLineSpacing) && (strcmp(entry->text, text) == 0))
+        {
+            entry->lastUse = ++textRunCacheUseMark;
+            return &entry->run;
+        }
+
+        if ((textRunCache[slot].text != NULL) && ((entry->text == NULL) || (entry->lastUse < textRunCache[slot].lastUse))) slot = i;
+    }
+
+    TextRunCacheEntry *entry = &textRunCache[slot];
+
+    if (entry->text != NULL)
+    {
+        RL_FREE(entry->text);
+        UnloadTextRun(entry->run);
+    }
+
+    entry->hash = hash;
+    entry->text = (char *)RL_MALLOC(length + 1);
+    memcpy(entry->text, text, length + 1);
+    entry->glyphs = font.glyphs;
+    entry->textureId = font.texture.id;
+    entry->fontSize = fontSize;
+    entry->spacing = spacing;
+    entry->lineSpacing = textLineSpacing;
+    entry->lastUse = ++textRunCacheUseMark;
+    entry->run = LoadTextRun(font, text, fontSize, spacing);
+
+    return &entry->run;
+}
+
+// Unload cached text runs for a font (glyphs), all text runs unloaded if NULL
+static void UnloadTextRunCache(const GlyphInfo *glyphs)
+{
+    for (int i = 0; i < MAX_TEXT_RUN_CACHE; i++)
+    {
+        if ((textRunCache[i].text != NULL) && ((glyphs == NULL) || (textRunCache[i].glyphs == glyphs)))
+        {
+            RL_FREE(textRunCache[i].text);
+            UnloadTextRun(textRunCache[i].run);
+            textRunCache[i] = (TextRunCacheEntry){ 0 };
+        }
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Get dynamic font glyph index for a codepoint, glyph metrics are loaded on first request (not rasterized)
+// NOTE: Codepoints not available in font return fallback glyph '?' index (-1 if not available)
+static int GetDynamicGlyphIndex(DynamicFont *font, int codepoint)
+{
+    // Look for glyph in hash table (open addressing, linear probing)
+    if (font->hashSize > 0)
+    {
+        int slot = codepoint & (font->hashSize - 1);
+
+        while (font->hash[slot*2] != -1)
+        {
+            if (font->hash[slot*2] == codepoint) return font->hash[slot*2 + 1];
+            slot = (slot + 1) & (font->hashSize - 1);
+        }
+    }
+
+    int glyphIndex = stbtt_FindGlyphIndex(&font->fontInfo, codepoint);
+    if (glyphIndex == 0) return font->fallbackIndex;
+
+    // Add new glyph with metrics, rasterized on first draw
+    if (font->glyphCount >= font->glyphCapacity)
+    {
+        font->glyphCapacity = (font->glyphCapacity > 0)? font->glyphCapacity*2 : 256;
+        font->glyphs = (DynamicGlyph *)RL_REALLOC(font->glyphs, font->glyphCapacity*sizeof(DynamicGlyph));
+    }
+
+    DynamicGlyph *glyph = &font->glyphs[font->glyphCount];
+    glyph->value = codepoint;
+    glyph->glyphIndex = glyphIndex;
+    glyph->sprite = -1;
+
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetGlyphBitmapBox(&font->fontInfo, glyphIndex, font->scaleFactor, font->scaleFactor, &x0, &y0, &x1, &y1);
+    glyph->offsetX = x0;
+    glyph->offsetY = y0 + font->ascent;
+    glyph->width = x1 - x0;
+    glyph->height = y1 - y0;
+
+    stbtt_GetGlyphHMetrics(&font->fontInfo, glyphIndex, &glyph->advanceX, NULL);
+    glyph->advanceX = (int)((float)glyph->advanceX*font->scaleFactor);
+
+    // Grow hash table to keep load factor under 0.5, glyphs are rehashed
+    if ((font->glyphCount + 1)*2 > font->hashSize)
+    {
+        font->hashSize = (font->hashSize > 0)? font->hashSize*2 : 512;
+        font->hash = (int *)RL_REALLOC(font->hash, font->hashSize*2*sizeof(int));
+        for (int i = 0; i < font->hashSize; i++) font->hash[i*2] = -1;
+
+        for (int i = 0; i < font->glyphCount; i++)
+        {
+            int slot = font->glyphs[i].value & (font->hashSize - 1);
+            while (font->hash[slot*2] != -1) slot = (slot + 1) & (font->hashSize - 1);
+
+            font->hash[slot*2] = font->glyphs[i].value;
+            font->hash[slot*2 + 1] = i;
+        }
+    }
+
+    int slot = codepoint & (font->hashSize - 1);
+    while (font->hash[slot*2] != -1) slot = (slot + 1) & (font->hashSize - 1);
+
+    font->hash[slot*2] = codepoint;
+    font->hash[slot*2 + 1] = font->glyphCount;
+
+    return font->glyphCount++;
+}
+
+// Rasterize dynamic font glyph into atlas pages
+// NOTE: Glyph coverage is stored in alpha channel (white glyphs), same as static fonts atlas
+static void RasterizeDynamicGlyph(DynamicFont *font, DynamicGlyph *glyph)
+{
+    Image image = { 0 };
+    image.width = glyph->width;
+    image.height = glyph->height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.data = RL_MALLOC(glyph->width*glyph->height*4);
+
+    unsigned char *coverage = (unsigned char *)RL_MALLOC(glyph->width*glyph->height);
+    stbtt_MakeGlyphBitmap(&font->fontInfo, coverage, glyph->width, glyph->height, glyph->width, font->scaleFactor, font->scaleFactor, glyph->glyphIndex);
+
+    for (int i = 0; i < glyph->width*glyph->height; i++)
+    {
+        ((unsigned char *)image.data)[i*4] = 255;
+        ((unsigned char *)image.data)[i*4 + 1] = 255;
+        ((unsigned char *)image.data)[i*4 + 2] = 255;
+        ((unsigned char *)image.data)[i*4 + 3] = coverage[i];
+    }
+
+    glyph->sprite = AddTextureAtlasImage(font->atlas, image);
+
+    RL_FREE(coverage);
+    UnloadImage(image);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load a range of font glyphs (metrics and image), rasterized as bitmap or SDF
+// NOTE: Font info is only read, glyphs ranges are safely loaded in parallel
+static void LoadFontGlyphs(void *userData, int start, int end)
+{
+    const FontGlyphsJob *job = (const FontGlyphsJob *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->codepoints[i];  // Character value to get info for
+        GlyphInfo *glyph = &job->glyphs[i];
+        glyph->value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        // Check if a glyph is available in the font
+        // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+        int index = stbtt_FindGlyphIndex(job->fontInfo, ch);
+
+        if (index > 0)
+        {
+            switch (job->type)
+            {
+                case FONT_DEFAULT:
+                case FONT_BITMAP: glyph->image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                case FONT_SDF: if (ch != 32) glyph->image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+                default: break;
+            }
+
+            if (glyph->image.data != NULL)    // Glyph data has been found in the font
+            {
+                stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+                if (chh > job->fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+
+                // Load characters images
+                glyph->image.width = chw;
+                glyph->image.height = chh;
+                glyph->image.mipmaps = 1;
+                glyph->image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+                glyph->offsetY += (int)((float)job->ascent*job->scaleFactor);
+            }
+
+            // NOTE: We create an empty image for space character,
+            // it could be further required for atlas packing
+            if (ch == 32)
+            {
+                stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+                glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+                Image imSpace = {
+                    .data = RL_CALLOC(glyph->advanceX*job->fontSize, 2),
+                    .width = glyph->advanceX,
+                    .height = job->fontSize,
+                    .mipmaps = 1,
+                    .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                glyph->image = imSpace;
+            }
+
+            if (job->type == FONT_BITMAP)
+            {
+                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+                // NOTE: For optimum results, bitmap font should be generated at base pixel size
+                for (int p = 0; p < chw*chh; p++)
+                {
+                    if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+                    else ((unsigned char *)glyph->image.data)[p] = 255;
+                }
+            }
+        }
+        else
+        {
+            // TODO: Use some fallback glyph for codepoints not found in the font
+        }
+    }
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2307,6 +3025,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    GenFontGlyphLookup(&font);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         UnloadFont(font);
@@ -34,10 +34,15 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_IMAGE_COMPRESSION
+*           Support GPU compressed formats (DXT1/DXT3/DXT5, ETC1/ETC2/EAC) encoding and decoding on CPU [ImageFormat()],
+*           compressed images loading cached into KTX files [LoadImageCompressed()]
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
 *       stb_image_resize - Multiple image resize algorithms
+*       stb_rect_pack    - Rectangles packing algorithms, required for texture atlas (and rtext font atlas generation)
 *
 *
 *   LICENSE: zlib/libpng
@@ -78,6 +83,15 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+// SIMD instructions set used on image processing kernels [ImageBlurGaussian(), ImageKernelConvolution(), ImageColorTint()]
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>       // Required for: float32x4_t, uint8x16_t, vmlaq_n_f32(), vmull_u8()...
+    #define IMAGE_SIMD_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>      // Required for: __m128, __m128i, _mm_mul_ps(), _mm_mullo_epi16()...
+    #define IMAGE_SIMD_SSE
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -122,6 +136,10 @@
 #if defined(SUPPORT_FILEFORMAT_ASTC)
     #define RL_GPUTEX_SUPPORT_ASTC
 #endif
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    #define RL_GPUTEX_SUPPORT_KTX           // Required for compressed images cache files
+    #define RL_GPUTEX_SUPPORT_COMPRESSION
+#endif
 
 // Image fileformats not supported by default
 #if defined(__TINYC__)
@@ -162,7 +180,8 @@
      defined(SUPPORT_FILEFORMAT_PKM) || \
      defined(SUPPORT_FILEFORMAT_KTX) || \
      defined(SUPPORT_FILEFORMAT_PVR) || \
-     defined(SUPPORT_FILEFORMAT_ASTC))
+     defined(SUPPORT_FILEFORMAT_ASTC) || \
+     defined(SUPPORT_IMAGE_COMPRESSION))
 
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic push
@@ -170,7 +189,7 @@
     #endif
 
     #define RL_GPUTEX_IMPLEMENTATION
-    #include "external/rl_gputex.h"         // Required for: rl_load_xxx_from_memory()
+    #include "external/rl_gputex.h"         // Required for: rl_load_xxx_from_memory(), rl_compress_block(), rl_decompress_block()
                                             // NOTE: Used to read compressed textures data (multiple formats support)
 
     #if defined(__GNUC__) // GCC and Clang
@@ -221,6 +240,10 @@
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize2.h"     // Required for: stbir_resize_uint8_linear() [ImageResize()]
 
+// NOTE: stb_rect_pack is also required by rtext module, for font atlas generation
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"         // Required for: stbrp_pack_rects() [AddTextureAtlasImages(), GenImageFontAtlas()]
+
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic pop
 #endif
@@ -236,15 +259,167 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_ROWS_RANGE
+    #define IMAGE_ROWS_RANGE         32    // Minimum image rows per range on multi-threaded image processing
+#endif
+
+#ifndef MIPMAP_KAISER_RADIUS
+    #define MIPMAP_KAISER_RADIUS   2.0f    // Kaiser mipmap filter radius (in mipmap level pixels)
+#endif
+#ifndef MIPMAP_KAISER_ALPHA
+    #define MIPMAP_KAISER_ALPHA    4.0f    // Kaiser mipmap filter window shape (higher values, smoother filter)
+#endif
+
+#ifndef TEXTURE_LOADER_MAX_DECODING
+    #define TEXTURE_LOADER_MAX_DECODING  8 // Maximum textures decoding or waiting upload per texture loader (limits decoded images memory)
+#endif
+
+// Texture atlas sprite handle: sprite slot index (low bits) and slot generation (high bits)
+// NOTE: Evicted sprites slots are reused, generation is incremented so previous handles are not valid
+#define ATLAS_SPRITE_INDEX_BITS     20
+#define ATLAS_SPRITE_MAX_SLOTS      (1 << ATLAS_SPRITE_INDEX_BITS)
+#define ATLAS_SPRITE_HANDLE(index, generation) ((((generation) & 0x7ff) << ATLAS_SPRITE_INDEX_BITS) | (index))
+#define ATLAS_SPRITE_INDEX(sprite)  ((sprite) & (ATLAS_SPRITE_MAX_SLOTS - 1))
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Texture atlas page, images packed with skyline algorithm (stb_rect_pack)
+typedef struct AtlasPage {
+    Texture2D texture;          // Page texture (RGBA)
+    stbrp_context *context;     // Page rectangles packing context, keeps page free space (not moved, it points to itself)
+    stbrp_node *nodes;          // Page rectangles packing nodes (page width)
+    unsigned int lastUse;       // Page last use mark, for least recently used page eviction
+} AtlasPage;
+
+// Texture atlas sprite entry
+typedef struct AtlasSpriteEntry {
+    int page;                   // Sprite page index (-1 for evicted sprites)
+    Rectangle source;           // Sprite rectangle in page texture
+    int generation;             // Sprite slot generation, incremented on eviction (previous handles not valid)
+    int nextFree;               // Next free sprite slot (evicted sprites), -1 for last one
+} AtlasSpriteEntry;
+
+// Texture atlas, sprites packed into pages at runtime
+// NOTE: Evicted sprites slots are added to a free list and reused by new sprites, handles store slot index
+// and slot generation [ATLAS_SPRITE_HANDLE()], handles are only valid while generation matches the slot one
+// WARNING: Handle generation is 11-bit, it wraps after 2048 evictions of the same slot and a stale handle
+// could be considered valid again, sprites handles should not be kept after their page eviction
+struct TextureAtlas {
+    int pageSize;               // Atlas pages size (width and height)
+    int maxPages;               // Atlas max pages, least recently used page is evicted if reached (0: unlimited)
+    int padding;                // Sprites padding, filled with sprites border pixels (extruded)
+
+    AtlasPage *pages;           // Atlas pages
+    int pageCount;              // Atlas pages count
+
+    AtlasSpriteEntry *sprites;  // Atlas sprites slots
+    int spriteCount;            // Atlas sprites slots count (including free ones)
+    int spriteCapacity;         // Atlas sprites slots allocated
+    int freeSprite;             // First free sprite slot (evicted sprites, reused first), -1 if none
+    int freeCount;              // Free sprite slots count
+
+    unsigned int useMark;       // Current use mark, incremented on every page use
+};
+
+// Texture loader request, image file decoded on a worker thread (or main thread if no worker threads available)
+typedef struct TextureRequest {
+    char *fileName;             // Image file name (copy)
+    int format;                 // Pixel format requested (0: keep file format)
+    bool mipmaps;               // Mipmaps requested
+    Image image;                // Decoded image, written by decoding thread
+    double decodeEnd;           // Decoding end time, written by decoding thread
+    WorkerTask *task;           // Worker task decoding the image, NULL if not queued on a worker thread
+} TextureRequest;
+
+// Texture loader entry
+typedef struct TextureLoaderEntry {
+    int state;                  // Texture load state (TextureLoadState)
+    Texture2D texture;          // Texture, once uploaded
+    TextureRequest *request;    // Texture request, until texture is uploaded
+} TextureLoaderEntry;
+
+// Texture loader, image files decoded on worker threads, textures uploaded on main thread
+// NOTE: Textures handles are never reused, textures are owned by the loader
+struct TextureLoader {
+    TextureLoaderEntry *textures; // Loader textures
+    int textureCount;           // Loader textures count
+    int textureCapacity;        // Loader textures allocated
+    int loadedCount;            // Loader textures loaded (ready or failed)
+
+    int firstPending;           // First texture possibly pending, textures before it are loaded
+    int nextDecode;             // Next texture to be decoded
+    int decoding;               // Textures queued on worker threads, decoding or waiting upload
+    bool mainDecoding;          // Images decoded on main thread by UpdateTextureLoader() (no worker threads available)
+
+    double startTime;           // Loading start time, first texture added with no textures pending
+    double decodeEnd;           // Last image decoding end time
+    double decodedSize;         // Image data decoded since loading start (bytes)
+    double uploadedSize;        // Image data uploaded (bytes)
+    double uploadTotalTime;     // Upload time accumulated (seconds)
+    int uploaded;               // Textures uploaded on last update
+    float uploadTime;           // Upload time on last update (ms)
+};
+
+// Image processing job, image rows processed by ranges over worker threads
+// NOTE: Image data is read and written in its own pixel format, R8G8B8A8 rows in place,
+// other formats converted row by row (same conversion as LoadImageColors() and ImageFormat())
+typedef struct ImageRowsJob {
+    Image image;                // Image processed
+    const Color *source;        // Source pixels (RGBA), for kernels reading neighbour pixels
+    Color *output;              // Output pixels (RGBA), NULL to write image data
+    const unsigned short *sourceValues; // Source pixels (RGBA 8.8 fixed point) [ImageBlurGaussian()]
+    unsigned short *outputValues;       // Output pixels (RGBA 8.8 fixed point) [ImageBlurGaussian()]
+    int blurSize;               // Box blur size [ImageBlurGaussian()]
+    const float *kernel;        // Convolution kernel [ImageKernelConvolution()]
+    int kernelWidth;            // Convolution kernel width (square kernel)
+    Color color;                // Tint color [ImageColorTint()]
+    const unsigned char *table; // Color channels lookup table [ImageColorContrast()]
+} ImageRowsJob;
+
+// Image mipmap job, mipmap level rows filtered from previous level by ranges over worker threads
+// NOTE: Pixels are filtered as floats with a separable kernel, levels read and written in image format
+typedef struct ImageMipmapJob {
+    Image source;               // Previous mipmap level
+    Image level;                // Mipmap level generated
+    int channels;               // Channels per pixel filtered (packed 16 bit formats filtered as RGBA)
+    int alpha;                  // Alpha channel, not gamma corrected (-1 if not available)
+    int columnTaps;             // Kernel taps per level column
+    const int *columns;         // Source columns per level column kernel taps (clamped to source)
+    const float *columnWeights; // Kernel weights per level column taps
+    int rowTaps;                // Kernel taps per level row
+    const int *rows;            // Source rows per level row kernel taps (clamped to source)
+    const float *rowWeights;    // Kernel weights per level row taps
+    const float *linearTable;   // sRGB 8 bit channel values to linear values [0..255]
+    const unsigned char *srgbTable; // Linear values (4096 steps) to sRGB 8 bit channel values, NULL if not gamma-correct
+} ImageMipmapJob;
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// Image blocks job, image level 4x4 pixels blocks rows compressed or decompressed by ranges over worker threads
+typedef struct ImageBlocksJob {
+    unsigned char *pixels;      // Image level pixels (R8G8B8A8)
+    unsigned char *blocks;      // Image level compressed blocks
+    int width;                  // Image level width
+    int height;                 // Image level height
+    int format;                 // Compressed pixel format
+} ImageBlocksJob;
+#endif
+
+// Pixel vector, RGBA channels as floats (SIMD register if available)
+#if defined(IMAGE_SIMD_SSE)
+typedef __m128 PixelVector;
+#elif defined(IMAGE_SIMD_NEON)
+typedef float32x4_t PixelVector;
+#else
+typedef struct PixelVector { float v[4]; } PixelVector;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+static char compressedCachePath[256] = { 0 };   // Compressed images KTX cache directory [LoadImageCompressed()], working directory if empty
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -257,6 +432,56 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void GetImageColors(Image image, int offset, int count, Color *colors);         // Get image pixels colors, same conversion as LoadImageColors()
+static void SetImageColors(Image image, int offset, int count, const Color *colors);   // Set image pixels colors, same conversion as ImageFormat()
+static void SetImageRows(void *userData, int start, int end);             // Set image rows range from source pixels
+static void ResizeImageSplits(void *userData, int start, int end);        // Resize image splits range (stb_image_resize2)
+static void ResizeImageData(const void *input, int width, int height, void *output, int newWidth, int newHeight, int channels, int type); // Resize image data, split over worker threads
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static PixelVector LoadPixelVector(Color color);                            // Load pixel vector from color (RGBA channels as floats)
+static Color StorePixelVector(PixelVector vector);                          // Store pixel vector into color, channels clamped to [0..255] and truncated
+static PixelVector LoadPixelVectorFloats(const float *values);              // Load pixel vector from floats (RGBA)
+static void StorePixelVectorFloats(float *values, PixelVector vector);      // Store pixel vector into floats (RGBA)
+static PixelVector LoadPixelVectorShorts(const unsigned short *values);     // Load pixel vector from unsigned shorts (RGBA)
+static void StorePixelVectorShorts(unsigned short *values, PixelVector vector); // Store pixel vector into unsigned shorts (RGBA), clamped to [0..65535] and rounded
+static PixelVector ZeroPixelVector(void);                                   // Get zero pixel vector
+static PixelVector AddPixelVectors(PixelVector v1, PixelVector v2);         // Add pixel vectors
+static PixelVector SubtractPixelVectors(PixelVector v1, PixelVector v2);    // Subtract pixel vectors
+static PixelVector ScalePixelVector(PixelVector v, float scale);            // Scale pixel vector
+static PixelVector ScaleAddPixelVector(PixelVector sum, PixelVector v, float scale); // Scale pixel vector and add it to sum vector (sum + v*scale)
+static void BlurImageRow(const unsigned short *values, int width, int blurSize, unsigned short *output); // Box blur pixels row (horizontal), RGBA 8.8 fixed point values
+static void TintImageRow(Color *pixels, int count, Color tint);             // Tint pixels row
+
+static void PremultiplyImageRows(void *userData, int start, int end);      // Premultiply alpha of image rows range into output values (8.8 fixed point)
+static void UnpremultiplyImageRows(void *userData, int start, int end);    // Reverse premultiplied alpha of source values rows range into image
+static void BlurImageRows(void *userData, int start, int end);            // Box blur source values rows range into output values (8.8 fixed point)
+static void ConvolveImageRows(void *userData, int start, int end);        // Apply convolution kernel to source pixels rows range
+static void TintImageRows(void *userData, int start, int end);            // Tint image rows range
+static void TableImageRows(void *userData, int start, int end);           // Map image rows range color channels with lookup table
+
+static float GetBesselI0(float x);                                          // Get modified Bessel function of first kind, order 0 (Kaiser window)
+static int GetMipmapKernelTaps(int size, int newSize, int filter);          // Get mipmap kernel taps per level pixel
+static void SetMipmapKernel(int size, int newSize, int filter, int taps, int *indices, float *weights); // Set mipmap kernel source indices and weights per level pixel
+static void LoadMipmapRow(const ImageMipmapJob *job, int y, Color *colors, float *values);  // Load source level row as floats (channels per pixel)
+static void StoreMipmapRow(const ImageMipmapJob *job, int y, Color *colors, const float *values); // Store floats into mipmap level row
+static void GenerateMipmapRows(void *userData, int start, int end);        // Generate mipmap level rows range from previous level
+#endif
+
+static int AddTextureAtlasPage(TextureAtlas *atlas, unsigned int useMark);  // Add a new page to texture atlas (or evict least recently used one)
+static int PackTextureAtlasPage(TextureAtlas *atlas, int page, const Image *images, stbrp_rect *rects, int count, int *sprites); // Pack images into texture atlas page
+static void UploadTextureAtlasSprite(TextureAtlas *atlas, int page, Image image, int x, int y); // Upload image into texture atlas page, padding extruded
+
+static void DecodeTextureRequest(void *userData);                           // Decode texture request image file (worker task)
+static void QueueTextureLoaderDecoding(TextureLoader *loader);              // Queue textures decoding on worker threads, up to TEXTURE_LOADER_MAX_DECODING
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+static bool IsBlockCompressedFormat(int format);                           // Check if pixel format is compressed by 4x4 blocks, encoded and decoded on CPU
+static void CompressImageData(Image *image, int format);                   // Compress image data (R8G8B8A8, including mipmaps) into compressed format
+static void DecompressImageData(Image *image);                             // Decompress image data (including mipmaps) into R8G8B8A8
+static void CompressImageBlockRows(void *userData, int start, int end);    // Compress image level blocks rows range
+static void DecompressImageBlockRows(void *userData, int start, int end);  // Decompress image level blocks rows range
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -280,16 +505,15 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file view, file data mapped into memory if available (not copied)
+    FileView view = LoadFileView(fileName);
 
     // Loading image from memory data
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
-        image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        image = LoadImageFromMemory(GetFileExtension(fileName), view.data, view.dataSize);
 
-        UnloadFileData(fileData);
+        UnloadFileView(view);
     }
 
     return image;
@@ -300,18 +524,17 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView view = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (view.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = view.data;
         int size = GetPixelDataSize(width, height, format);
 
-        if (size <= dataSize)   // Security check
+        if (size <= view.dataSize)   // Security check
         {
             // Offset file data to expected raw image by header size
-            if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
+            if ((headerSize > 0) && ((headerSize + size) <= view.dataSize)) dataPtr += headerSize;
 
             image.data = RL_MALLOC(size);      // Allocate required memory in bytes
             memcpy(image.data, dataPtr, size); // Copy required data to image
@@ -321,7 +544,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             image.format = format;
         }
 
-        UnloadFileData(fileData);
+        UnloadFileView(view);
     }
 
     return image;
@@ -340,19 +563,18 @@ Image LoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (IsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        FileView view = LoadFileView(fileName);
 
-        if (fileData != NULL)
+        if (view.data != NULL)
         {
             int comp = 0;
             int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            image.data = stbi_load_gif_from_memory(view.data, view.dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            UnloadFileData(fileData);
+            UnloadFileView(view);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
     }
@@ -599,6 +821,119 @@ Image LoadImageFromScreen(void)
     return image;
 }
 
+// Load image from file compressed into GPU format (DXT1/DXT3/DXT5, ETC1/ETC2/EAC), mipmaps generated if requested
+// NOTE: Compressed image is cached into a KTX file in cache directory [SetImageCompressedCachePath()],
+// cache is loaded while not older than source file, cache file name includes source path and size hash
+// NOTE: Cache file is written to a temporary file and renamed into place, cache is never read partially written
+// WARNING: Thread-safe, it can be called from worker threads (compression runs serially there)
+Image LoadImageCompressed(const char *fileName, int format, bool mipmaps)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    if (IsBlockCompressedFormat(format))
+    {
+        const char *formatNames[7] = { "dxt1", "dxt1a", "dxt3", "dxt5", "etc1", "etc2", "etc2a" };
+        int sourceSize = GetFileLength(fileName);
+
+        // Cache file name hash (FNV-1a): source file path, size and mipmaps
+        unsigned int hash = 2166136261u;
+        for (const char *c = fileName; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+        hash = (hash ^ (unsigned int)sourceSize)*16777619u;
+        hash = (hash ^ (mipmaps? 1u : 0u))*16777619u;
+
+        // NOTE: File name without extension is not retrieved with GetFileNameWithoutExt(), not thread-safe (static buffer)
+        const char *name = GetFileName(fileName);
+        const char *extension = strrchr(name, '.');
+        int nameLength = (extension != NULL)? (int)(extension - name) : (int)strlen(name);
+        if (nameLength > 128) nameLength = 128;
+
+        // NOTE: Empty cache path refers to working directory (app internal storage on Android)
+        char cacheFileName[448] = { 0 };
+        snprintf(cacheFileName, 448, "%s%s%.*s_%08x.%s.ktx", compressedCachePath, (compressedCachePath[0] != '\0')? "/" : "",
+            nameLength, name, hash, formatNames[format - PIXELFORMAT_COMPRESSED_DXT1_RGB]);
+
+        // Load cached image, if not older than source file
+        // NOTE: Files modification time is not available for Android assets, cache is always loaded
+        if ((GetFileLength(cacheFileName) > 0) && (GetFileModTime(cacheFileName) >= GetFileModTime(fileName)))
+        {
+            FileView view = LoadFileView(cacheFileName);
+
+            if (view.data != NULL)
+            {
+                image.data = rl_load_ktx_from_memory(view.data, view.dataSize, &image.width, &image.height, &image.format, &image.mipmaps);
+                UnloadFileView(view);
+            }
+
+            if ((image.data != NULL) && ((image.format != format) || (mipmaps && (image.mipmaps == 1))))
+            {
+                UnloadImage(image);
+                image = (Image){ 0 };
+            }
+
+            if (image.data != NULL) TRACELOG(LOG_INFO, "IMAGE: [%s] Compressed image loaded from cache: %s", fileName, cacheFileName);
+        }
+
+        // Compress image and cache it, if cache not valid
+        if (image.data == NULL)
+        {
+            image = LoadImage(fileName);
+
+            if (image.data != NULL)
+            {
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (mipmaps && (image.mipmaps == 1)) ImageMipmaps(&image);
+            #endif
+                ImageFormat(&image, format);
+
+                if (image.format == format)
+                {
+                    // Temporary file name unique per loading thread, stack address used as thread id
+                    char tempFileName[464] = { 0 };
+                    snprintf(tempFileName, 464, "%s.%08x.tmp", cacheFileName, (unsigned int)(size_t)tempFileName);
+
+                    if (rl_save_ktx(tempFileName, image.data, image.width, image.height, image.format, image.mipmaps) &&
+                        RenameFile(tempFileName, cacheFileName))
+                    {
+                        TRACELOG(LOG_INFO, "IMAGE: [%s] Compressed image cached: %s", fileName, cacheFileName);
+                    }
+                    else
+                    {
+                        remove(tempFileName);
+                        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to cache compressed image: %s", fileName, cacheFileName);
+                    }
+                }
+            }
+        }
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: [%s] Compressed format not supported for encoding (%i)", fileName, format);
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: LoadImageCompressed() requires SUPPORT_IMAGE_COMPRESSION");
+#endif
+
+    return image;
+}
+
+// Set compressed images KTX cache directory, NULL or empty sets working directory
+// WARNING: Directory must exist, to be set before compressed images loading (not synchronized with worker threads)
+void SetImageCompressedCachePath(const char *path)
+{
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    if ((path != NULL) && (path[0] != '\0'))
+    {
+        int length = (int)strlen(path);
+        if (length > 255) length = 255;
+        while ((length > 1) && ((path[length - 1] == '/') || (path[length - 1] == '\\'))) length--;   // Trailing separator removed
+
+        memcpy(compressedCachePath, path, length);
+        compressedCachePath[length] = '\0';
+    }
+    else compressedCachePath[0] = '\0';
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: SetImageCompressedCachePath() requires SUPPORT_IMAGE_COMPRESSION");
+#endif
+}
+
 // Check if an image is ready
 bool IsImageValid(Image image)
 {
@@ -1259,6 +1594,20 @@ void ImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+        // GPU compressed formats (DXT1/DXT3/DXT5, ETC1/ETC2/EAC) encoded and decoded by 4x4 pixels blocks,
+        // converted from/to R8G8B8A8, including mipmaps
+        if (IsBlockCompressedFormat(image->format)) DecompressImageData(image);
+
+        if (IsBlockCompressedFormat(newFormat))
+        {
+            if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) CompressImageData(image, newFormat);
+            return;
+        }
+
+        if (image->format == newFormat) return;
+#endif
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
@@ -1756,51 +2105,60 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    // Check if image data can be resized in its own format
+    // It can be for 8 bit, 16 bit (half float) and 32 bit (float) per channel images with 1 to 4 channels per pixel
+    int channels = 0;
+    stbir_datatype type = STBIR_TYPE_UINT8;
+
+    switch (image->format)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: channels = 1; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: channels = 3; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: channels = 4; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: channels = 1; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: channels = 3; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: channels = 4; type = STBIR_TYPE_HALF_FLOAT; break;
+        default: break;
+    }
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+    if (channels > 0)
+    {
+        void *output = RL_MALLOC(GetPixelDataSize(newWidth, newHeight, image->format));
+
+        ResizeImageData(image->data, image->width, image->height, output, newWidth, newHeight, channels, type);
 
         RL_FREE(image->data);
         image->data = output;
         image->width = newWidth;
         image->height = newHeight;
     }
-    else
+    else if (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        // Get data as Color pixels array to work with it
+        // Packed 16 bit formats are resized as RGBA pixels, converted back to image format by rows ranges
         Color *pixels = LoadImageColors(*image);
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
-        // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
-
-        int format = image->format;
+        ResizeImageData(pixels, image->width, image->height, output, newWidth, newHeight, 4, STBIR_TYPE_UINT8);
 
         UnloadImageColors(pixels);
         RL_FREE(image->data);
 
-        image->data = output;
+        image->data = RL_MALLOC(GetPixelDataSize(newWidth, newHeight, image->format));
         image->width = newWidth;
         image->height = newHeight;
-        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-        ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        ImageRowsJob job = { 0 };
+        job.image = *image;
+        job.source = output;
+        RunWorkerJobs(SetImageRows, &job, newHeight, IMAGE_ROWS_RANGE);
+
+        RL_FREE(output);
     }
+    else TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
 }
 
 // Resize canvas and fill with color
@@ -2094,144 +2452,48 @@ void ImageAlphaPremultiply(Image *image)
 void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    ImageAlphaPremultiply(image);
-
-    Color *pixels = LoadImageColors(*image);
-
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (blurSize < 1)) return;
 
-    for (int i = 0; i < (image->height*image->width); i++)
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
     }
 
-    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+    // Pixels are premultiplied and blurred as RGBA 8.8 fixed point values, switching between two buffers on every pass
+    // NOTE: Rows are processed by ranges over worker threads, every pass reads one buffer and writes the other one,
+    // passes round to 1/256 steps, channels are quantized to 8 bits only once, on reverse premultiply
+    unsigned short *values = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+    unsigned short *valuesCopy = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+    ImageRowsJob job = { 0 };
+    job.image = *image;
+    job.blurSize = blurSize;
+    job.outputValues = values;
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+    RunWorkerJobs(PremultiplyImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
+    // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    // NOTE: Rows ranges are at least twice the blur size, limiting rows blurred again by neighbour ranges,
+    // window sums are exact up to blur size 127 (same output for any rows ranges), bigger blurs are not split
+    int rowsRange = ((2*blurSize) > IMAGE_ROWS_RANGE)? (2*blurSize) : IMAGE_ROWS_RANGE;
+    if (blurSize > 127) rowsRange = image->height;
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
+    for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
     {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
+        job.sourceValues = ((i%2) == 0)? values : valuesCopy;
+        job.outputValues = ((i%2) == 0)? valuesCopy : values;
+
+        RunWorkerJobs(BlurImageRows, &job, image->height, rowsRange);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    // Reverse premultiply, into image data
+    job.sourceValues = ((GAUSSIAN_BLUR_ITERATIONS%2) == 0)? values : valuesCopy;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    RunWorkerJobs(UnpremultiplyImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 
-    ImageFormat(image, format);
+    RL_FREE(values);
+    RL_FREE(valuesCopy);
 }
 
 // Apply custom square convolution kernel to image
@@ -2248,120 +2510,38 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         return;
     }
 
-    Color *pixels = LoadImageColors(*image);
-
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
     }
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    // Kernel is applied to RGBA source pixels by rows ranges over worker threads
+    // NOTE: R8G8B8A8 output is written to a new buffer, other formats are loaded as RGBA source and written in place
+    ImageRowsJob job = { 0 };
+    job.image = *image;
+    job.kernel = kernel;
+    job.kernelWidth = kernelWidth;
 
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
-
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+        job.source = (const Color *)image->data;
+        job.output = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+        RunWorkerJobs(ConvolveImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
+        RL_FREE(image->data);
+        image->data = job.output;
     }
-
-    for (int i = 0; i < (image->width*image->height); i++)
+    else
     {
-        float alpha = (float)imageCopy2[i].w;
-
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
+        Color *pixels = LoadImageColors(*image);
+        job.source = pixels;
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+        RunWorkerJobs(ConvolveImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
+        UnloadImageColors(pixels);
+    }
 }
 
 // Generate all mipmap levels for a provided image
@@ -2369,10 +2549,25 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
 void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, MIPMAP_FILTER_BOX, false);
+}
+
+// Generate all mipmap levels for a provided image, with filter and gamma-correct (sRGB) filtering
+// NOTE: Every level is filtered from previous one into image data, in image format (no conversion),
+// large levels rows filtered over worker threads. Gamma-correct filtering applies to 8 bit formats
+// color channels (alpha and float channels are filtered linearly)
+void ImageMipmapsEx(Image *image, int filter, bool srgb)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
+    }
+
     int mipCount = 1;                   // Required mipmap levels count (including base level)
     int mipWidth = image->width;        // Base image width
     int mipHeight = image->height;      // Base image height
@@ -2384,10 +2579,6 @@ void ImageMipmaps(Image *image)
         if (mipWidth != 1) mipWidth /= 2;
         if (mipHeight != 1) mipHeight /= 2;
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-
         TRACELOGD("IMAGE: Next mipmap level: %i x %i - current size %i", mipWidth, mipHeight, mipSize);
 
         mipCount++;
@@ -2398,40 +2589,97 @@ void ImageMipmaps(Image *image)
     {
         void *temp = RL_REALLOC(image->data, mipSize);
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        if (temp == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        image->data = temp;      // Assign new pointer (new size) to store mipmaps data
+
+        ImageMipmapJob job = { 0 };
+        job.channels = 4;
+        job.alpha = 3;
+
+        switch (image->format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            case PIXELFORMAT_UNCOMPRESSED_R16: job.channels = 1; job.alpha = -1; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: job.channels = 2; job.alpha = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16: job.channels = 3; job.alpha = -1; break;
+            default: break;
+        }
+
+        // Gamma-correct filtering tables (8 bit channels): sRGB values decoded to linear [0..255], linear values encoded to sRGB
+        float linearTable[256] = { 0 };
+        unsigned char *srgbTable = NULL;
 
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = image->data;
+        if (srgb)
+        {
+            srgbTable = (unsigned char *)RL_MALLOC(4096);
+
+            for (int i = 0; i < 256; i++)
+            {
+                float value = (float)i/255.0f;
+                linearTable[i] = 255.0f*((value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f));
+            }
+
+            for (int i = 0; i < 4096; i++)
+            {
+                float value = (float)i/4095.0f;
+                value = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+                srgbTable[i] = (unsigned char)(value*255.0f + 0.5f);
+            }
+        }
 
-        mipWidth = image->width;
-        mipHeight = image->height;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+        job.linearTable = linearTable;
+        job.srgbTable = srgbTable;
+        job.source = *image;
+        job.source.mipmaps = 1;
 
         for (int i = 1; i < mipCount; i++)
         {
-            nextmip += mipSize;
+            job.level = job.source;
+            job.level.data = (unsigned char *)job.source.data + GetPixelDataSize(job.source.width, job.source.height, image->format);
+            job.level.width = (job.source.width > 1)? job.source.width/2 : 1;
+            job.level.height = (job.source.height > 1)? job.source.height/2 : 1;
 
-            mipWidth /= 2;
-            mipHeight /= 2;
+            // Levels already available are kept, next ones filtered from them
+            if (i >= image->mipmaps)
+            {
+                TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i)", i, job.level.width, job.level.height);
+
+                job.columnTaps = GetMipmapKernelTaps(job.source.width, job.level.width, filter);
+                job.rowTaps = GetMipmapKernelTaps(job.source.height, job.level.height, filter);
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+                int *columns = (int *)RL_MALLOC(job.level.width*job.columnTaps*sizeof(int));
+                float *columnWeights = (float *)RL_MALLOC(job.level.width*job.columnTaps*sizeof(float));
+                int *rows = (int *)RL_MALLOC(job.level.height*job.rowTaps*sizeof(int));
+                float *rowWeights = (float *)RL_MALLOC(job.level.height*job.rowTaps*sizeof(float));
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+                SetMipmapKernel(job.source.width, job.level.width, filter, job.columnTaps, columns, columnWeights);
+                SetMipmapKernel(job.source.height, job.level.height, filter, job.rowTaps, rows, rowWeights);
 
-            if (i < image->mipmaps) continue;
+                job.columns = columns;
+                job.columnWeights = columnWeights;
+                job.rows = rows;
+                job.rowWeights = rowWeights;
 
-            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+                RunWorkerJobs(GenerateMipmapRows, &job, job.level.height, IMAGE_ROWS_RANGE);
 
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+                RL_FREE(columns);
+                RL_FREE(columnWeights);
+                RL_FREE(rows);
+                RL_FREE(rowWeights);
+            }
 
-            memcpy(nextmip, imCopy.data, mipSize);
+            job.source = job.level;
         }
 
-        UnloadImage(imCopy);
+        RL_FREE(srgbTable);
 
         image->mipmaps = mipCount;
     }
@@ -2458,9 +2706,12 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
     else
     {
-        Color *pixels = LoadImageColors(*image);
-
-        RL_FREE(image->data);      // free old image data
+        // NOTE: Source pixels are streamed by rows, only current and next row are kept as RGBA,
+        // error diffusion is sequential so image is not processed by rows ranges
+        Image source = *image;
+        Color *rows = (Color *)RL_MALLOC(2*image->width*sizeof(Color));
+        Color *pixels = rows;
+        Color *nextPixels = rows + image->width;
 
         if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
         {
@@ -2478,7 +2729,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         }
 
         // NOTE: We will store the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+        unsigned short *dithered = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
         Color oldPixel = WHITE;
         Color newPixel = WHITE;
@@ -2488,11 +2739,15 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 
         #define MIN(a,b) (((a)<(b))?(a):(b))
 
+        GetImageColors(source, 0, image->width, pixels);
+
         for (int y = 0; y < image->height; y++)
         {
+            if (y < (image->height - 1)) GetImageColors(source, (y + 1)*image->width, image->width, nextPixels);
+
             for (int x = 0; x < image->width; x++)
             {
-                oldPixel = pixels[y*image->width + x];
+                oldPixel = pixels[x];
 
                 // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
                 newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
@@ -2506,35 +2761,33 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
                 gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
                 bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
 
-                pixels[y*image->width + x] = newPixel;
-
                 // NOTE: Some cases are out of the array and should be ignored
                 if (x < (image->width - 1))
                 {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+                    pixels[x+1].r = MIN((int)pixels[x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                    pixels[x+1].g = MIN((int)pixels[x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                    pixels[x+1].b = MIN((int)pixels[x+1].b + (int)((float)bError*7.0f/16), 0xff);
                 }
 
                 if ((x > 0) && (y < (image->height - 1)))
                 {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                    nextPixels[x-1].r = MIN((int)nextPixels[x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                    nextPixels[x-1].g = MIN((int)nextPixels[x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                    nextPixels[x-1].b = MIN((int)nextPixels[x-1].b + (int)((float)bError*3.0f/16), 0xff);
                 }
 
                 if (y < (image->height - 1))
                 {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                    nextPixels[x].r = MIN((int)nextPixels[x].r + (int)((float)rError*5.0f/16), 0xff);
+                    nextPixels[x].g = MIN((int)nextPixels[x].g + (int)((float)gError*5.0f/16), 0xff);
+                    nextPixels[x].b = MIN((int)nextPixels[x].b + (int)((float)bError*5.0f/16), 0xff);
                 }
 
                 if ((x < (image->width - 1)) && (y < (image->height - 1)))
                 {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                    nextPixels[x+1].r = MIN((int)nextPixels[x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                    nextPixels[x+1].g = MIN((int)nextPixels[x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                    nextPixels[x+1].b = MIN((int)nextPixels[x+1].b + (int)((float)bError*1.0f/16), 0xff);
                 }
 
                 rPixel = (unsigned short)newPixel.r;
@@ -2542,11 +2795,19 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
                 bPixel = (unsigned short)newPixel.b;
                 aPixel = (unsigned short)newPixel.a;
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+                dithered[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
             }
+
+            // Next row becomes current row, current row buffer is reused for the following row
+            Color *rowPixels = pixels;
+            pixels = nextPixels;
+            nextPixels = rowPixels;
         }
 
-        UnloadImageColors(pixels);
+        RL_FREE(rows);
+        RL_FREE(source.data);      // free old image data
+
+        image->data = dithered;
     }
 }
 
@@ -2748,28 +3009,18 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    // Image rows are tinted in place by ranges over worker threads
+    ImageRowsJob job = { 0 };
+    job.image = *image;
+    job.color = color;
 
-    ImageFormat(image, format);
+    RunWorkerJobs(TintImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 }
 
 // Modify image color: invert
@@ -2809,52 +3060,40 @@ void ImageColorContrast(Image *image, float contrast)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
+    }
+
     if (contrast < -100) contrast = -100;
     if (contrast > 100) contrast = 100;
 
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = LoadImageColors(*image);
+    // Contrast only depends on channel value, channels are mapped with a lookup table
+    unsigned char table[256] = { 0 };
 
-    for (int i = 0; i < image->width*image->height; i++)
+    for (int i = 0; i < 256; i++)
     {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
+        float value = (float)i/255.0f;
+        value -= 0.5f;
+        value *= contrast;
+        value += 0.5f;
+        value *= 255;
+        if (value < 0) value = 0;
+        if (value > 255) value = 255;
+
+        table[i] = (unsigned char)value;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
+    // Image rows are mapped in place by ranges over worker threads
+    ImageRowsJob job = { 0 };
+    job.image = *image;
+    job.table = table;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    RunWorkerJobs(TableImageRows, &job, image->height, IMAGE_ROWS_RANGE);
 }
 
 // Modify image color: brightness
@@ -2949,132 +3188,7 @@ Color *LoadImageColors(Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
+        GetImageColors(image, 0, image.width*image.height, pixels);
     }
 
     return pixels;
@@ -4809,6 +4923,399 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
     }
 }
 
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+
+// Load texture atlas (empty), pages are created on demand
+// NOTE: If maxPages is reached, least recently used page is evicted to add new images (0: unlimited)
+TextureAtlas *LoadTextureAtlas(int pageSize, int maxPages, int padding)
+{
+    TextureAtlas *atlas = (TextureAtlas *)RL_CALLOC(1, sizeof(TextureAtlas));
+
+    atlas->pageSize = pageSize;
+    atlas->maxPages = maxPages;
+    atlas->padding = (padding > 0)? padding : 0;
+    atlas->freeSprite = -1;
+
+    return atlas;
+}
+
+// Unload texture atlas pages from GPU memory (VRAM)
+void UnloadTextureAtlas(TextureAtlas *atlas)
+{
+    if (atlas == NULL) return;
+
+    for (int i = 0; i < atlas->pageCount; i++)
+    {
+        UnloadTexture(atlas->pages[i].texture);
+        RL_FREE(atlas->pages[i].context);
+        RL_FREE(atlas->pages[i].nodes);
+    }
+
+    RL_FREE(atlas->pages);
+    RL_FREE(atlas->sprites);
+    RL_FREE(atlas);
+}
+
+// Add image to texture atlas, returns sprite handle (-1 on failure)
+int AddTextureAtlasImage(TextureAtlas *atlas, Image image)
+{
+    int sprite = -1;
+
+    AddTextureAtlasImages(atlas, &image, 1, &sprite);
+
+    return sprite;
+}
+
+// Add images to texture atlas, returns packed images count
+// NOTE: Images are packed together (sorted by height) into existing pages free space first,
+// new pages are added as required, sprites handles are returned (-1 for images not packed)
+int AddTextureAtlasImages(TextureAtlas *atlas, const Image *images, int count, int *sprites)
+{
+    if ((atlas == NULL) || (images == NULL) || (count <= 0)) return 0;
+
+    int packedCount = 0;
+    int pendingCount = 0;
+    stbrp_rect *rects = (stbrp_rect *)RL_CALLOC(count, sizeof(stbrp_rect));
+
+    for (int i = 0; i < count; i++)
+    {
+        sprites[i] = -1;
+
+        int width = images[i].width + 2*atlas->padding;
+        int height = images[i].height + 2*atlas->padding;
+
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0)) TRACELOG(LOG_WARNING, "TEXTURE: [ATLAS] Failed to add image, image not valid");
+        else if (images[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "TEXTURE: [ATLAS] Failed to add image, compressed formats not supported");
+        else if ((width > atlas->pageSize) || (height > atlas->pageSize)) TRACELOG(LOG_WARNING, "TEXTURE: [ATLAS] Failed to add image, image bigger than atlas page (%ix%i)", images[i].width, images[i].height);
+        else
+        {
+            rects[pendingCount].id = i;
+            rects[pendingCount].w = width;
+            rects[pendingCount].h = height;
+            pendingCount++;
+        }
+    }
+
+    // Sprites slots limit, images exceeding available slots are not packed
+    int availableSlots = atlas->freeCount + (ATLAS_SPRITE_MAX_SLOTS - atlas->spriteCount);
+
+    if (pendingCount > availableSlots)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ATLAS] Failed to add %i images, sprites limit reached (%i)", pendingCount - availableSlots, ATLAS_SPRITE_MAX_SLOTS);
+        pendingCount = availableSlots;
+    }
+
+    // Pack pending images into existing pages free space first, then into new (or evicted) pages
+    // NOTE: Pages used by this call are not evicted by this call, an empty page always fits one image at least
+    unsigned int callMark = atlas->useMark;
+
+    for (int page = 0; (page < atlas->pageCount) && (pendingCount > 0); page++)
+    {
+        pendingCount = PackTextureAtlasPage(atlas, page, images, rects, pendingCount, sprites);
+    }
+
+    while (pendingCount > 0)
+    {
+        int page = AddTextureAtlasPage(atlas, callMark);
+        if (page == -1) break;
+
+        pendingCount = PackTextureAtlasPage(atlas, page, images, rects, pendingCount, sprites);
+    }
+
+    if (pendingCount > 0) TRACELOG(LOG_WARNING, "TEXTURE: [ATLAS] Failed to pack %i images, no atlas page available", pendingCount);
+
+    RL_FREE(rects);
+
+    for (int i = 0; i < count; i++) if (sprites[i] != -1) packedCount++;
+
+    return packedCount;
+}
+
+// Add image files to texture atlas, returns packed images count
+// NOTE: Images are loaded and packed together, sprites handles are returned (-1 for images not loaded or packed)
+int AddTextureAtlasFiles(TextureAtlas *atlas, const char **fileNames, int count, int *sprites)
+{
+    if ((atlas == NULL) || (fileNames == NULL) || (count <= 0)) return 0;
+
+    Image *images = (Image *)RL_CALLOC(count, sizeof(Image));
+
+    for (int i = 0; i < count; i++) images[i] = LoadImage(fileNames[i]);
+
+    int packedCount = AddTextureAtlasImages(atlas, images, count, sprites);
+
+    for (int i = 0; i < count; i++) UnloadImage(images[i]);
+    RL_FREE(images);
+
+    return packedCount;
+}
+
+// Check if a texture atlas sprite is valid (packed and not evicted)
+bool IsTextureAtlasSpriteValid(TextureAtlas *atlas, int sprite)
+{
+    bool result = false;
+
+    if ((atlas != NULL) && (sprite >= 0))
+    {
+        int index = ATLAS_SPRITE_INDEX(sprite);
+
+        // NOTE: Handles of evicted sprites are not valid, even if their slot has been reused
+        if ((index < atlas->spriteCount) && (atlas->sprites[index].page >= 0) &&
+            (ATLAS_SPRITE_HANDLE(index, atlas->sprites[index].generation) == sprite)) result = true;
+    }
+
+    return result;
+}
+
+// Get texture atlas sprite, page texture and source rectangle, to be drawn with DrawTextureRec()/DrawTexturePro()
+// NOTE: Sprite page is marked as used, least recently used page is evicted first
+AtlasSprite GetTextureAtlasSprite(TextureAtlas *atlas, int sprite)
+{
+    AtlasSprite result = { 0 };
+
+    if (IsTextureAtlasSpriteValid(atlas, sprite))
+    {
+        AtlasSpriteEntry *entry = &atlas->sprites[ATLAS_SPRITE_INDEX(sprite)];
+        AtlasPage *page = &atlas->pages[entry->page];
+
+        if (page->lastUse != atlas->useMark) page->lastUse = ++atlas->useMark;
+
+        result.texture = page->texture;
+        result.source = entry->source;
+    }
+
+    return result;
+}
+
+// Get texture atlas pages count
+int GetTextureAtlasPageCount(TextureAtlas *atlas)
+{
+    return (atlas != NULL)? atlas->pageCount : 0;
+}
+
+// Get texture atlas page texture
+Texture2D GetTextureAtlasPage(TextureAtlas *atlas, int page)
+{
+    Texture2D texture = { 0 };
+
+    if ((atlas != NULL) && (page >= 0) && (page < atlas->pageCount)) texture = atlas->pages[page].texture;
+
+    return texture;
+}
+
+// Draw a texture atlas sprite
+// NOTE: All sprites in the same page are drawn with the same texture, batched together
+void DrawTextureAtlasSprite(TextureAtlas *atlas, int sprite, Vector2 position, Color tint)
+{
+    AtlasSprite atlasSprite = GetTextureAtlasSprite(atlas, sprite);
+
+    if (atlasSprite.texture.id > 0) DrawTextureRec(atlasSprite.texture, atlasSprite.source, position, tint);
+}
+
+// Draw a texture atlas sprite with extended parameters
+void DrawTextureAtlasSpritePro(TextureAtlas *atlas, int sprite, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    AtlasSprite atlasSprite = GetTextureAtlasSprite(atlas, sprite);
+
+    if (atlasSprite.texture.id > 0) DrawTexturePro(atlasSprite.texture, atlasSprite.source, dest, origin, rotation, tint);
+}
+
+//------------------------------------------------------------------------------------
+// Texture loader functions
+//------------------------------------------------------------------------------------
+
+// Load texture loader (empty)
+TextureLoader *LoadTextureLoader(void)
+{
+    TextureLoader *loader = (TextureLoader *)RL_CALLOC(1, sizeof(TextureLoader));
+
+    return loader;
+}
+
+// Unload texture loader and its textures from GPU memory (VRAM)
+// NOTE: Images being decoded on worker threads are waited to be decoded
+void UnloadTextureLoader(TextureLoader *loader)
+{
+    if (loader == NULL) return;
+
+    for (int i = 0; i < loader->textureCount; i++)
+    {
+        TextureRequest *request = loader->textures[i].request;
+
+        if (request != NULL)
+        {
+            WaitWorkerTask(request->task);
+            UnloadImage(request->image);
+            RL_FREE(request->fileName);
+            RL_FREE(request);
+        }
+        else if (loader->textures[i].state == TEXTURE_LOAD_READY) UnloadTexture(loader->textures[i].texture);
+    }
+
+    RL_FREE(loader->textures);
+    RL_FREE(loader);
+}
+
+// Add image file to be loaded as texture, returns texture handle (-1 on failure)
+// NOTE: Image is decoded, converted to format (0: keep file format) and mipmaps generated on a worker thread,
+// compressed formats are encoded and cached [LoadImageCompressed()], file data is loaded from worker thread
+// [LoadFileView()], custom file data callback must be thread-safe
+int AddTextureLoaderFile(TextureLoader *loader, const char *fileName, int format, bool mipmaps)
+{
+    int handle = -1;
+
+    if ((loader != NULL) && (fileName != NULL))
+    {
+        // Throughput stats restart when textures are added to an idle loader
+        if (loader->loadedCount == loader->textureCount)
+        {
+            loader->startTime = GetTime();
+            loader->decodeEnd = loader->startTime;
+            loader->decodedSize = 0.0;
+        }
+
+        if (loader->textureCount >= loader->textureCapacity)
+        {
+            loader->textureCapacity = (loader->textureCapacity > 0)? loader->textureCapacity*2 : 64;
+            loader->textures = (TextureLoaderEntry *)RL_REALLOC(loader->textures, loader->textureCapacity*sizeof(TextureLoaderEntry));
+        }
+
+        TextureRequest *request = (TextureRequest *)RL_CALLOC(1, sizeof(TextureRequest));
+        request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(request->fileName, fileName);
+        request->format = format;
+        request->mipmaps = mipmaps;
+
+        handle = loader->textureCount;
+        loader->textures[handle] = (TextureLoaderEntry){ TEXTURE_LOAD_PENDING, { 0 }, request };
+        loader->textureCount++;
+
+        QueueTextureLoaderDecoding(loader);
+    }
+
+    return handle;
+}
+
+// Upload decoded textures to GPU, up to budget milliseconds per call
+// NOTE: At least one texture is uploaded per call (if decoded), if no worker threads are available,
+// images are decoded on this call (within budget)
+void UpdateTextureLoader(TextureLoader *loader, float budget)
+{
+    if (loader == NULL) return;
+
+    double updateStart = GetTime();
+
+    loader->uploaded = 0;
+    loader->uploadTime = 0.0f;
+
+    for (int i = loader->firstPending; i < loader->textureCount; i++)
+    {
+        TextureLoaderEntry *entry = &loader->textures[i];
+
+        if (entry->state != TEXTURE_LOAD_PENDING) continue;
+        if ((loader->uploaded > 0) && ((GetTime() - updateStart)*1000.0 >= budget)) break;
+
+        TextureRequest *request = entry->request;
+
+        if (request->task != NULL)
+        {
+            if (!IsWorkerTaskDone(request->task)) continue;
+
+            WaitWorkerTask(request->task);
+            request->task = NULL;
+            loader->decoding--;
+        }
+        else if (loader->mainDecoding && (i == loader->nextDecode))
+        {
+            DecodeTextureRequest(request);
+            loader->nextDecode++;
+        }
+        else continue;
+
+        // Upload decoded image, mipmaps generated by GPU if not generated on decoding
+        double uploadStart = GetTime();
+
+        if (request->image.data != NULL)
+        {
+            entry->texture = LoadTextureFromImage(request->image);
+            if (request->mipmaps && (entry->texture.mipmaps == 1)) GenTextureMipmaps(&entry->texture);
+        }
+
+        double uploadEnd = GetTime();
+
+        if (entry->texture.id > 0)
+        {
+            double dataSize = (double)GetPixelDataSize(request->image.width, request->image.height, request->image.format);
+
+            entry->state = TEXTURE_LOAD_READY;
+            loader->decodedSize += dataSize;
+            loader->uploadedSize += dataSize;
+            loader->uploadTotalTime += (uploadEnd - uploadStart);
+            loader->uploaded++;
+            loader->uploadTime += (float)((uploadEnd - uploadStart)*1000.0);
+        }
+        else
+        {
+            entry->state = TEXTURE_LOAD_FAILED;
+            TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load texture", request->fileName);
+        }
+
+        if (request->decodeEnd > loader->decodeEnd) loader->decodeEnd = request->decodeEnd;
+        loader->loadedCount++;
+
+        UnloadImage(request->image);
+        RL_FREE(request->fileName);
+        RL_FREE(request);
+        entry->request = NULL;
+
+        // Keep worker threads decoding while textures are uploaded
+        QueueTextureLoaderDecoding(loader);
+    }
+
+    while ((loader->firstPending < loader->textureCount) && (loader->textures[loader->firstPending].state != TEXTURE_LOAD_PENDING)) loader->firstPending++;
+}
+
+// Get texture handle load state (TextureLoadState)
+int GetTextureLoadState(TextureLoader *loader, int handle)
+{
+    int state = TEXTURE_LOAD_FAILED;
+
+    if ((loader != NULL) && (handle >= 0) && (handle < loader->textureCount)) state = loader->textures[handle].state;
+
+    return state;
+}
+
+// Get texture handle texture, empty texture (id = 0) if not ready
+// NOTE: Texture is owned by the loader, it's unloaded by UnloadTextureLoader()
+Texture2D GetTextureLoaderTexture(TextureLoader *loader, int handle)
+{
+    Texture2D texture = { 0 };
+
+    if (GetTextureLoadState(loader, handle) == TEXTURE_LOAD_READY) texture = loader->textures[handle].texture;
+
+    return texture;
+}
+
+// Get texture loader throughput stats
+TextureLoaderStats GetTextureLoaderStats(TextureLoader *loader)
+{
+    TextureLoaderStats stats = { 0 };
+
+    if (loader != NULL)
+    {
+        stats.pending = loader->textureCount - loader->loadedCount;
+        stats.loaded = loader->loadedCount;
+        stats.uploaded = loader->uploaded;
+        stats.uploadTime = loader->uploadTime;
+
+        if (loader->decodeEnd > loader->startTime) stats.decodeRate = (float)(loader->decodedSize/(1024.0*1024.0)/(loader->decodeEnd - loader->startTime));
+        if (loader->uploadTotalTime > 0.0) stats.uploadRate = (float)(loader->uploadedSize/(1024.0*1024.0)/loader->uploadTotalTime);
+    }
+
+    return stats;
+}
+
 // Check if two colors are equal
 bool ColorIsEqual(Color col1, Color col2)
 {
@@ -5365,13 +5872,12 @@ int GetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    // Most compressed formats works on 4x4 blocks (ASTC 8x8 on 8x8 blocks),
+    // data size is rounded up to full blocks (PVRT minimum data size is 16)
+    if (((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
+    else if ((format >= PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) dataSize = 16;
 
     return dataSize;
 }
@@ -5546,4 +6052,1322 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Add a new page to texture atlas, returns page index (-1 on failure)
+// NOTE: If max pages is reached, least recently used page (not used after useMark) is evicted and reused,
+// evicted page sprites become invalid
+static int AddTextureAtlasPage(TextureAtlas *atlas, unsigned int useMark)
+{
+    int page = -1;
+
+    if ((atlas->maxPages <= 0) || (atlas->pageCount < atlas->maxPages))
+    {
+        // Page texture initialized to transparent black
+        Image image = { 0 };
+        image.data = RL_CALLOC(atlas->pageSize*atlas->pageSize, 4);
+        image.width = atlas->pageSize;
+        image.height = atlas->pageSize;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        Texture2D texture = LoadTextureFromImage(image);
+        RL_FREE(image.data);
+
+        if (texture.id == 0) return -1;
+
+        page = atlas->pageCount;
+        atlas->pages = (AtlasPage *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(AtlasPage));
+        atlas->pages[page].texture = texture;
+        atlas->pages[page].context = (stbrp_context *)RL_MALLOC(sizeof(stbrp_context));
+        atlas->pages[page].nodes = (stbrp_node *)RL_MALLOC(atlas->pageSize*sizeof(stbrp_node));
+        atlas->pageCount++;
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ATLAS] Page %i added (%ix%i)", page, atlas->pageSize, atlas->pageSize);
+    }
+    else
+    {
+        for (int i = 0; i < atlas->pageCount; i++)
+        {
+            if ((atlas->pages[i].lastUse <= useMark) && ((page == -1) || (atlas->pages[i].lastUse < atlas->pages[page].lastUse))) page = i;
+        }
+
+        if (page == -1) return -1;
+
+        // Draw batched vertices before page texture is overwritten, they could reference evicted sprites
+        rlDrawRenderBatchActive();
+
+        // Invalidate page sprites, page texture is reused (previous content overwritten on sprites upload)
+        // NOTE: Evicted sprites slots are added to free list, to be reused by new sprites
+        int evictedCount = 0;
+        for (int i = 0; i < atlas->spriteCount; i++)
+        {
+            if (atlas->sprites[i].page == page)
+            {
+                atlas->sprites[i].page = -1;
+                atlas->sprites[i].generation++;
+                atlas->sprites[i].nextFree = atlas->freeSprite;
+                atlas->freeSprite = i;
+                atlas->freeCount++;
+                evictedCount++;
+            }
+        }
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ATLAS] Page %i evicted (least recently used), %i sprites invalidated", page, evictedCount);
+    }
+
+    stbrp_init_target(atlas->pages[page].context, atlas->pageSize, atlas->pageSize, atlas->pages[page].nodes, atlas->pageSize);
+    atlas->pages[page].lastUse = ++atlas->useMark;
+
+    return page;
+}
+
+// Pack images rectangles into texture atlas page and upload them, returns images not packed count
+// NOTE: Images not packed are moved to the beginning of rects array
+static int PackTextureAtlasPage(TextureAtlas *atlas, int page, const Image *images, stbrp_rect *rects, int count, int *sprites)
+{
+    stbrp_pack_rects(atlas->pages[page].context, rects, count);
+
+    int remainingCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (rects[i].was_packed)
+        {
+            int index = rects[i].id;
+            int slot = atlas->freeSprite;
+
+            // Reuse free sprite slot (evicted sprite) if available, new slot added otherwise
+            if (slot != -1)
+            {
+                atlas->freeSprite = atlas->sprites[slot].nextFree;
+                atlas->freeCount--;
+            }
+            else
+            {
+                if (atlas->spriteCount >= atlas->spriteCapacity)
+                {
+                    atlas->spriteCapacity = (atlas->spriteCapacity > 0)? atlas->spriteCapacity*2 : 64;
+                    atlas->sprites = (AtlasSpriteEntry *)RL_REALLOC(atlas->sprites, atlas->spriteCapacity*sizeof(AtlasSpriteEntry));
+                }
+
+                slot = atlas->spriteCount;
+                atlas->sprites[slot].generation = 0;
+                atlas->spriteCount++;
+            }
+
+            atlas->sprites[slot].page = page;
+            atlas->sprites[slot].nextFree = -1;
+            atlas->sprites[slot].source = (Rectangle){ (float)(rects[i].x + atlas->padding),
+                (float)(rects[i].y + atlas->padding), (float)images[index].width, (float)images[index].height };
+
+            UploadTextureAtlasSprite(atlas, page, images[index], rects[i].x, rects[i].y);
+
+            sprites[index] = ATLAS_SPRITE_HANDLE(slot, atlas->sprites[slot].generation);
+        }
+        else rects[remainingCount++] = rects[i];
+    }
+
+    if (remainingCount < count) atlas->pages[page].lastUse = ++atlas->useMark;
+
+    return remainingCount;
+}
+
+// Upload image into texture atlas page at padded rectangle position
+// NOTE: Image is converted to RGBA if required (copy), padding is filled with image border pixels (extruded),
+// avoiding bleeding of neighbour sprites with texture filtering
+static void UploadTextureAtlasSprite(TextureAtlas *atlas, int page, Image image, int x, int y)
+{
+    // NOTE: Only base mipmap level is used, it's placed at the beginning of image data
+    Image rgba = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        rgba = ImageCopy(image);
+        ImageFormat(&rgba, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    int padding = atlas->padding;
+    int width = image.width + 2*padding;
+    int height = image.height + 2*padding;
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(width*height*4);
+
+    for (int py = 0; py < height; py++)
+    {
+        int sy = py - padding;
+        if (sy < 0) sy = 0;
+        else if (sy >= image.height) sy = image.height - 1;
+
+        for (int px = 0; px < width; px++)
+        {
+            int sx = px - padding;
+            if (sx < 0) sx = 0;
+            else if (sx >= image.width) sx = image.width - 1;
+
+            memcpy(pixels + (py*width + px)*4, (unsigned char *)rgba.data + (sy*image.width + sx)*4, 4);
+        }
+    }
+
+    UpdateTextureRec(atlas->pages[page].texture, (Rectangle){ (float)x, (float)y, (float)width, (float)height }, pixels);
+
+    RL_FREE(pixels);
+    if (rgba.data != image.data) UnloadImage(rgba);
+}
+
+// Decode texture request image file, converted to requested format and mipmaps generated
+// NOTE: Called from worker threads, multi-threaded image processing functions run serially there
+static void DecodeTextureRequest(void *userData)
+{
+    TextureRequest *request = (TextureRequest *)userData;
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    if (IsBlockCompressedFormat(request->format)) request->image = LoadImageCompressed(request->fileName, request->format, request->mipmaps);
+    else request->image = LoadImage(request->fileName);
+#else
+    request->image = LoadImage(request->fileName);
+#endif
+
+    if ((request->image.data != NULL) && (request->image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        if ((request->format > 0) && (request->format != request->image.format)) ImageFormat(&request->image, request->format);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+        if (request->mipmaps && (request->image.mipmaps == 1)) ImageMipmaps(&request->image);
+#endif
+    }
+
+    request->decodeEnd = GetTime();
+}
+
+// Queue textures decoding on worker threads, up to TEXTURE_LOADER_MAX_DECODING decoding or waiting upload
+static void QueueTextureLoaderDecoding(TextureLoader *loader)
+{
+    while (!loader->mainDecoding && (loader->nextDecode < loader->textureCount) && (loader->decoding < TEXTURE_LOADER_MAX_DECODING))
+    {
+        TextureRequest *request = loader->textures[loader->nextDecode].request;
+        request->task = RunWorkerTask(DecodeTextureRequest, request);
+
+        if (request->task == NULL)
+        {
+            // No worker threads available, images decoded by UpdateTextureLoader()
+            loader->mainDecoding = true;
+            break;
+        }
+
+        loader->nextDecode++;
+        loader->decoding++;
+    }
+}
+
+// Get image pixels colors, same conversion as LoadImageColors()
+// NOTE: Pixels range [offset, offset + count) in pixels units, image data must be uncompressed
+static void GetImageColors(Image image, int offset, int count, Color *colors)
+{
+    const unsigned char *data8 = (const unsigned char *)image.data;
+    const unsigned short *data16 = (const unsigned short *)image.data;
+    const float *data32 = (const float *)image.data;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0; i < count; i++) colors[i] = (Color){ data8[offset + i], data8[offset + i], data8[offset + i], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0, k = offset*2; i < count; i++, k += 2) colors[i] = (Color){ data8[k], data8[k], data8[k], data8[k + 1] };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = data16[offset + i];
+
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                colors[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                colors[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = data16[offset + i];
+
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                colors[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                colors[i].a = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = data16[offset + i];
+
+                colors[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                colors[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                colors[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                colors[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(colors, data8 + offset*4, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3) colors[i] = (Color){ data8[k], data8[k + 1], data8[k + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0; i < count; i++) colors[i] = (Color){ (unsigned char)(data32[offset + i]*255.0f), 0, 0, 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3)
+            {
+                colors[i] = (Color){ (unsigned char)(data32[k]*255.0f), (unsigned char)(data32[k + 1]*255.0f), (unsigned char)(data32[k + 2]*255.0f), 255 };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int i = 0, k = offset*4; i < count; i++, k += 4)
+            {
+                colors[i] = (Color){ (unsigned char)(data32[k]*255.0f), (unsigned char)(data32[k + 1]*255.0f), (unsigned char)(data32[k + 2]*255.0f), (unsigned char)(data32[k + 3]*255.0f) };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            for (int i = 0; i < count; i++) colors[i] = (Color){ (unsigned char)(HalfToFloat(data16[offset + i])*255.0f), 0, 0, 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3)
+            {
+                colors[i] = (Color){ (unsigned char)(HalfToFloat(data16[k])*255.0f), (unsigned char)(HalfToFloat(data16[k + 1])*255.0f), (unsigned char)(HalfToFloat(data16[k + 2])*255.0f), 255 };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = 0, k = offset*4; i < count; i++, k += 4)
+            {
+                colors[i] = (Color){ (unsigned char)(HalfToFloat(data16[k])*255.0f), (unsigned char)(HalfToFloat(data16[k + 1])*255.0f),
+                                     (unsigned char)(HalfToFloat(data16[k + 2])*255.0f), (unsigned char)(HalfToFloat(data16[k + 3])*255.0f) };
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Set image pixels colors, same conversion as ImageFormat()
+// NOTE: Pixels range [offset, offset + count) in pixels units, image data must be uncompressed
+static void SetImageColors(Image image, int offset, int count, const Color *colors)
+{
+    unsigned char *data8 = (unsigned char *)image.data;
+    unsigned short *data16 = (unsigned short *)image.data;
+    float *data32 = (float *)image.data;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            int stride = (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1;
+
+            for (int i = 0, k = offset*stride; i < count; i++, k += stride)
+            {
+                Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+
+                data8[k] = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+                if (stride == 2) data8[k + 1] = colors[i].a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(((float)colors[i].r/255.0f)*31.0f));
+                unsigned char g = (unsigned char)(round(((float)colors[i].g/255.0f)*63.0f));
+                unsigned char b = (unsigned char)(round(((float)colors[i].b/255.0f)*31.0f));
+
+                data16[offset + i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3)
+            {
+                data8[k] = colors[i].r;
+                data8[k + 1] = colors[i].g;
+                data8[k + 2] = colors[i].b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(((float)colors[i].r/255.0f)*31.0f));
+                unsigned char g = (unsigned char)(round(((float)colors[i].g/255.0f)*31.0f));
+                unsigned char b = (unsigned char)(round(((float)colors[i].b/255.0f)*31.0f));
+                unsigned char a = (((float)colors[i].a/255.0f) > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                data16[offset + i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned char r = (unsigned char)(round(((float)colors[i].r/255.0f)*15.0f));
+                unsigned char g = (unsigned char)(round(((float)colors[i].g/255.0f)*15.0f));
+                unsigned char b = (unsigned char)(round(((float)colors[i].b/255.0f)*15.0f));
+                unsigned char a = (unsigned char)(round(((float)colors[i].a/255.0f)*15.0f));
+
+                data16[offset + i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(data8 + offset*4, colors, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: Pixels are converted to grayscale equivalent
+            for (int i = 0; i < count; i++)
+            {
+                Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+                float gray = (float)(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+
+                if (image.format == PIXELFORMAT_UNCOMPRESSED_R32) data32[offset + i] = gray;
+                else data16[offset + i] = FloatToHalf(gray);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            int channels = ((image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16))? 3 : 4;
+            bool half = (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) || (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16);
+
+            for (int i = 0, k = offset*channels; i < count; i++, k += channels)
+            {
+                const unsigned char *channel = &colors[i].r;
+
+                for (int c = 0; c < channels; c++)
+                {
+                    if (half) data16[k + c] = FloatToHalf((float)channel[c]/255.0f);
+                    else data32[k + c] = (float)channel[c]/255.0f;
+                }
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Set image rows range from source pixels
+static void SetImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+
+    SetImageColors(job->image, start*width, (end - start)*width, job->source + start*width);
+}
+
+// Resize image splits range (stb_image_resize2)
+static void ResizeImageSplits(void *userData, int start, int end)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)userData, start, end - start);
+}
+
+// Resize image data, output split over worker threads
+// NOTE: Same output is generated for any number of splits, only height downscaling is split:
+// stb_image_resize2 splits can start at output rows with trimmed contributors when upscaling (3x or more)
+static void ResizeImageData(const void *input, int width, int height, void *output, int newWidth, int newHeight, int channels, int type)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, (stbir_datatype)type);
+
+    bool split = (newHeight <= height) && (newHeight >= 2*IMAGE_ROWS_RANGE);
+    int splits = stbir_build_samplers_with_splits(&resize, split? GetWorkerCount() : 1);
+
+    if (splits > 0) RunWorkerJobs(ResizeImageSplits, &resize, splits, 1);
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to resize image data");
+
+    stbir_free_samplers(&resize);
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Load pixel vector from color (RGBA channels as floats)
+static PixelVector LoadPixelVector(Color color)
+{
+#if defined(IMAGE_SIMD_SSE)
+    int value = 0;
+    memcpy(&value, &color, sizeof(Color));
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i channels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(value), zero), zero);
+
+    return _mm_cvtepi32_ps(channels);
+#elif defined(IMAGE_SIMD_NEON)
+    uint32_t value = 0;
+    memcpy(&value, &color, sizeof(Color));
+
+    uint16x8_t channels = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(value)));
+
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(channels)));
+#else
+    PixelVector vector = { { (float)color.r, (float)color.g, (float)color.b, (float)color.a } };
+
+    return vector;
+#endif
+}
+
+// Store pixel vector into color, channels clamped to [0..255] and truncated
+static Color StorePixelVector(PixelVector vector)
+{
+    Color color = { 0 };
+
+#if defined(IMAGE_SIMD_SSE)
+    vector = _mm_min_ps(_mm_max_ps(vector, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+
+    __m128i channels = _mm_cvttps_epi32(vector);
+    channels = _mm_packs_epi32(channels, channels);
+    channels = _mm_packus_epi16(channels, channels);
+
+    int value = _mm_cvtsi128_si32(channels);
+    memcpy(&color, &value, sizeof(Color));
+#elif defined(IMAGE_SIMD_NEON)
+    vector = vminq_f32(vmaxq_f32(vector, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+
+    uint16x4_t channels = vmovn_u32(vcvtq_u32_f32(vector));
+
+    uint32_t value = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(channels, channels))), 0);
+    memcpy(&color, &value, sizeof(Color));
+#else
+    unsigned char *channels = &color.r;
+
+    for (int i = 0; i < 4; i++) channels[i] = (unsigned char)((vector.v[i] < 0.0f)? 0.0f : ((vector.v[i] > 255.0f)? 255.0f : vector.v[i]));
+#endif
+
+    return color;
+}
+
+// Load pixel vector from floats (RGBA)
+static PixelVector LoadPixelVectorFloats(const float *values)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_loadu_ps(values);
+#elif defined(IMAGE_SIMD_NEON)
+    return vld1q_f32(values);
+#else
+    PixelVector vector = { { values[0], values[1], values[2], values[3] } };
+
+    return vector;
+#endif
+}
+
+// Store pixel vector into floats (RGBA)
+static void StorePixelVectorFloats(float *values, PixelVector vector)
+{
+#if defined(IMAGE_SIMD_SSE)
+    _mm_storeu_ps(values, vector);
+#elif defined(IMAGE_SIMD_NEON)
+    vst1q_f32(values, vector);
+#else
+    for (int i = 0; i < 4; i++) values[i] = vector.v[i];
+#endif
+}
+
+// Load pixel vector from unsigned shorts (RGBA)
+static PixelVector LoadPixelVectorShorts(const unsigned short *values)
+{
+#if defined(IMAGE_SIMD_SSE)
+    __m128i channels = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)values), _mm_setzero_si128());
+
+    return _mm_cvtepi32_ps(channels);
+#elif defined(IMAGE_SIMD_NEON)
+    return vcvtq_f32_u32(vmovl_u16(vld1_u16(values)));
+#else
+    PixelVector vector = { { (float)values[0], (float)values[1], (float)values[2], (float)values[3] } };
+
+    return vector;
+#endif
+}
+
+// Store pixel vector into unsigned shorts (RGBA), channels clamped to [0..65535] and rounded
+static void StorePixelVectorShorts(unsigned short *values, PixelVector vector)
+{
+#if defined(IMAGE_SIMD_SSE)
+    vector = _mm_min_ps(_mm_max_ps(_mm_add_ps(vector, _mm_set1_ps(0.5f)), _mm_setzero_ps()), _mm_set1_ps(65535.0f));
+
+    // NOTE: SSE2 only packs signed values, channels are offset to signed range and back
+    __m128i channels = _mm_sub_epi32(_mm_cvttps_epi32(vector), _mm_set1_epi32(32768));
+    channels = _mm_xor_si128(_mm_packs_epi32(channels, channels), _mm_set1_epi16((short)0x8000));
+
+    _mm_storel_epi64((__m128i *)values, channels);
+#elif defined(IMAGE_SIMD_NEON)
+    vector = vminq_f32(vmaxq_f32(vaddq_f32(vector, vdupq_n_f32(0.5f)), vdupq_n_f32(0.0f)), vdupq_n_f32(65535.0f));
+
+    vst1_u16(values, vmovn_u32(vcvtq_u32_f32(vector)));
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        float value = vector.v[i] + 0.5f;
+        values[i] = (unsigned short)((value < 0.0f)? 0.0f : ((value > 65535.0f)? 65535.0f : value));
+    }
+#endif
+}
+
+// Get zero pixel vector
+static PixelVector ZeroPixelVector(void)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_setzero_ps();
+#elif defined(IMAGE_SIMD_NEON)
+    return vdupq_n_f32(0.0f);
+#else
+    PixelVector vector = { 0 };
+
+    return vector;
+#endif
+}
+
+// Add pixel vectors
+static PixelVector AddPixelVectors(PixelVector v1, PixelVector v2)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_add_ps(v1, v2);
+#elif defined(IMAGE_SIMD_NEON)
+    return vaddq_f32(v1, v2);
+#else
+    for (int i = 0; i < 4; i++) v1.v[i] += v2.v[i];
+
+    return v1;
+#endif
+}
+
+// Subtract pixel vectors
+static PixelVector SubtractPixelVectors(PixelVector v1, PixelVector v2)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_sub_ps(v1, v2);
+#elif defined(IMAGE_SIMD_NEON)
+    return vsubq_f32(v1, v2);
+#else
+    for (int i = 0; i < 4; i++) v1.v[i] -= v2.v[i];
+
+    return v1;
+#endif
+}
+
+// Scale pixel vector
+static PixelVector ScalePixelVector(PixelVector v, float scale)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_mul_ps(v, _mm_set1_ps(scale));
+#elif defined(IMAGE_SIMD_NEON)
+    return vmulq_n_f32(v, scale);
+#else
+    for (int i = 0; i < 4; i++) v.v[i] *= scale;
+
+    return v;
+#endif
+}
+
+// Scale pixel vector and add it to sum vector (sum + v*scale)
+static PixelVector ScaleAddPixelVector(PixelVector sum, PixelVector v, float scale)
+{
+#if defined(IMAGE_SIMD_SSE)
+    return _mm_add_ps(sum, _mm_mul_ps(v, _mm_set1_ps(scale)));
+#elif defined(IMAGE_SIMD_NEON)
+    return vmlaq_n_f32(sum, v, scale);
+#else
+    for (int i = 0; i < 4; i++) sum.v[i] += v.v[i]*scale;
+
+    return sum;
+#endif
+}
+
+// Premultiply alpha of image rows range into output values (RGBA 8.8 fixed point)
+// NOTE: Color channels are scaled by alpha without rounding to 8 bits, alpha is kept exact
+static void PremultiplyImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    bool native = (job->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Color *row = native? NULL : (Color *)RL_MALLOC(width*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        const Color *pixels = native? ((const Color *)job->image.data + y*width) : row;
+        unsigned short *values = job->outputValues + y*width*4;
+
+        if (!native) GetImageColors(job->image, y*width, width, row);
+
+        for (int x = 0; x < width; x++)
+        {
+            unsigned int alpha = pixels[x].a;
+
+            values[x*4 + 0] = (unsigned short)((pixels[x].r*alpha*256 + 127)/255);
+            values[x*4 + 1] = (unsigned short)((pixels[x].g*alpha*256 + 127)/255);
+            values[x*4 + 2] = (unsigned short)((pixels[x].b*alpha*256 + 127)/255);
+            values[x*4 + 3] = (unsigned short)(alpha*256);
+        }
+    }
+
+    RL_FREE(row);
+}
+
+// Reverse premultiplied alpha of source values rows range into image
+// NOTE: Values are quantized to 8 bits per channel here (rounded), only once for all blur passes
+static void UnpremultiplyImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    bool native = (job->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Color *row = native? NULL : (Color *)RL_MALLOC(width*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned short *values = job->sourceValues + y*width*4;
+        Color *pixels = native? ((Color *)job->image.data + y*width) : row;
+
+        for (int x = 0; x < width; x++)
+        {
+            Color color = { 0, 0, 0, 0 };
+            float alpha = (float)values[x*4 + 3]/256.0f;
+
+            if (alpha >= 0.5f)
+            {
+                // Channels divided by alpha, 8.8 fixed point scale cancels out
+                float scale = 255.0f/(float)values[x*4 + 3];
+                float r = (float)values[x*4 + 0]*scale + 0.5f;
+                float g = (float)values[x*4 + 1]*scale + 0.5f;
+                float b = (float)values[x*4 + 2]*scale + 0.5f;
+
+                color.r = (unsigned char)((r < 255.0f)? r : 255.0f);
+                color.g = (unsigned char)((g < 255.0f)? g : 255.0f);
+                color.b = (unsigned char)((b < 255.0f)? b : 255.0f);
+                color.a = (unsigned char)(alpha + 0.5f);
+            }
+
+            pixels[x] = color;
+        }
+
+        if (!native) SetImageColors(job->image, y*width, width, row);
+    }
+
+    RL_FREE(row);
+}
+
+// Box blur pixels row (horizontal), RGBA 8.8 fixed point values
+// NOTE: Window [x - blurSize, x + blurSize] clamped to row, window sums are exact (integer values),
+// output is the window average, rounded
+static void BlurImageRow(const unsigned short *values, int width, int blurSize, unsigned short *output)
+{
+    PixelVector sum = ZeroPixelVector();
+
+    for (int x = 0; (x < blurSize) && (x < width); x++) sum = AddPixelVectors(sum, LoadPixelVectorShorts(values + x*4));
+
+    for (int x = 0; x < width; x++)
+    {
+        if (x - blurSize - 1 >= 0) sum = SubtractPixelVectors(sum, LoadPixelVectorShorts(values + (x - blurSize - 1)*4));
+        if (x + blurSize < width) sum = AddPixelVectors(sum, LoadPixelVectorShorts(values + (x + blurSize)*4));
+
+        int columns = (((x + blurSize) < width)? (x + blurSize) : (width - 1)) - (((x - blurSize) > 0)? (x - blurSize) : 0) + 1;
+        StorePixelVectorShorts(output + x*4, ScalePixelVector(sum, 1.0f/(float)columns));
+    }
+}
+
+// Box blur source values rows range into output values (RGBA 8.8 fixed point)
+// NOTE: Rows are blurred horizontally into a ring buffer while sliding the vertical window,
+// rows out of range (window halo) are blurred again by neighbour ranges, not shared between threads
+static void BlurImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    int height = job->image.height;
+    int blurSize = job->blurSize;
+
+    // Ring buffer keeps horizontally blurred rows of vertical window [y - blurSize, y + blurSize]
+    int ringSize = ((2*blurSize + 2) < height)? (2*blurSize + 2) : height;
+    unsigned short *ring = (unsigned short *)RL_MALLOC(ringSize*width*4*sizeof(unsigned short));
+    float *sums = (float *)RL_CALLOC(width*4, sizeof(float));      // Vertical window sums, per column
+
+    int first = ((start - blurSize) > 0)? (start - blurSize) : 0;
+    int last = ((start + blurSize) < height)? (start + blurSize) : (height - 1);
+
+    for (int row = first; row <= last; row++)
+    {
+        unsigned short *blurred = ring + (row%ringSize)*width*4;
+        BlurImageRow(job->sourceValues + row*width*4, width, blurSize, blurred);
+
+        for (int x = 0; x < width*4; x += 4) StorePixelVectorFloats(sums + x, AddPixelVectors(LoadPixelVectorFloats(sums + x), LoadPixelVectorShorts(blurred + x)));
+    }
+
+    for (int y = start; y < end; y++)
+    {
+        if (y > start)
+        {
+            int removedRow = y - blurSize - 1;
+            int addedRow = y + blurSize;
+
+            if (removedRow >= 0)
+            {
+                const unsigned short *blurred = ring + (removedRow%ringSize)*width*4;
+                for (int x = 0; x < width*4; x += 4) StorePixelVectorFloats(sums + x, SubtractPixelVectors(LoadPixelVectorFloats(sums + x), LoadPixelVectorShorts(blurred + x)));
+            }
+
+            if (addedRow < height)
+            {
+                unsigned short *blurred = ring + (addedRow%ringSize)*width*4;
+                BlurImageRow(job->sourceValues + addedRow*width*4, width, blurSize, blurred);
+
+                for (int x = 0; x < width*4; x += 4) StorePixelVectorFloats(sums + x, AddPixelVectors(LoadPixelVectorFloats(sums + x), LoadPixelVectorShorts(blurred + x)));
+            }
+        }
+
+        // Window sums are divided by window rows count, clipped by image borders
+        int rows = (((y + blurSize) < height)? (y + blurSize) : (height - 1)) - (((y - blurSize) > 0)? (y - blurSize) : 0) + 1;
+        unsigned short *output = job->outputValues + y*width*4;
+
+        for (int x = 0; x < width*4; x += 4) StorePixelVectorShorts(output + x, ScalePixelVector(LoadPixelVectorFloats(sums + x), 1.0f/(float)rows));
+    }
+
+    RL_FREE(ring);
+    RL_FREE(sums);
+}
+
+// Apply convolution kernel to source pixels rows range
+// NOTE: Output pixels written to output buffer (if provided) or image data, pixels out of image are ignored
+static void ConvolveImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    int height = job->image.height;
+    int kernelWidth = job->kernelWidth;
+    int kernelOffset = kernelWidth/2;
+
+    // Source rows are converted to floats once, ring buffer keeps kernel window rows [y - kernelOffset, y - kernelOffset + kernelWidth)
+    float *ring = (float *)RL_MALLOC(kernelWidth*width*4*sizeof(float));
+    Color *row = (job->output == NULL)? (Color *)RL_MALLOC(width*sizeof(Color)) : NULL;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int i = (y == start)? 0 : (kernelWidth - 1); i < kernelWidth; i++)
+        {
+            int sourceRow = y - kernelOffset + i;
+
+            if ((sourceRow >= 0) && (sourceRow < height))
+            {
+                float *values = ring + (sourceRow%kernelWidth)*width*4;
+                for (int x = 0; x < width; x++) StorePixelVectorFloats(values + x*4, LoadPixelVector(job->source[sourceRow*width + x]));
+            }
+        }
+
+        Color *pixels = (job->output != NULL)? (job->output + y*width) : row;
+
+        for (int x = 0; x < width; x++)
+        {
+            PixelVector sum = ZeroPixelVector();
+
+            // Kernel columns inside image: x + j - kernelOffset in [0, width)
+            int firstColumn = ((kernelOffset - x) > 0)? (kernelOffset - x) : 0;
+            int lastColumn = ((width - x + kernelOffset) < kernelWidth)? (width - x + kernelOffset) : kernelWidth;
+
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                int sourceRow = y - kernelOffset + i;
+                if ((sourceRow < 0) || (sourceRow >= height)) continue;
+
+                const float *values = ring + (sourceRow%kernelWidth)*width*4;
+                const float *weights = job->kernel + i*kernelWidth;
+
+                for (int j = firstColumn; j < lastColumn; j++) sum = ScaleAddPixelVector(sum, LoadPixelVectorFloats(values + (x + j - kernelOffset)*4), weights[j]);
+            }
+
+            pixels[x] = StorePixelVector(sum);
+        }
+
+        if (job->output == NULL) SetImageColors(job->image, y*width, width, row);
+    }
+
+    RL_FREE(ring);
+    RL_FREE(row);
+}
+
+// Tint pixels row, channels multiplied by tint color channels (divided by 255, truncated)
+static void TintImageRow(Color *pixels, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE)
+    // Four pixels per iteration, exact division by 255: (x + 1 + (x >> 8)) >> 8
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi16(1);
+    __m128i factor = _mm_setr_epi16(tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i colors = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi8(colors, zero), factor);
+        __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi8(colors, zero), factor);
+
+        low = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(low, one), _mm_srli_epi16(low, 8)), 8);
+        high = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(high, one), _mm_srli_epi16(high, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(IMAGE_SIMD_NEON)
+    // Four pixels per iteration, exact division by 255: (x + 1 + (x >> 8)) >> 8
+    uint32_t value = 0;
+    memcpy(&value, &tint, sizeof(Color));
+
+    uint8x8_t factor = vreinterpret_u8_u32(vdup_n_u32(value));
+    uint16x8_t one = vdupq_n_u16(1);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint8x16_t colors = vld1q_u8((const uint8_t *)(pixels + i));
+        uint16x8_t low = vmull_u8(vget_low_u8(colors), factor);
+        uint16x8_t high = vmull_u8(vget_high_u8(colors), factor);
+
+        low = vshrq_n_u16(vaddq_u16(vaddq_u16(low, one), vshrq_n_u16(low, 8)), 8);
+        high = vshrq_n_u16(vaddq_u16(vaddq_u16(high, one), vshrq_n_u16(high, 8)), 8);
+
+        vst1q_u8((uint8_t *)(pixels + i), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        pixels[i].r = (unsigned char)(((int)pixels[i].r*(int)tint.r)/255);
+        pixels[i].g = (unsigned char)(((int)pixels[i].g*(int)tint.g)/255);
+        pixels[i].b = (unsigned char)(((int)pixels[i].b*(int)tint.b)/255);
+        pixels[i].a = (unsigned char)(((int)pixels[i].a*(int)tint.a)/255);
+    }
+}
+
+// Tint image rows range
+static void TintImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    bool native = (job->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Color *row = native? NULL : (Color *)RL_MALLOC(width*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = native? ((Color *)job->image.data + y*width) : row;
+
+        if (!native) GetImageColors(job->image, y*width, width, row);
+        TintImageRow(pixels, width, job->color);
+        if (!native) SetImageColors(job->image, y*width, width, row);
+    }
+
+    RL_FREE(row);
+}
+
+// Map image rows range color channels with lookup table (alpha not modified)
+static void TableImageRows(void *userData, int start, int end)
+{
+    ImageRowsJob *job = (ImageRowsJob *)userData;
+    int width = job->image.width;
+    bool native = (job->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Color *row = native? NULL : (Color *)RL_MALLOC(width*sizeof(Color));
+
+    for (int y = start; y < end; y++)
+    {
+        Color *pixels = native? ((Color *)job->image.data + y*width) : row;
+
+        if (!native) GetImageColors(job->image, y*width, width, row);
+
+        for (int x = 0; x < width; x++)
+        {
+            pixels[x].r = job->table[pixels[x].r];
+            pixels[x].g = job->table[pixels[x].g];
+            pixels[x].b = job->table[pixels[x].b];
+        }
+
+        if (!native) SetImageColors(job->image, y*width, width, row);
+    }
+
+    RL_FREE(row);
+}
+
+// Get modified Bessel function of first kind, order 0 (Kaiser window)
+static float GetBesselI0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+
+    for (int k = 1; k < 20; k++)
+    {
+        term *= (x*x/4.0f)/(float)(k*k);
+        sum += term;
+    }
+
+    return sum;
+}
+
+// Get mipmap kernel taps per level pixel
+// NOTE: Box filter covers level pixel area in source pixels, Kaiser filter covers its radius at both sides
+static int GetMipmapKernelTaps(int size, int newSize, int filter)
+{
+    float scale = (float)size/newSize;
+    int taps = (scale == floorf(scale))? (int)scale : ((int)ceilf(scale) + 1);   // Level pixels area aligned to source pixels for integer scales
+
+    if (filter == MIPMAP_FILTER_KAISER) taps = 2*(int)ceilf(MIPMAP_KAISER_RADIUS*scale) + 2;
+
+    return taps;
+}
+
+// Set mipmap kernel source indices and weights per level pixel
+// NOTE: Weights are normalized, indices out of source are clamped to its border
+static void SetMipmapKernel(int size, int newSize, int filter, int taps, int *indices, float *weights)
+{
+    float scale = (float)size/newSize;
+
+    for (int i = 0; i < newSize; i++)
+    {
+        float start = i*scale;                  // Level pixel area start (source pixels)
+        float end = (i + 1)*scale;              // Level pixel area end (source pixels)
+        float center = (start + end)/2.0f;
+        int first = (filter == MIPMAP_FILTER_KAISER)? (int)floorf(center - MIPMAP_KAISER_RADIUS*scale) : (int)floorf(start);
+        float sum = 0.0f;
+
+        for (int k = 0; k < taps; k++)
+        {
+            int index = first + k;
+            float weight = 0.0f;
+
+            if (filter == MIPMAP_FILTER_KAISER)
+            {
+                // Windowed sinc, distance measured in level pixels
+                float t = ((float)index + 0.5f - center)/scale;
+
+                if (fabsf(t) < MIPMAP_KAISER_RADIUS)
+                {
+                    float ratio = t/MIPMAP_KAISER_RADIUS;
+                    float sinc = (fabsf(t) < 0.0001f)? 1.0f : sinf(PI*t)/(PI*t);
+
+                    weight = sinc*GetBesselI0(MIPMAP_KAISER_ALPHA*sqrtf(1.0f - ratio*ratio))/GetBesselI0(MIPMAP_KAISER_ALPHA);
+                }
+            }
+            else
+            {
+                // Source pixel area covered by level pixel
+                float overlap = fminf(end, (float)index + 1.0f) - fmaxf(start, (float)index);
+                if (overlap > 0.0f) weight = overlap;
+            }
+
+            indices[i*taps + k] = (index < 0)? 0 : ((index >= size)? (size - 1) : index);
+            weights[i*taps + k] = weight;
+            sum += weight;
+        }
+
+        for (int k = 0; k < taps; k++) weights[i*taps + k] /= sum;
+    }
+}
+
+// Load source level row as floats (channels per pixel)
+// NOTE: 8 bit channels loaded as linear values [0..255], packed 16 bit formats loaded as RGBA
+static void LoadMipmapRow(const ImageMipmapJob *job, int y, Color *colors, float *values)
+{
+    int width = job->source.width;
+    const unsigned char *pixels = (const unsigned char *)job->source.data;
+
+    switch (job->source.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy(values, (const float *)pixels + y*width*job->channels, width*job->channels*sizeof(float)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            const unsigned short *halfs = (const unsigned short *)pixels + y*width*job->channels;
+            for (int i = 0; i < width*job->channels; i++) values[i] = HalfToFloat(halfs[i]);
+        } break;
+        default:
+        {
+            if ((job->source.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (job->source.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+                (job->source.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (job->source.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+            {
+                GetImageColors(job->source, y*width, width, colors);
+                pixels = (const unsigned char *)colors;
+            }
+            else pixels += y*width*job->channels;
+
+            if (job->srgbTable != NULL)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    for (int c = 0; c < job->channels; c++)
+                    {
+                        unsigned char value = pixels[x*job->channels + c];
+                        values[x*job->channels + c] = (c == job->alpha)? (float)value : job->linearTable[value];
+                    }
+                }
+            }
+            else
+            {
+                // Channels converted by groups of 4 (pixel vectors), not depending on pixels channels
+                int i = 0;
+
+                for (; (i + 4) <= width*job->channels; i += 4)
+                {
+                    Color group = { 0 };
+                    memcpy(&group, pixels + i, 4);
+                    StorePixelVectorFloats(values + i, LoadPixelVector(group));
+                }
+
+                for (; i < width*job->channels; i++) values[i] = (float)pixels[i];
+            }
+        } break;
+    }
+}
+
+// Store floats into mipmap level row
+// NOTE: 8 bit channels values rounded and clamped to [0..255], sRGB encoded if required
+static void StoreMipmapRow(const ImageMipmapJob *job, int y, Color *colors, const float *values)
+{
+    int width = job->level.width;
+    unsigned char *pixels = (unsigned char *)job->level.data;
+
+    switch (job->level.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy((float *)pixels + y*width*job->channels, values, width*job->channels*sizeof(float)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            unsigned short *halfs = (unsigned short *)pixels + y*width*job->channels;
+            for (int i = 0; i < width*job->channels; i++) halfs[i] = FloatToHalf(values[i]);
+        } break;
+        default:
+        {
+            bool packed = (job->level.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (job->level.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+                (job->level.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (job->level.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            unsigned char *output = packed? (unsigned char *)colors : (pixels + y*width*job->channels);
+
+            if (job->srgbTable != NULL)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    for (int c = 0; c < job->channels; c++)
+                    {
+                        float value = values[x*job->channels + c];
+
+                        if (c != job->alpha)
+                        {
+                            int index = (int)(value*(4095.0f/255.0f) + 0.5f);
+                            output[x*job->channels + c] = job->srgbTable[(index < 0)? 0 : ((index > 4095)? 4095 : index)];
+                        }
+                        else output[x*job->channels + c] = (unsigned char)((value < 0.0f)? 0.0f : ((value > 255.0f)? 255.0f : (value + 0.5f)));
+                    }
+                }
+            }
+            else
+            {
+                const float rounding[4] = { 0.5f, 0.5f, 0.5f, 0.5f };
+                int i = 0;
+
+                for (; (i + 4) <= width*job->channels; i += 4)
+                {
+                    Color group = StorePixelVector(AddPixelVectors(LoadPixelVectorFloats(values + i), LoadPixelVectorFloats(rounding)));
+                    memcpy(output + i, &group, 4);
+                }
+
+                for (; i < width*job->channels; i++) output[i] = (unsigned char)((values[i] < 0.0f)? 0.0f : ((values[i] > 255.0f)? 255.0f : (values[i] + 0.5f)));
+            }
+
+            if (packed) SetImageColors(job->level, y*width, width, colors);
+        } break;
+    }
+}
+
+// Generate mipmap level rows range from previous level
+// NOTE: Source rows are filtered vertically into a row of sums, then sums filtered horizontally
+static void GenerateMipmapRows(void *userData, int start, int end)
+{
+    ImageMipmapJob *job = (ImageMipmapJob *)userData;
+    int sourceCount = job->source.width*job->channels;
+    int levelCount = job->level.width*job->channels;
+
+    float *values = (float *)RL_MALLOC(sourceCount*sizeof(float));
+    float *sums = (float *)RL_MALLOC(sourceCount*sizeof(float));
+    float *output = (float *)RL_MALLOC(levelCount*sizeof(float));
+    Color *colors = (Color *)RL_MALLOC(job->source.width*sizeof(Color));    // Packed formats conversion row
+
+    for (int y = start; y < end; y++)
+    {
+        const int *rows = job->rows + y*job->rowTaps;
+        const float *rowWeights = job->rowWeights + y*job->rowTaps;
+
+        memset(sums, 0, sourceCount*sizeof(float));
+
+        for (int k = 0; k < job->rowTaps; k++)
+        {
+            if (rowWeights[k] == 0.0f) continue;
+
+            LoadMipmapRow(job, rows[k], colors, values);
+
+            int i = 0;
+            for (; (i + 4) <= sourceCount; i += 4) StorePixelVectorFloats(sums + i, ScaleAddPixelVector(LoadPixelVectorFloats(sums + i), LoadPixelVectorFloats(values + i), rowWeights[k]));
+            for (; i < sourceCount; i++) sums[i] += values[i]*rowWeights[k];
+        }
+
+        for (int x = 0; x < job->level.width; x++)
+        {
+            const int *columns = job->columns + x*job->columnTaps;
+            const float *columnWeights = job->columnWeights + x*job->columnTaps;
+
+            if (job->channels == 4)
+            {
+                PixelVector sum = ZeroPixelVector();
+                for (int k = 0; k < job->columnTaps; k++) sum = ScaleAddPixelVector(sum, LoadPixelVectorFloats(sums + columns[k]*4), columnWeights[k]);
+                StorePixelVectorFloats(output + x*4, sum);
+            }
+            else
+            {
+                for (int c = 0; c < job->channels; c++)
+                {
+                    float sum = 0.0f;
+                    for (int k = 0; k < job->columnTaps; k++) sum += sums[columns[k]*job->channels + c]*columnWeights[k];
+                    output[x*job->channels + c] = sum;
+                }
+            }
+        }
+
+        StoreMipmapRow(job, y, colors, output);
+    }
+
+    RL_FREE(values);
+    RL_FREE(sums);
+    RL_FREE(output);
+    RL_FREE(colors);
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// Check if pixel format is compressed by 4x4 blocks, encoded and decoded on CPU
+static bool IsBlockCompressedFormat(int format)
+{
+    return ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA));
+}
+
+// Compress image data (R8G8B8A8, including mipmaps) into compressed format
+// NOTE: Every mipmap level blocks rows are compressed by ranges over worker threads
+static void CompressImageData(Image *image, int format)
+{
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    ImageBlocksJob job = { (unsigned char *)image->data, data, image->width, image->height, format };
+
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        RunWorkerJobs(CompressImageBlockRows, &job, (job.height + 3)/4, IMAGE_ROWS_RANGE/4);
+
+        job.pixels += GetPixelDataSize(job.width, job.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        job.blocks += GetPixelDataSize(job.width, job.height, format);
+        job.width = (job.width > 1)? job.width/2 : 1;
+        job.height = (job.height > 1)? job.height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = format;
+}
+
+// Decompress image data (including mipmaps) into R8G8B8A8
+static void DecompressImageData(Image *image)
+{
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    ImageBlocksJob job = { data, (unsigned char *)image->data, image->width, image->height, image->format };
+
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        RunWorkerJobs(DecompressImageBlockRows, &job, (job.height + 3)/4, IMAGE_ROWS_RANGE/4);
+
+        job.pixels += GetPixelDataSize(job.width, job.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        job.blocks += GetPixelDataSize(job.width, job.height, image->format);
+        job.width = (job.width > 1)? job.width/2 : 1;
+        job.height = (job.height > 1)? job.height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+
+// Compress image level blocks rows range
+// NOTE: Blocks pixels out of image (width or height not multiple of 4) are clamped to image border
+static void CompressImageBlockRows(void *userData, int start, int end)
+{
+    ImageBlocksJob *job = (ImageBlocksJob *)userData;
+    int blocksWidth = (job->width + 3)/4;
+    int blockSize = GetPixelDataSize(4, 4, job->format);
+    unsigned char pixels[64] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksWidth; bx++)
+        {
+            for (int y = 0; y < 4; y++)
+            {
+                int py = ((by*4 + y) < job->height)? (by*4 + y) : (job->height - 1);
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = ((bx*4 + x) < job->width)? (bx*4 + x) : (job->width - 1);
+                    memcpy(pixels + (y*4 + x)*4, job->pixels + (py*job->width + px)*4, 4);
+                }
+            }
+
+            rl_compress_block(pixels, job->format, job->blocks + (by*blocksWidth + bx)*blockSize);
+        }
+    }
+}
+
+// Decompress image level blocks rows range
+static void DecompressImageBlockRows(void *userData, int start, int end)
+{
+    ImageBlocksJob *job = (ImageBlocksJob *)userData;
+    int blocksWidth = (job->width + 3)/4;
+    int blockSize = GetPixelDataSize(4, 4, job->format);
+    unsigned char pixels[64] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksWidth; bx++)
+        {
+            rl_decompress_block(job->blocks + (by*blocksWidth + bx)*blockSize, job->format, pixels);
+
+            for (int y = 0; (y < 4) && ((by*4 + y) < job->height); y++)
+            {
+                for (int x = 0; (x < 4) && ((bx*4 + x) < job->width); x++)
+                {
+                    memcpy(job->pixels + ((by*4 + y)*job->width + bx*4 + x)*4, pixels + (y*4 + x)*4, 4);
+                }
+            }
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_COMPRESSION
+
 #endif      // SUPPORT_MODULE_RTEXTURES
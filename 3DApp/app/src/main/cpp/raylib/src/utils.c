@@ -7,6 +7,14 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_WORKER_THREADS
+*           Use a pool of worker threads to run CPU-heavy jobs split by ranges (and background tasks)
+*           NOTE: Requires POSIX threads, if not available jobs run on the calling thread
+*
+*       #define MAX_TEXT_FORMAT_ARENA_SIZE
+*           TextFormat() per-thread arena max size, strings are valid until frame end (or arena reset),
+*           if a thread formats more text in a frame, its older strings expire
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +57,101 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(FILE_VIEW_MAPPING)
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
+#if defined(SUPPORT_WORKER_THREADS) && !defined(_WIN32)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()...
+    #include <unistd.h>                 // Required for: sysconf()
+    #define WORKER_THREADS_AVAILABLE
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS            8         // Maximum number of threads in the worker pool
+#endif
+#ifndef MAX_WORKER_JOBS
+    #define MAX_WORKER_JOBS              64         // Maximum number of jobs queued in the worker pool
+#endif
+#ifndef MAX_TEXT_FORMAT_ARENA_SIZE
+    #define MAX_TEXT_FORMAT_ARENA_SIZE  1048576     // Maximum size of per-thread frame arena for formatted strings: TextFormat()
+#endif
+#ifndef TEXT_FORMAT_ARENA_BLOCK_SIZE
+    #define TEXT_FORMAT_ARENA_BLOCK_SIZE   4096     // Initial size of per-thread frame arena block: TextFormat()
+#endif
+
+// Thread local storage, used by TextFormat() frame arena
+#if defined(_MSC_VER)
+    #define TEXT_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define TEXT_THREAD_LOCAL __thread
+#else
+    #define TEXT_THREAD_LOCAL                       // WARNING: No thread local storage, TextFormat() is not thread-safe
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Text format arena block, strings are appended one after another
+typedef struct TextFormatBlock {
+    struct TextFormatBlock *prev;       // Previous block (filled), freed on arena rewind
+    int size;                           // Block data size in bytes
+    int used;                           // Block data used in bytes
+    char *data;                         // Block data (allocated after block header)
+} TextFormatBlock;
+
+// Text format arena, one per thread, main thread arena rewound on frame end
+typedef struct TextFormatArena {
+    TextFormatBlock *block;             // Current block (last allocated)
+    int totalSize;                      // Blocks size in bytes (all blocks)
+} TextFormatArena;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker job, the [0, count) items range is split in rangeCount ranges,
+// ranges are claimed by worker threads and the calling thread while available
+typedef struct WorkerJob {
+    WorkerJobCallback callback;         // Job callback, processes one range
+    void *userData;                     // Job user data
+    int count;                          // Job items count
+    int rangeSize;                      // Items per range (last range could be smaller)
+    int rangeCount;                     // Number of ranges
+    int nextRange;                      // Next range to be claimed
+    int doneRanges;                     // Number of ranges already processed
+} WorkerJob;
+
+// Worker task, run by one worker thread, caller does not wait completion
+struct WorkerTask {
+    WorkerTaskCallback callback;        // Task callback
+    void *userData;                     // Task user data
+    bool done;                          // Task done flag (protected by pool lock)
+    struct WorkerTask *next;            // Next task in tasks list
+};
+
+// Worker pool, threads wait for jobs to be queued
+typedef struct WorkerPool {
+    bool ready;                         // Pool initialized flag
+    bool quit;                          // Threads should exit flag
+    int threadCount;                    // Number of worker threads created
+    pthread_t threads[MAX_WORKER_THREADS]; // Worker threads
+    pthread_mutex_t lock;               // Pool lock, protects queue and jobs state
+    pthread_cond_t jobQueued;           // Signaled when jobs are queued
+    pthread_cond_t jobDone;             // Signaled when some job range is done
+    WorkerJob *queue[MAX_WORKER_JOBS];  // Jobs queue (ring buffer)
+    int queueHead;                      // Queue first job index
+    int queueCount;                     // Queue jobs count
+    WorkerTask *firstTask;              // Tasks list first task (next to be run)
+    WorkerTask *lastTask;               // Tasks list last task
+} WorkerPool;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +164,8 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static TEXT_THREAD_LOCAL TextFormatArena textFormatArena = { 0 };  // Formatted strings arena (per thread): TextFormat()
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -76,6 +175,11 @@ void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = cal
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static WorkerPool workerPool = { 0 };               // Worker pool, lazy initialized on first job
+static pthread_mutex_t workerPoolInitLock = PTHREAD_MUTEX_INITIALIZER; // Worker pool init lock (first jobs can be run from several threads)
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
 static const char *internalDataPath = NULL;         // Android internal data path
@@ -92,6 +196,15 @@ static int android_read(void *cookie, char *buf, int size);
 static int android_write(void *cookie, const char *buf, int size);
 static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
+static void GetDataFilePath(const char *fileName, char *filePath, int size);  // Get file path in internal data path (absolute paths kept)
+#endif
+
+static TextFormatBlock *LoadTextFormatBlock(int size);  // Load text format arena block (header and data)
+
+#if defined(WORKER_THREADS_AVAILABLE)
+static bool InitWorkerPool(void);                   // Init worker pool threads
+static void *WorkerThread(void *arg);               // Worker thread main loop
+static bool RunWorkerJobRange(WorkerJob *job);      // Claim and process one job range (must be called with pool locked)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -250,6 +363,109 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file view, file data mapped read-only into memory (no copy into heap memory)
+// NOTE: Files are memory-mapped (POSIX), Android assets use asset buffer (uncompressed assets are mapped from APK),
+// file data is loaded [LoadFileData()] if mapping is not available or a custom file loader is set
+FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return view;
+    }
+
+#if defined(FILE_VIEW_MAPPING)
+    if (loadFileData == NULL)
+    {
+        const char *filePath = fileName;
+
+    #if defined(PLATFORM_ANDROID)
+        char dataFilePath[512] = { 0 };     // NOTE: Not using TextFormat(), file views can be loaded from worker threads
+
+        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_BUFFER);
+
+        if (asset != NULL)
+        {
+            const void *data = AAsset_getBuffer(asset);
+            off_t size = AAsset_getLength(asset);
+
+            if ((data != NULL) && (size > 0) && (size <= 2147483647))
+            {
+                view.data = (const unsigned char *)data;
+                view.dataSize = (int)size;
+                view.mapped = true;
+                view.handle = asset;
+
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully (asset)", fileName);
+                return view;
+            }
+
+            AAsset_close(asset);
+        }
+
+        // File not found in the assets, mapped from internal data path
+        GetDataFilePath(fileName, dataFilePath, 512);
+        filePath = dataFilePath;
+    #endif
+
+        int file = open(filePath, O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+            {
+                void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                if (data != MAP_FAILED)
+                {
+                    view.data = (const unsigned char *)data;
+                    view.dataSize = (int)info.st_size;
+                    view.mapped = true;
+                }
+            }
+
+            close(file);    // NOTE: Mapping is kept once file is closed
+
+            if (view.mapped)
+            {
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+                return view;
+            }
+        }
+    }
+#endif
+
+    // Mapping not available, file data is loaded
+    view.data = LoadFileData(fileName, &view.dataSize);
+
+    return view;
+}
+
+// Unload file view (unmap or unload file data)
+void UnloadFileView(FileView view)
+{
+    if (view.data == NULL) return;
+
+#if defined(FILE_VIEW_MAPPING)
+    if (view.mapped)
+    {
+    #if defined(PLATFORM_ANDROID)
+        if (view.handle != NULL) AAsset_close((AAsset *)view.handle);
+        else munmap((void *)view.data, (size_t)view.dataSize);
+    #else
+        munmap((void *)view.data, (size_t)view.dataSize);
+    #endif
+        return;
+    }
+#endif
+
+    UnloadFileData((unsigned char *)view.data);
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -287,6 +503,34 @@ bool SaveFileData(const char *fileName, void *data, int dataSize)
     return success;
 }
 
+// Rename file, new file replaced if it exists, returns true on success
+// NOTE: On Android, relative paths refer to internal data path, same as files written [android_fopen()]
+bool RenameFile(const char *fileName, const char *newFileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    #if defined(PLATFORM_ANDROID)
+    char filePath[512] = { 0 };
+    char newFilePath[512] = { 0 };
+    GetDataFilePath(fileName, filePath, 512);
+    GetDataFilePath(newFileName, newFilePath, 512);
+    fileName = filePath;
+    newFileName = newFilePath;
+    #endif
+    #if defined(_WIN32)
+    remove(newFileName);    // NOTE: rename() fails on Windows if new file exists
+    #endif
+
+    if (rename(fileName, newFileName) == 0) success = true;
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to rename file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, file can not be renamed");
+#endif
+
+    return success;
+}
+
 // Export data to code (.h), returns true on success
 bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName)
 {
@@ -438,6 +682,273 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Get number of threads running jobs (including caller)
+int GetWorkerCount(void)
+{
+    int count = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    // NOTE: Pool is initialized under lock, only one thread creates the worker threads
+    pthread_mutex_lock(&workerPoolInitLock);
+    if (!workerPool.ready) InitWorkerPool();
+    count += workerPool.threadCount;
+    pthread_mutex_unlock(&workerPoolInitLock);
+#endif
+
+    return count;
+}
+
+// Run job over [0, count) items, split in ranges processed in parallel, waits completion
+// NOTE: Ranges are at least minRange items, calling thread also processes ranges,
+// if called from a worker thread, the job is run serially to avoid dead-locks
+void RunWorkerJobs(WorkerJobCallback callback, void *userData, int count, int minRange)
+{
+    if ((callback == NULL) || (count <= 0)) return;
+    if (minRange < 1) minRange = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    int workers = GetWorkerCount();
+    bool isWorker = false;
+
+    for (int i = 0; i < workerPool.threadCount; i++)
+    {
+        if (pthread_equal(pthread_self(), workerPool.threads[i])) { isWorker = true; break; }
+    }
+
+    if ((workers > 1) && (count >= 2*minRange) && !isWorker)
+    {
+        WorkerJob job = { 0 };
+        job.callback = callback;
+        job.userData = userData;
+        job.count = count;
+        job.rangeCount = count/minRange;
+        if (job.rangeCount > workers) job.rangeCount = workers;
+        job.rangeSize = (count + job.rangeCount - 1)/job.rangeCount;
+        job.rangeCount = (count + job.rangeSize - 1)/job.rangeSize;
+
+        pthread_mutex_lock(&workerPool.lock);
+
+        // Queue job once per extra range, if queue is full, remaining ranges are run by caller
+        for (int i = 1; (i < job.rangeCount) && (workerPool.queueCount < MAX_WORKER_JOBS); i++)
+        {
+            workerPool.queue[(workerPool.queueHead + workerPool.queueCount)%MAX_WORKER_JOBS] = &job;
+            workerPool.queueCount++;
+        }
+
+        pthread_cond_broadcast(&workerPool.jobQueued);
+
+        while (RunWorkerJobRange(&job)) { }
+        while (job.doneRanges < job.rangeCount) pthread_cond_wait(&workerPool.jobDone, &workerPool.lock);
+
+        // Remove job references not yet claimed by workers
+        // NOTE: Job lives on caller stack, it must not stay queued
+        int queueCount = workerPool.queueCount;
+        workerPool.queueCount = 0;
+        for (int i = 0; i < queueCount; i++)
+        {
+            WorkerJob *queued = workerPool.queue[(workerPool.queueHead + i)%MAX_WORKER_JOBS];
+            if (queued != &job) workerPool.queue[(workerPool.queueHead + workerPool.queueCount++)%MAX_WORKER_JOBS] = queued;
+        }
+
+        pthread_mutex_unlock(&workerPool.lock);
+        return;
+    }
+#endif
+
+    callback(userData, 0, count);
+}
+
+// Run task on a worker thread, caller does not wait completion
+// NOTE: Returns NULL if no worker threads available, task must be run by caller,
+// tasks are run in queued order, after split jobs ranges (callers waiting them)
+WorkerTask *RunWorkerTask(WorkerTaskCallback callback, void *userData)
+{
+    WorkerTask *task = NULL;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if ((callback != NULL) && (GetWorkerCount() > 1))
+    {
+        task = (WorkerTask *)RL_CALLOC(1, sizeof(WorkerTask));
+        task->callback = callback;
+        task->userData = userData;
+
+        pthread_mutex_lock(&workerPool.lock);
+
+        if (workerPool.lastTask != NULL) workerPool.lastTask->next = task;
+        else workerPool.firstTask = task;
+        workerPool.lastTask = task;
+
+        pthread_cond_signal(&workerPool.jobQueued);
+        pthread_mutex_unlock(&workerPool.lock);
+    }
+#endif
+
+    return task;
+}
+
+// Check if worker task is done (no wait)
+bool IsWorkerTaskDone(WorkerTask *task)
+{
+    bool done = true;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    // NOTE: Queued tasks are run before worker pool is closed
+    if ((task != NULL) && (workerPool.threadCount > 0))
+    {
+        pthread_mutex_lock(&workerPool.lock);
+        done = task->done;
+        pthread_mutex_unlock(&workerPool.lock);
+    }
+#endif
+
+    return done;
+}
+
+// Wait worker task completion and release it
+void WaitWorkerTask(WorkerTask *task)
+{
+    if (task == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.threadCount > 0)
+    {
+        pthread_mutex_lock(&workerPool.lock);
+        while (!task->done) pthread_cond_wait(&workerPool.jobDone, &workerPool.lock);
+        pthread_mutex_unlock(&workerPool.lock);
+    }
+#endif
+
+    RL_FREE(task);
+}
+
+// Close worker pool threads (if initialized)
+// NOTE: Queued tasks are run before threads exit
+void CloseWorkerPool(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (workerPool.ready)
+    {
+        pthread_mutex_lock(&workerPool.lock);
+        workerPool.quit = true;
+        pthread_cond_broadcast(&workerPool.jobQueued);
+        pthread_mutex_unlock(&workerPool.lock);
+
+        for (int i = 0; i < workerPool.threadCount; i++) pthread_join(workerPool.threads[i], NULL);
+
+        pthread_cond_destroy(&workerPool.jobDone);
+        pthread_cond_destroy(&workerPool.jobQueued);
+        pthread_mutex_destroy(&workerPool.lock);
+
+        TRACELOG(LOG_INFO, "THREADS: Worker pool closed successfully");
+
+        pthread_mutex_lock(&workerPoolInitLock);
+        workerPool = (WorkerPool){ 0 };
+        pthread_mutex_unlock(&workerPoolInitLock);
+    }
+#endif
+}
+
+// Formatting of text with variables to 'embed'
+// NOTE: Strings are stored in calling thread arena, no length limit, valid until frame end [EndDrawing()],
+// strings formatted on other threads are valid until thread arena reset [ResetTextFormatArena()]
+// WARNING: If a thread formats more than MAX_TEXT_FORMAT_ARENA_SIZE bytes in a frame, its older strings expire
+const char *TextFormat(const char *text, ...)
+{
+    TextFormatBlock *block = textFormatArena.block;
+    char *buffer = (block != NULL)? (block->data + block->used) : NULL;
+    int available = (block != NULL)? (block->size - block->used) : 0;
+
+    // Try formatting into current block free space, no buffer clearing required
+    va_list args;
+    va_start(args, text);
+    int length = vsnprintf(buffer, available, text, args);
+    va_end(args);
+
+    if (length < 0) return "";
+
+    if (length >= available)
+    {
+        // Not enough space, load a new block (doubling blocks size, up to arena size) and format again
+        int size = TEXT_FORMAT_ARENA_BLOCK_SIZE;
+        if (block != NULL) size = (block->size < MAX_TEXT_FORMAT_ARENA_SIZE/2)? block->size*2 : MAX_TEXT_FORMAT_ARENA_SIZE;
+        if (size < (length + 1)) size = length + 1;
+
+        TextFormatBlock *newBlock = LoadTextFormatBlock(size);
+        newBlock->prev = block;
+        textFormatArena.block = newBlock;
+        textFormatArena.totalSize += size;
+
+        buffer = newBlock->data;
+
+        va_start(args, text);
+        vsnprintf(buffer, size, text, args);
+        va_end(args);
+
+        // Arena full, previous blocks are freed (after formatting, text arguments could point to them)
+        if (textFormatArena.totalSize > MAX_TEXT_FORMAT_ARENA_SIZE)
+        {
+            while (block != NULL)
+            {
+                TextFormatBlock *prev = block->prev;
+                RL_FREE(block);
+                block = prev;
+            }
+
+            newBlock->prev = NULL;
+            textFormatArena.totalSize = size;
+
+            TRACELOG(LOG_DEBUG, "TEXT: Format arena full, strings formatted previously in frame expired");
+        }
+
+        block = newBlock;
+    }
+
+    block->used += (length + 1);
+
+    return buffer;
+}
+
+// Reset calling thread formatted strings arena, strings returned by TextFormat() expire
+// NOTE: Arena memory is freed, useful on worker threads (per task or before exiting)
+void ResetTextFormatArena(void)
+{
+    TextFormatBlock *block = textFormatArena.block;
+
+    while (block != NULL)
+    {
+        TextFormatBlock *prev = block->prev;
+        RL_FREE(block);
+        block = prev;
+    }
+
+    textFormatArena = (TextFormatArena){ 0 };
+}
+
+// Rewind calling thread formatted strings arena, strings returned by TextFormat() expire
+// NOTE: Called on EndDrawing() [module: core], if multiple blocks were required in frame,
+// they are merged into one block (no allocations on next frames)
+void RewindTextFormatArena(void)
+{
+    TextFormatBlock *block = textFormatArena.block;
+
+    if ((block != NULL) && (block->prev != NULL))
+    {
+        int totalSize = textFormatArena.totalSize;
+        if (totalSize > MAX_TEXT_FORMAT_ARENA_SIZE) totalSize = MAX_TEXT_FORMAT_ARENA_SIZE;
+
+        while (block != NULL)
+        {
+            TextFormatBlock *prev = block->prev;
+            RL_FREE(block);
+            block = prev;
+        }
+
+        textFormatArena.block = LoadTextFormatBlock(totalSize);
+        textFormatArena.totalSize = totalSize;
+    }
+    else if (block != NULL) block->used = 0;
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -450,6 +961,10 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath)
 // Ref: https://developer.android.com/ndk/reference/group/asset
 FILE *android_fopen(const char *fileName, const char *mode)
 {
+    // NOTE: Not using TextFormat(), files can be loaded from worker threads
+    char dataFilePath[512] = { 0 };
+    GetDataFilePath(fileName, dataFilePath, 512);
+
     if (mode[0] == 'w')
     {
         // fopen() is mapped to android_fopen() that only grants read access to
@@ -457,7 +972,7 @@ FILE *android_fopen(const char *fileName, const char *mode)
         // write data when required using the standard stdio FILE access functions
         // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
         #undef fopen
-        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+        return fopen(dataFilePath, mode);
         #define fopen(name, mode) android_fopen(name, mode)
     }
     else
@@ -474,7 +989,7 @@ FILE *android_fopen(const char *fileName, const char *mode)
         {
             #undef fopen
             // Just do a regular open if file is not found in the assets
-            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+            return fopen(dataFilePath, mode);
             #define fopen(name, mode) android_fopen(name, mode)
         }
     }
@@ -484,6 +999,19 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load text format arena block, data is allocated next to block header
+static TextFormatBlock *LoadTextFormatBlock(int size)
+{
+    TextFormatBlock *block = (TextFormatBlock *)RL_MALLOC(sizeof(TextFormatBlock) + size);
+
+    block->prev = NULL;
+    block->size = size;
+    block->used = 0;
+    block->data = (char *)(block + 1);
+
+    return block;
+}
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -507,4 +1035,99 @@ static int android_close(void *cookie)
     AAsset_close((AAsset *)cookie);
     return 0;
 }
+
+// Get file path in internal data path, absolute paths are kept
+static void GetDataFilePath(const char *fileName, char *filePath, int size)
+{
+    if (fileName[0] == '/') snprintf(filePath, size, "%s", fileName);
+    else snprintf(filePath, size, "%s/%s", internalDataPath, fileName);
+}
 #endif  // PLATFORM_ANDROID
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Init worker pool threads, one per available processor (minus the calling thread)
+// NOTE: Must be called with pool init lock locked [GetWorkerCount()]
+static bool InitWorkerPool(void)
+{
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    int threadCount = (processors > 1)? (int)processors - 1 : 0;
+    if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+
+    // NOTE: Pool is marked as ready even without threads to avoid further init attempts
+    workerPool.ready = true;
+    if (threadCount == 0) return false;
+
+    pthread_mutex_init(&workerPool.lock, NULL);
+    pthread_cond_init(&workerPool.jobQueued, NULL);
+    pthread_cond_init(&workerPool.jobDone, NULL);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (pthread_create(&workerPool.threads[workerPool.threadCount], NULL, WorkerThread, NULL) != 0) break;
+        workerPool.threadCount++;
+    }
+
+    if (workerPool.threadCount > 0) TRACELOG(LOG_INFO, "THREADS: Worker pool initialized successfully (%i threads)", workerPool.threadCount);
+    else TRACELOG(LOG_WARNING, "THREADS: Failed to create worker threads, jobs run on calling thread");
+
+    return (workerPool.threadCount > 0);
+}
+
+// Worker thread main loop, waits for queued jobs and processes their ranges (or queued tasks)
+static void *WorkerThread(void *arg)
+{
+    pthread_mutex_lock(&workerPool.lock);
+
+    while (!workerPool.quit || (workerPool.firstTask != NULL))
+    {
+        if (workerPool.queueCount > 0)
+        {
+            WorkerJob *job = workerPool.queue[workerPool.queueHead];
+            workerPool.queueHead = (workerPool.queueHead + 1)%MAX_WORKER_JOBS;
+            workerPool.queueCount--;
+
+            RunWorkerJobRange(job);
+        }
+        else if (workerPool.firstTask != NULL)
+        {
+            WorkerTask *task = workerPool.firstTask;
+            workerPool.firstTask = task->next;
+            if (workerPool.firstTask == NULL) workerPool.lastTask = NULL;
+
+            pthread_mutex_unlock(&workerPool.lock);
+            task->callback(task->userData);
+            pthread_mutex_lock(&workerPool.lock);
+
+            task->done = true;
+            pthread_cond_broadcast(&workerPool.jobDone);
+        }
+        else pthread_cond_wait(&workerPool.jobQueued, &workerPool.lock);
+    }
+
+    pthread_mutex_unlock(&workerPool.lock);
+
+    ResetTextFormatArena();     // Free worker thread formatted strings arena [TextFormat()]
+
+    return NULL;
+}
+
+// Claim and process one job range, returns false if no range was available
+// NOTE: Must be called with pool locked, lock is released while processing the range
+static bool RunWorkerJobRange(WorkerJob *job)
+{
+    if (job->nextRange >= job->rangeCount) return false;
+
+    int range = job->nextRange++;
+    int start = range*job->rangeSize;
+    int end = ((start + job->rangeSize) < job->count)? (start + job->rangeSize) : job->count;
+
+    pthread_mutex_unlock(&workerPool.lock);
+    job->callback(job->userData, start, end);
+    pthread_mutex_lock(&workerPool.lock);
+
+    job->doneRanges++;
+    if (job->doneRanges == job->rangeCount) pthread_cond_broadcast(&workerPool.jobDone);
+
+    return true;
+}
+#endif  // WORKER_THREADS_AVAILABLE
@@ -52,10 +52,23 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// File views are mapped into memory on POSIX platforms (and Android assets), file data is loaded otherwise
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    #define FILE_VIEW_MAPPING
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Worker job callback, processes the items range [start, end) of a split job
+typedef void (*WorkerJobCallback)(void *userData, int start, int end);
+
+// Worker task callback, processes one task on a worker thread
+typedef void (*WorkerTaskCallback)(void *userData);
+
+// Worker task, queued to be run by a worker thread
+// NOTE: Actual struct is defined internally in utils module
+typedef struct WorkerTask WorkerTask;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +87,18 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+bool RenameFile(const char *fileName, const char *newFileName);                 // Rename file, new file replaced if it exists
+
+// Worker pool: split CPU-heavy work by ranges over multiple threads
+int GetWorkerCount(void);                                                       // Get number of threads running jobs (including caller)
+void RunWorkerJobs(WorkerJobCallback callback, void *userData, int count, int minRange); // Run job over [0, count) ranges in parallel, waits completion
+WorkerTask *RunWorkerTask(WorkerTaskCallback callback, void *userData);          // Run task on a worker thread, no wait (NULL if no worker threads, run by caller)
+bool IsWorkerTaskDone(WorkerTask *task);                                        // Check if worker task is done (no wait)
+void WaitWorkerTask(WorkerTask *task);                                          // Wait worker task completion and release it
+void CloseWorkerPool(void);                                                     // Close worker pool threads (if initialized)
+
+void RewindTextFormatArena(void);                                               // Rewind calling thread formatted strings arena, TextFormat()
+
 #if defined(__cplusplus)
 }
 #endif